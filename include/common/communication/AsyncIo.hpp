@@ -0,0 +1,185 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#if defined(LINUX)
+
+#include "CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+#include "common/Factory.hpp"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <stdint.h>
+#include <sys/uio.h>
+
+namespace common
+{
+class COMMON_LIB_API IoBackend
+{
+public :
+    enum type : uint8_t
+    {
+        AUTO,       // io_uring if available, otherwise epoll
+        IO_URING,
+        EPOLL,
+    };
+};
+
+/**
+ * @brief Asynchronous I/O interface for Socket, Serial and any other file descriptor
+ * 
+ * Requests are queued by read()/write()/recv_multishot() and handed to the kernel
+ * in one batch by submit(). Completions are reaped by poll() which calls the
+ * completion handlers in the calling thread.
+ * 
+ * Backends:
+ * - IO_URING: Uses io_uring through the kernel ABI. Supports batched submission,
+ *             multishot receive with provided buffers, registered buffers (read_fixed/write_fixed)
+ *             and registered files (register_files).
+ * - EPOLL: Fallback when io_uring is not compiled in or not permitted (e.g. seccomp).
+ *          Requests are performed when the descriptor becomes ready. Registered files and
+ *          buffers are emulated so that the same code works on both backends.
+ * 
+ * Descriptors of Socket and Serial can be obtained by get_native_handle().
+ * 
+ * @warning This class is not thread-safe. Submit and poll from a single thread.
+ *          Buffers must stay valid until the completion handler is called.
+ */
+class COMMON_LIB_API AsyncIo : public NonCopyable
+                             , public Factory<AsyncIo>
+{
+    friend class Factory<AsyncIo>;
+
+public :
+    /**
+     * @brief Completion handler. result is the number of bytes transferred or -errno.
+     */
+    using Completion = std::function<void(const int32_t result)>;
+
+    /**
+     * @brief Multishot receive handler.
+     * 
+     * Called for every received chunk with result > 0. data is valid only during the call.
+     * Called once more with result <= 0 (0 : closed by peer, -errno : error or canceled)
+     * when the receive is finished.
+     */
+    using RecvHandler = std::function<void(const uint8_t* data, const int32_t result)>;
+
+public :
+    virtual ~AsyncIo() = default;
+
+private :
+    /**
+     * @brief Creates an asynchronous I/O instance
+     * 
+     * @param backend Backend to use. AUTO falls back to EPOLL if io_uring is not available.
+     * @param depth Maximum number of requests which can be queued at once
+     * @return std::shared_ptr<AsyncIo> nullptr if the requested backend is not available
+     */
+    static auto __create(IoBackend::type backend = IoBackend::AUTO,
+                         uint32_t depth = 256) noexcept -> std::shared_ptr<AsyncIo>;
+
+public :
+    virtual auto get_backend() const noexcept -> IoBackend::type = 0;
+
+    /**
+     * @brief Registers file descriptors to skip the per-request file lookup of the kernel.
+     * 
+     * Requests on registered descriptors use the fixed file table automatically.
+     * Registering again replaces the previous table.
+     */
+    virtual auto register_files(const int32_t* fds, const size_t count) noexcept -> bool = 0;
+
+    /**
+     * @brief Registers buffers to skip the per-request page pinning of the kernel.
+     * 
+     * Registered buffers are used by read_fixed() and write_fixed() with their index.
+     * Registering again replaces the previous buffers.
+     */
+    virtual auto register_buffers(const iovec* buffers, const size_t count) noexcept -> bool = 0;
+
+    virtual auto read(const int32_t fd, void* buffer, const size_t size, Completion completion) noexcept -> bool = 0;
+    virtual auto write(const int32_t fd, const void* buffer, const size_t size, Completion completion) noexcept -> bool = 0;
+
+    /**
+     * @brief Reads into a registered buffer.
+     * 
+     * @param bufferIndex Index of the buffer given to register_buffers()
+     * @param offset Offset in the registered buffer
+     */
+    virtual auto read_fixed(const int32_t fd,
+                            const uint16_t bufferIndex,
+                            const size_t offset,
+                            const size_t size,
+                            Completion completion) noexcept -> bool = 0;
+
+    virtual auto write_fixed(const int32_t fd,
+                             const uint16_t bufferIndex,
+                             const size_t offset,
+                             const size_t size,
+                             Completion completion) noexcept -> bool = 0;
+
+    /**
+     * @brief Receives from a socket continuously with a single request.
+     * 
+     * Received data is placed into an internal pool of bufferCount buffers of bufferSize bytes.
+     * The receive stays active until cancel() is called, the peer closes the socket or an error occurs.
+     */
+    virtual auto recv_multishot(const int32_t fd,
+                                const size_t bufferSize,
+                                const uint16_t bufferCount,
+                                RecvHandler handler) noexcept -> bool = 0;
+
+    /**
+     * @brief Cancels all requests of the file descriptor. Canceled requests complete with -ECANCELED.
+     * @return false if the cancellation could not be queued (submission queue full); retry after poll()
+     */
+    virtual auto cancel(const int32_t fd) noexcept -> bool = 0;
+
+    /**
+     * @brief Hands all queued requests to the kernel in one batch.
+     * 
+     * @return int32_t Number of submitted requests or -errno
+     */
+    virtual auto submit() noexcept -> int32_t = 0;
+
+    /**
+     * @brief Submits queued requests and calls handlers of completed requests.
+     * 
+     * @param timeout Maximum time to wait for at least one completion. 0 does not wait.
+     * @return size_t Number of completions handled
+     */
+    virtual auto poll(const std::chrono::milliseconds timeout = std::chrono::milliseconds(0)) noexcept -> size_t = 0;
+
+    /**
+     * @brief Gets the number of requests which are not completed yet.
+     */
+    virtual auto get_pending() const noexcept -> size_t = 0;
+};
+} // namespace common
+
+#endif
@@ -0,0 +1,195 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#if defined(LINUX)
+
+#include "CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+#include "common/Factory.hpp"
+#include "common/communication/Socket.hpp"
+
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+namespace common
+{
+namespace detail
+{
+class DatagramSocketDetail;
+} // namespace detail
+
+/**
+ * @brief Preallocated buffers for receiving a batch of datagrams with one recvmmsg() call
+ * 
+ * Allocate once and reuse it for every DatagramSocket::recv_batch() call.
+ */
+class COMMON_LIB_API DatagramBatch : public NonCopyable
+{
+    friend class detail::DatagramSocketDetail;
+
+private :
+    const size_t _capacity;
+    const size_t _bufferSize;
+    size_t _size = 0;
+
+    std::vector<uint8_t> _buffers;
+    std::vector<iovec> _iov;
+    std::vector<mmsghdr> _headers;
+    std::vector<sockaddr_in> _addresses;
+    std::vector<uint8_t> _controls;
+    std::vector<uint64_t> _timestamps;
+    std::vector<uint16_t> _segmentSizes;
+
+public :
+    /**
+     * @param capacity Maximum number of datagrams received at once
+     * @param bufferSize Size of each datagram buffer. Use 64KiB if GRO is enabled.
+     */
+    DatagramBatch(const size_t capacity, const size_t bufferSize);
+
+public :
+    auto capacity() const noexcept -> size_t { return _capacity; }
+
+    /**
+     * @brief Gets the number of datagrams received by the last recv_batch()
+     */
+    auto size() const noexcept -> size_t { return _size; }
+
+    auto data(const size_t index) const noexcept -> const uint8_t* { return _buffers.data() + index * _bufferSize; }
+    auto length(const size_t index) const noexcept -> size_t { return _headers[index].msg_len; }
+    auto source(const size_t index) const noexcept -> const sockaddr_in& { return _addresses[index]; }
+
+    /**
+     * @brief Gets the kernel receive time (CLOCK_REALTIME, ns) if timestamping is enabled, otherwise 0.
+     */
+    auto timestamp(const size_t index) const noexcept -> uint64_t { return _timestamps[index]; }
+
+    /**
+     * @brief Gets the size of the segments coalesced by GRO into this buffer, 0 if not coalesced.
+     */
+    auto segment_size(const size_t index) const noexcept -> uint16_t { return _segmentSizes[index]; }
+};
+
+/**
+ * @brief UDP unicast and multicast socket with batched send and receive
+ * 
+ * Usage:
+ *  1. create(SocketType::UDP or SocketType::MULTICAST)
+ *  2. prepare() with the local address (UDP) or the group address (MULTICAST) and port
+ *  3. Optionally set options (receive buffer, timestamp, GRO, multicast interface)
+ *  4. open() binds the socket and joins the group
+ * 
+ * @note Errors of prepare()/open()/send are thrown as CommunicationException like Socket.
+ *       Option setters return false if the kernel does not support the option.
+ */
+class COMMON_LIB_API DatagramSocket : public NonCopyable
+                                    , public Factory<DatagramSocket>
+{
+    friend class Factory<DatagramSocket>;
+
+public :
+    virtual ~DatagramSocket() = default;
+
+private :
+    /**
+     * @return std::shared_ptr<DatagramSocket> nullptr if socketType is not UDP or MULTICAST
+     */
+    static auto __create(SocketType::type socketType) noexcept -> std::shared_ptr<DatagramSocket>;
+
+public :
+    /**
+     * @param address Local address to bind for UDP ("0.0.0.0" for any), group address for MULTICAST
+     * @param port Local port. 0 binds an ephemeral port (see get_port()).
+     */
+    virtual auto prepare(const std::string& address, const int32_t port) -> void = 0;
+    virtual auto open() -> void = 0;
+    virtual auto close() -> void = 0;
+
+    virtual auto get_port() const -> int32_t = 0;
+    virtual auto get_native_handle() const -> int32_t = 0;
+
+    /**
+     * @brief Sets the destination of send(), send_batch() and send_segmented().
+     */
+    virtual auto set_destination(const std::string& address, const int32_t port) -> void = 0;
+
+    /**
+     * @brief Sets SO_RCVBUF (SO_RCVBUFFORCE if permitted) to absorb bursts.
+     */
+    virtual auto set_receive_buffer(const size_t size) -> bool = 0;
+
+    /**
+     * @brief Enables SO_TIMESTAMPNS so that DatagramBatch::timestamp() reports the kernel receive time.
+     */
+    virtual auto set_timestamp(const bool enable) -> bool = 0;
+
+    /**
+     * @brief Enables UDP_GRO. Consecutive datagrams of a flow may be received as one buffer
+     *        of segment_size() sized segments.
+     */
+    virtual auto set_gro(const bool enable) -> bool = 0;
+
+    /**
+     * @brief Sets the interface address used to join and send to the multicast group.
+     */
+    virtual auto set_multicast_interface(const std::string& address) -> bool = 0;
+    virtual auto set_multicast_loop(const bool enable) -> bool = 0;
+    virtual auto set_multicast_ttl(const uint8_t ttl) -> bool = 0;
+
+    /**
+     * @brief Receives up to batch.capacity() datagrams with one recvmmsg() call.
+     * 
+     * @param millisecond Maximum time to wait for the first datagram. 0 does not wait.
+     * @return size_t Number of received datagrams (also batch.size())
+     */
+    virtual auto recv_batch(DatagramBatch& batch, const uint32_t millisecond) -> size_t = 0;
+
+    virtual auto send(const void* buffer, const size_t size) -> void = 0;
+
+    /**
+     * @brief Sends each iovec as one datagram with sendmmsg() calls.
+     * 
+     * @return size_t Number of datagrams sent
+     */
+    virtual auto send_batch(const iovec* datagrams, const size_t count) -> size_t = 0;
+
+    /**
+     * @brief Sends buffer as datagrams of segmentSize bytes with GSO sends (UDP_SEGMENT).
+     * 
+     * Buffers over the GSO limits (64 segments, 64KiB) take several sends. Falls back to send_batch()
+     * if the kernel or the device does not support GSO.
+     * 
+     * @throw CommunicationException If segmentSize is 0 or sending fails
+     */
+    virtual auto send_segmented(const void* buffer, const size_t size, const uint16_t segmentSize) -> void = 0;
+};
+} // namespace common
+
+#endif
@@ -27,14 +27,15 @@ SOFTWARE.
 #include "CommonHeader.hpp"
 
 #include "common/NonCopyable.hpp"
+#include "common/container/ConcurrentHashMap.hpp"
+#include "common/container/ObjectPool.hpp"
 #include "common/thread/TaskExecutor.hpp"
 
+#include <memory_resource>
 #include <string>
 #include <vector>
-#include <unordered_map>
 #include <stdint.h>
 #include <atomic>
-#include <shared_mutex>
 
 namespace common
 {
@@ -53,24 +54,25 @@ public :
         std::atomic<bool> _active{true};
 
         HandlerInfo(SubID subId, Handler handler)
-            : _subId(subId), _handler(handler) {}
+            : _subId(subId), _handler(std::move(handler)) {}
     };
 
-    using TopicData = std::vector<std::shared_ptr<HandlerInfo>>;
+    using TopicData = std::pmr::vector<std::shared_ptr<HandlerInfo>>;
 
 private :
+    std::pmr::memory_resource* _resource;
     std::shared_ptr<common::TaskExecutor> _executor;
     std::vector<std::shared_ptr<HandlerInfo>> _handlers;
 
-    std::shared_mutex _topicLock;
-    std::unordered_map<Topic, std::shared_ptr<TopicData>> _topics;
-
-    std::mutex _subscriptionLock;
-    std::unordered_map<SubID, std::weak_ptr<HandlerInfo>> _subscriptions;
+    ConcurrentHashMap<Topic, std::shared_ptr<TopicData>> _topics;
+    ConcurrentHashMap<SubID, std::weak_ptr<HandlerInfo>> _subscriptions;
     std::atomic<uint8_t> _cleanupCount{0};
 
 public :
-    explicit EventBus(uint32_t threadCount = EVENT_THREADS);
+    /**
+     * @param resource Memory of subscriptions, topic snapshots and dispatched tasks, must outlive the bus
+     */
+    explicit EventBus(uint32_t threadCount = EVENT_THREADS, std::pmr::memory_resource* resource = PoolResource::get());
     ~EventBus();
 
 public :
@@ -0,0 +1,247 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#if defined(LINUX)
+
+#include "CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+#include "common/Factory.hpp"
+#include "common/communication/Socket.hpp"
+
+#include <functional>
+#include <memory>
+#include <stdint.h>
+#include <string>
+
+namespace common
+{
+/**
+ * @brief Non-owning view of a frame's bytes
+ * 
+ * Frames given by FramedStream point into its receive buffer and are valid
+ * only during the handler call.
+ */
+class COMMON_LIB_API Frame
+{
+private :
+    const uint8_t* _data = nullptr;
+    size_t _size = 0;
+
+public :
+    Frame() = default;
+    Frame(const uint8_t* data, const size_t size)
+        : _data(data), _size(size) {}
+
+public :
+    auto data() const noexcept -> const uint8_t* { return _data; }
+    auto size() const noexcept -> size_t { return _size; }
+    auto empty() const noexcept -> bool { return _size == 0; }
+    auto begin() const noexcept -> const uint8_t* { return _data; }
+    auto end() const noexcept -> const uint8_t* { return _data + _size; }
+    auto to_string() const -> std::string { return std::string(reinterpret_cast<const char*>(_data), _size); }
+};
+
+/**
+ * @brief Splits a byte stream into frames and builds the framing of outgoing payloads
+ */
+class COMMON_LIB_API FrameCodec : public NonCopyable
+{
+public :
+    static constexpr size_t MAX_HEADER_SIZE = 8;
+
+public :
+    virtual ~FrameCodec() = default;
+
+public :
+    /**
+     * @brief Finds the first complete frame in data.
+     * 
+     * @param frame Set to the payload of the frame (header and trailer excluded)
+     * @return size_t Number of bytes the frame occupies in data, 0 if the frame is not complete yet
+     * @throw CommunicationException If the frame exceeds maxFrameSize
+     */
+    virtual auto decode(const uint8_t* data, const size_t size, const size_t maxFrameSize, Frame& frame) const -> size_t = 0;
+
+    /**
+     * @brief Writes the header for a payload of size bytes.
+     * 
+     * @param header Output of at least MAX_HEADER_SIZE bytes
+     * @return size_t Size of the header
+     */
+    virtual auto encode_header(const size_t size, uint8_t* header) const noexcept -> size_t = 0;
+
+    /**
+     * @brief Gets the bytes written after each payload.
+     */
+    virtual auto get_trailer() const noexcept -> Frame = 0;
+};
+
+/**
+ * @brief Frames prefixed by their payload length in big-endian
+ */
+class COMMON_LIB_API LengthPrefixCodec final : public FrameCodec
+                                             , public Factory<LengthPrefixCodec>
+{
+    friend class Factory<LengthPrefixCodec>;
+
+private :
+    const uint8_t _headerSize;
+
+public :
+    explicit LengthPrefixCodec(const uint8_t headerSize) noexcept
+        : _headerSize(headerSize) {}
+
+private :
+    /**
+     * @param headerSize Size of the length field : 1, 2, 4 or 8 bytes
+     */
+    static auto __create(uint8_t headerSize = 4) noexcept -> std::shared_ptr<LengthPrefixCodec>;
+
+public :
+    auto decode(const uint8_t* data, const size_t size, const size_t maxFrameSize, Frame& frame) const -> size_t override;
+    auto encode_header(const size_t size, uint8_t* header) const noexcept -> size_t override;
+    auto get_trailer() const noexcept -> Frame override { return Frame(); }
+};
+
+/**
+ * @brief Frames terminated by a delimiter (e.g. "\n" or "\r\n")
+ */
+class COMMON_LIB_API DelimiterCodec final : public FrameCodec
+                                          , public Factory<DelimiterCodec>
+{
+    friend class Factory<DelimiterCodec>;
+
+private :
+    const std::string _delimiter;
+
+public :
+    explicit DelimiterCodec(const std::string& delimiter) noexcept
+        : _delimiter(delimiter) {}
+
+private :
+    static auto __create(std::string delimiter = "\n") noexcept -> std::shared_ptr<DelimiterCodec>;
+
+public :
+    auto decode(const uint8_t* data, const size_t size, const size_t maxFrameSize, Frame& frame) const -> size_t override;
+    auto encode_header(const size_t, uint8_t*) const noexcept -> size_t override { return 0; }
+    auto get_trailer() const noexcept -> Frame override
+    {
+        return Frame(reinterpret_cast<const uint8_t*>(_delimiter.data()), _delimiter.size());
+    }
+};
+
+/**
+ * @brief Thread-safe pool of fixed-size buffers
+ * 
+ * Buffers return to the pool when the last reference is released,
+ * so streams created per connection do not allocate their buffers every time.
+ */
+class COMMON_LIB_API BufferPool : public NonCopyable
+                                , public Factory<BufferPool>
+{
+    friend class Factory<BufferPool>;
+
+public :
+    virtual ~BufferPool() = default;
+
+private :
+    /**
+     * @param blockSize Size of each buffer
+     * @param capacity Maximum number of idle buffers kept in the pool
+     */
+    static auto __create(size_t blockSize = 64 * 1024, size_t capacity = 16) noexcept -> std::shared_ptr<BufferPool>;
+
+public :
+    /**
+     * @brief Takes a buffer of get_block_size() bytes from the pool, allocating one if the pool is empty.
+     */
+    virtual auto acquire() -> std::shared_ptr<uint8_t> = 0;
+    virtual auto get_block_size() const noexcept -> size_t = 0;
+    virtual auto get_available() const noexcept -> size_t = 0;
+};
+
+/**
+ * @brief Framed message stream over a connected Socket
+ * 
+ * Receive: Reads from the socket into a pooled buffer and hands complete frames to the handler
+ *          as views into that buffer. Unconsumed bytes are moved to the front only when the
+ *          buffer end is reached, so frames are never copied or allocated per message.
+ *          The largest frame (with its framing) must fit in one pool buffer.
+ * 
+ * Send: Small frames are coalesced into a pooled write buffer and sent in one syscall on flush()
+ *       or when the buffer is full. Large payloads are sent with the pending batch in a single
+ *       sendv() without being copied. TCP_NODELAY is enabled since batching is done here.
+ * 
+ * @warning Not thread-safe. Use one reader thread and one writer thread at most.
+ */
+class COMMON_LIB_API FramedStream : public NonCopyable
+                                  , public Factory<FramedStream>
+{
+    friend class Factory<FramedStream>;
+
+public :
+    using Handler = std::function<void(const Frame& frame)>;
+
+public :
+    virtual ~FramedStream() = default;
+
+private :
+    /**
+     * @param pool Pool for the receive and write buffers. A private pool is used if nullptr.
+     */
+    static auto __create(std::shared_ptr<Socket> socket,
+                         std::shared_ptr<FrameCodec> codec,
+                         std::shared_ptr<BufferPool> pool = nullptr) noexcept -> std::shared_ptr<FramedStream>;
+
+public :
+    /**
+     * @brief Calls handler for every buffered frame, reading from the socket until at least one frame is complete.
+     * 
+     * @return size_t Number of frames handled, 0 if a non-blocking socket has no complete frame yet
+     * @throw CommunicationException If the socket is closed, fails or a frame is larger than the buffer
+     */
+    virtual auto read(const Handler& handler) -> size_t = 0;
+
+    /**
+     * @brief Queues a frame. It is sent on flush(), when the write buffer is full or immediately if large.
+     * 
+     * @throw CommunicationException If sending fails
+     */
+    virtual auto write(const void* data, const size_t size) -> void = 0;
+
+    /**
+     * @brief Sends all queued frames.
+     */
+    virtual auto flush() -> void = 0;
+
+    /**
+     * @brief Gets the number of bytes queued and not sent yet.
+     */
+    virtual auto get_buffered() const noexcept -> size_t = 0;
+};
+} // namespace common
+
+#endif
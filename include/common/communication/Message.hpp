@@ -29,8 +29,13 @@ SOFTWARE.
 #include "common/NonCopyable.hpp"
 #include "common/Factory.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <optional>
 #include <string>
+#include <thread>
 
+#include <cerrno>
 #include <sys/ipc.h>
 #include <sys/msg.h>
 
@@ -74,19 +79,78 @@ public :
     auto recv() noexcept -> DataType
     {
         MessageType message;
-        const auto recvSize = msgrcv(_id, &message, sizeof(message._data), 1, 0);
-        if(recvSize == sizeof(message._data))
+        if(recv(message, 0)) { return take(message); }
+        return DataType();
+    }
+
+    /**
+     * @brief Receives a message without blocking
+     * 
+     * @return std::optional<DataType> Empty if no message is queued or on error
+     */
+    auto try_recv() noexcept -> std::optional<DataType>
+    {
+        MessageType message;
+        if(!recv(message, IPC_NOWAIT)) { return std::nullopt; }
+        return take(message);
+    }
+
+    /**
+     * @brief Receives a message, waiting at most timeout
+     * 
+     * msgrcv has no timeout, so the queue is polled with IPC_NOWAIT and a sleep growing up to 1 ms.
+     * 
+     * @return std::optional<DataType> Empty if nothing arrived in time or on error
+     */
+    auto recv_for(const std::chrono::microseconds timeout) noexcept -> std::optional<DataType>
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        std::chrono::microseconds backoff(10);
+        MessageType message;
+        while(!recv(message, IPC_NOWAIT))
         {
-            if constexpr (std::is_move_constructible_v<DataType>)
-            {
-                return std::move(message._data);
-            }
-            else
-            {
-                return message._data;
-            }            
+            if(errno != ENOMSG && errno != EINTR) { return std::nullopt; }
+            const auto now = std::chrono::steady_clock::now();
+            if(now >= deadline) { return std::nullopt; }
+            std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(backoff, deadline - now));
+            backoff = std::min(backoff * 2, std::chrono::microseconds(1000));
         }
-        return DataType();
+        return take(message);
+    }
+
+    /**
+     * @brief Blocks for the first message, then drains what is already queued
+     * 
+     * @param buffer Destination of the received messages
+     * @param size Maximum number of messages to receive
+     * @return size_t Number of messages stored in buffer, 0 on error
+     */
+    auto recv_batch(DataType* buffer, const size_t size) noexcept -> size_t
+    {
+        MessageType message;
+        size_t count = 0;
+        while(count < size && recv(message, count == 0 ? 0 : IPC_NOWAIT))
+        {
+            buffer[count++] = take(message);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Sends messages in order, blocking while the queue is full
+     * 
+     * @return size_t Number of messages sent, less than size if msgsnd failed
+     */
+    auto send_batch(const DataType* data, const size_t size) noexcept -> size_t
+    {
+        MessageType message;
+        message._type = 1;
+        for(size_t i = 0; i < size; ++i)
+        {
+            message._data = data[i];
+            if(!send(message)) { return i; }
+        }
+        return size;
     }
 
     auto close() noexcept -> bool
@@ -100,6 +164,23 @@ private :
         return msgsnd(_id, &message, sizeof(message._data), 0) == 0 ? true : false;
     }
 
+    auto recv(MessageType& message, const int32_t flag) noexcept -> bool
+    {
+        return msgrcv(_id, &message, sizeof(message._data), 1, flag) == static_cast<ssize_t>(sizeof(message._data));
+    }
+
+    static auto take(MessageType& message) noexcept -> DataType
+    {
+        if constexpr (std::is_move_constructible_v<DataType>)
+        {
+            return std::move(message._data);
+        }
+        else
+        {
+            return message._data;
+        }
+    }
+
 private :
     static auto __create(const std::string& filePath, const int32_t projId) -> std::shared_ptr<Message>
     {
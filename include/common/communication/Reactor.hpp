@@ -0,0 +1,214 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#if defined(LINUX)
+
+#include "CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+#include "common/Factory.hpp"
+#include "common/thread/TaskExecutor.hpp"
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <stdint.h>
+#include <sys/types.h>
+
+namespace common
+{
+class COMMON_LIB_API ReactorEvent
+{
+public :
+    enum type : uint32_t
+    {
+        READ = 0x01,
+        WRITE = 0x02,
+        HANGUP = 0x04,
+        ERROR = 0x08,
+    };
+};
+
+/**
+ * @brief Edge-triggered epoll event loop
+ * 
+ * Reactor waits on an epoll instance in its own thread and dispatches readiness
+ * notifications of registered file descriptors to their handlers.
+ * Every registration is armed with EPOLLET | EPOLLONESHOT, so a descriptor is never
+ * handled by two threads at the same time. The descriptor is re-armed after its handler
+ * returns, which means a handler has to drain the descriptor until EAGAIN.
+ * 
+ * If a TaskExecutor is given, handlers are executed by its worker threads.
+ * Otherwise handlers are executed by the reactor thread itself.
+ */
+class COMMON_LIB_API Reactor : public NonCopyable
+                             , public Factory<Reactor>
+{
+    friend class Factory<Reactor>;
+
+public :
+    using Handler = std::function<void(const uint32_t events)>;
+
+public :
+    virtual ~Reactor() = default;
+
+private :
+    /**
+     * @brief Creates a reactor
+     * 
+     * @param executor Executor which runs the handlers. nullptr runs the handlers in the reactor thread.
+     * @return std::shared_ptr<Reactor> Shared pointer to a new Reactor instance, nullptr if epoll cannot be created
+     */
+    static auto __create(std::shared_ptr<TaskExecutor> executor = nullptr) noexcept -> std::shared_ptr<Reactor>;
+
+public :
+    /**
+     * @brief Starts the event loop in a new thread.
+     * 
+     * @return std::future which is set when the event loop is finished.
+     * @throw common::AlreadyRunningException if run() is called multiple times.
+     */
+    virtual auto run() -> std::future<void> = 0;
+
+    /**
+     * @brief Stops the event loop and wakes up the reactor thread.
+     */
+    virtual auto stop() noexcept -> void = 0;
+
+    /**
+     * @brief Registers a file descriptor.
+     * 
+     * The descriptor should be non-blocking since handlers are expected to read or write until EAGAIN.
+     * 
+     * @param fd File descriptor to watch
+     * @param events Combination of ReactorEvent::READ and ReactorEvent::WRITE
+     * @param handler Handler called with the combination of ReactorEvent flags which occurred
+     * @return bool True if the descriptor is registered, false otherwise
+     */
+    virtual auto add(const int32_t fd, const uint32_t events, Handler handler) noexcept -> bool = 0;
+
+    /**
+     * @brief Changes the events of a registered file descriptor and re-arms it.
+     * 
+     * @return bool True if the descriptor is modified, false otherwise
+     */
+    virtual auto modify(const int32_t fd, const uint32_t events) noexcept -> bool = 0;
+
+    /**
+     * @brief Unregisters a file descriptor.
+     * 
+     * A handler which is already dispatched may still be running after remove() returns.
+     */
+    virtual auto remove(const int32_t fd) noexcept -> void = 0;
+};
+
+/**
+ * @brief Non-blocking TCP connection accepted by StreamServer
+ */
+class COMMON_LIB_API Connection : public NonCopyable
+{
+public :
+    virtual ~Connection() = default;
+
+public :
+    virtual auto get_fd() const noexcept -> int32_t = 0;
+    virtual auto is_open() const noexcept -> bool = 0;
+
+    /**
+     * @brief Reads available data without blocking.
+     * 
+     * @return size_t Number of bytes read. 0 if no more data is available or the peer closed the connection.
+     */
+    virtual auto read(void* buffer, const size_t size) noexcept -> size_t = 0;
+
+    /**
+     * @brief Sends data without blocking.
+     * 
+     * Data which cannot be written immediately is kept in the connection and flushed
+     * when the socket becomes writable again.
+     * 
+     * @return bool False if the connection is closed, true otherwise
+     */
+    virtual auto send(const void* buffer, const size_t size) noexcept -> bool = 0;
+
+    virtual auto close() noexcept -> void = 0;
+};
+
+/**
+ * @brief Multi-connection TCP server driven by Reactor
+ * 
+ * The listening socket is registered to the reactor and accepts connections continuously.
+ * Every accepted connection is registered to the same reactor and its readiness is
+ * dispatched to the handlers given by on_connect(), on_readable() and on_disconnect().
+ * 
+ * @note Handlers should be set before open().
+ */
+class COMMON_LIB_API StreamServer : public NonCopyable
+                                  , public Factory<StreamServer>
+{
+    friend class Factory<StreamServer>;
+
+public :
+    using ConnectionHandler = std::function<void(const std::shared_ptr<Connection>&)>;
+
+public :
+    virtual ~StreamServer() = default;
+
+private :
+    static auto __create(std::shared_ptr<Reactor> reactor) noexcept -> std::shared_ptr<StreamServer>;
+
+public :
+    virtual auto on_connect(ConnectionHandler handler) -> void = 0;
+    virtual auto on_readable(ConnectionHandler handler) -> void = 0;
+    virtual auto on_disconnect(ConnectionHandler handler) -> void = 0;
+
+    /**
+     * @brief Sets the address and the port to listen. Port 0 selects an ephemeral port.
+     */
+    virtual auto prepare(const std::string& address, const int32_t port) -> void = 0;
+
+    /**
+     * @brief Binds, listens and registers the listening socket to the reactor.
+     * 
+     * @throw common::CommunicationException if the socket cannot be opened.
+     */
+    virtual auto open() -> void = 0;
+
+    /**
+     * @brief Closes the listening socket and all connections.
+     */
+    virtual auto close() noexcept -> void = 0;
+
+    /**
+     * @brief Gets the port actually bound. Useful when prepared with port 0.
+     */
+    virtual auto get_port() const noexcept -> int32_t = 0;
+
+    virtual auto get_connection_count() const noexcept -> size_t = 0;
+};
+} // namespace common
+
+#endif
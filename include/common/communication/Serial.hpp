@@ -28,6 +28,7 @@ SOFTWARE.
 #include "common/NonCopyable.hpp"
 #include "common/Factory.hpp"
 
+#include <array>
 #include <string>
 
 #if defined(WINDOWS)
@@ -53,90 +54,132 @@ public :
         _38400,
         _57600,
         _115200,
+        _50,
+        _75,
+        _110,
+        _134,
+        _150,
+        _200,
+        _300,
+        _600,
+        _1200,
+        _1800,
+        _2400,
+        _4800,
+        _230400,
+        _460800,
+        _500000,
+        _576000,
+        _921600,
+        _1000000,
+        _1152000,
+        _1500000,
+        _2000000,
+        _2500000,
+        _3000000,
+        _3500000,
+        _4000000,
+        CUSTOM,   /* any other rate, set through termios2 / BOTHER on Linux */
     };
 
     type _value = _9600;
+    std::uint32_t _custom = 0;
+
+private :
+    static constexpr std::array<std::uint32_t, CUSTOM> RATES{
+        9600, 19200, 38400, 57600, 115200,
+        50, 75, 110, 134, 150, 200, 300, 600, 1200, 1800, 2400, 4800,
+        230400, 460800, 500000, 576000, 921600, 1000000, 1152000,
+        1500000, 2000000, 2500000, 3000000, 3500000, 4000000,
+    };
 
 public :
     Baudrate() = default;
     Baudrate(const type value) : _value(value) {};
-    Baudrate(const uint32_t value)
+    Baudrate(const std::uint32_t value)
     {
-        switch(value)
+        if(value == 0) { return; }
+        for(size_t i = 0; i < RATES.size(); ++i)
         {
-            case 9600:
-                _value = _9600;
-                break;
-            case 19200:
-                _value = _19200;
-                break;
-            case 38400:
-                _value = _38400;
-                break;
-            case 57600:
-                _value = _57600;
-                break;
-            case 115200:
-                _value = _115200;
-                break;
-            default:
-                _value = _9600;
-                break;
+            if(RATES[i] == value)
+            {
+                _value = static_cast<type>(i);
+                return;
+            }
         }
+        _value = CUSTOM;
+        _custom = value;
     }
 
-    auto operator=(const type value) -> Baudrate
+    auto operator=(const type value) -> Baudrate&
     {
-        return Baudrate(value);
+        return *this = Baudrate(value);
     }
 
-    auto operator=(const uint32_t value) -> Baudrate
+    auto operator=(const std::uint32_t value) -> Baudrate&
     {
-        return Baudrate(value);
+        return *this = Baudrate(value);
     }
 
-    auto uint32_t() const
+    inline auto is_custom() const -> bool { return _value == CUSTOM; }
+
+    auto uint32_t() const -> std::uint32_t
     {
-        switch(_value)
-        {
-            case _9600 : return 9600;
-            case _19200 : return 19200;
-            case _38400 : return 38400;
-            case _57600 : return 57600;
-            case _115200 : return 115200;
-            default : return 0;
-        }
+        if(_value == CUSTOM) { return _custom; }
+        return _value < RATES.size() ? RATES[_value] : 0;
     }
 
 #if defined(WINDOWS)
     auto to_baudrate() const -> int32_t
     {
-        switch (_value)
-        {
-            case Baudrate::_9600: return CBR_9600;
-            case Baudrate::_19200: return CBR_19200;
-            case Baudrate::_38400: return CBR_38400;
-            case Baudrate::_57600: return CBR_57600;
-            case Baudrate::_115200: return CBR_115200;
-            default: return CBR_9600;
-        };
+        // CBR_xxx constants are the rate itself and DCB accepts any value the driver supports.
+        const std::uint32_t rate = uint32_t();
+        return rate == 0 ? CBR_9600 : static_cast<int32_t>(rate);
     }
 #elif defined(LINUX)
+    /**
+     * @brief Converts to the termios speed constant
+     * 
+     * @return speed_t Bxxx constant, B38400 for CUSTOM as the rate is applied separately via termios2
+     */
     auto to_speed() const -> speed_t
     {
-        switch (_value)
-        {
-            case Baudrate::_9600: return B9600;
-            case Baudrate::_19200: return B19200;
-            case Baudrate::_38400: return B38400;
-            case Baudrate::_57600: return B57600;
-            case Baudrate::_115200: return B115200;
-            default: return B9600;
-        }
+        static constexpr std::array<speed_t, CUSTOM> SPEEDS{
+            B9600, B19200, B38400, B57600, B115200,
+            B50, B75, B110, B134, B150, B200, B300, B600, B1200, B1800, B2400, B4800,
+            B230400, B460800, B500000, B576000, B921600, B1000000, B1152000,
+            B1500000, B2000000, B2500000, B3000000, B3500000, B4000000,
+        };
+        if(_value == CUSTOM) { return B38400; }
+        return _value < SPEEDS.size() ? SPEEDS[_value] : B9600;
     }
 #endif
 };
 
+struct FlowControl
+{
+    enum type : uint8_t
+    {
+        NONE = 0,
+        HARDWARE,   /* RTS/CTS */
+        SOFTWARE,   /* XON/XOFF */
+    };
+};
+
+/**
+ * @brief Line settings applied by Serial::open on top of 8N1
+ * 
+ * The defaults keep the behavior of the plain open(): driver line discipline, non-blocking reads.
+ */
+struct SerialOptions
+{
+    bool _raw = false;                                  /* cfmakeraw(): no echo, no canonical mode, no CR/NL mapping */
+    int16_t _vmin = -1;                                 /* VMIN, -1 keeps the driver value */
+    int16_t _vtime = -1;                                /* VTIME in 1/10 s, -1 keeps the driver value */
+    FlowControl::type _flowControl = FlowControl::NONE;
+    bool _lowLatency = false;                           /* ASYNC_LOW_LATENCY, skips the UART driver's receive batching */
+};
+
 struct EscapeSequence
 {
     enum type : uint8_t
@@ -177,7 +220,7 @@ public :
      * - Linux: Uses open() with O_RDWR/O_RDONLY/O_WRONLY flags, configures termios for 8N1
      * 
      * @param port The serial port identifier (e.g., "COM1" on Windows, "/dev/ttyUSB0" on Linux)
-     * @param baudrate Communication speed setting (9600, 19200, 38400, 57600, or 115200)
+     * @param baudrate Communication speed setting (standard rates up to 4000000, or a custom rate)
      * @param mode Access mode flags (SERIAL_READ | SERIAL_WRITE for full duplex)
      * @return bool True if connection established successfully, false otherwise
      * 
@@ -188,6 +231,28 @@ public :
                       const Baudrate baudrate,
                       const uint8_t mode) noexcept -> bool = 0;
 
+    /**
+     * @brief Opens a serial port connection with line settings
+     * 
+     * Same as open(port, baudrate, mode), additionally applying the given options.
+     * 
+     * Platform-specific behavior:
+     * - Windows: Only flow control is applied, the rest is handled by COMMTIMEOUTS
+     * - Linux: Rates without a Bxxx constant are set through termios2 / BOTHER.
+     *          Setting VMIN or VTIME clears O_NDELAY so that they take effect on read().
+     *          Low latency is best effort, a driver without TIOCSSERIAL only logs a warning.
+     * 
+     * @param port The serial port identifier
+     * @param baudrate Communication speed setting, any rate the driver accepts
+     * @param mode Access mode flags (SERIAL_READ | SERIAL_WRITE for full duplex)
+     * @param options Raw mode, VMIN/VTIME, flow control and low latency settings
+     * @return bool True if connection established successfully, false otherwise
+     */
+    virtual auto open(const std::string& port,
+                      const Baudrate baudrate,
+                      const uint8_t mode,
+                      const SerialOptions& options) noexcept -> bool = 0;
+
     /**
      * @brief Closes the serial port connection
      * 
@@ -210,15 +275,16 @@ public :
     /**
      * @brief Reads a line from the serial port
      * 
-     * Reads data from the serial port until a newline character is encountered or no more data is available.
+     * Reads data from the serial port until the escape sequence is encountered or no more data is available.
      * 
      * Platform-specific behavior:
-     * - Windows: Reads one character at a time until '\n' is found, with configured timeouts
-     * - Linux: Reads into buffer and accumulates until '\n' is found in the result string
+     * - Windows: Reads one character at a time until the escape sequence is found, with configured timeouts
+     * - Linux: Reads in chunks. Bytes received after the escape sequence are kept for the next call.
      * 
-     * @return std::string The received line data (may include '\r' but excludes '\n')
+     * @return std::string The received line data excluding the escape sequence
      * 
-     * @note Returns accumulated data even if newline is not found (partial reads).
+     * @note Returns accumulated data even if the escape sequence is not found (partial reads).
+     *       For binary protocols or high baudrates use SerialReader instead.
      *       Empty string indicates read failure or closed port.
      *       Timeout behavior is platform-dependent (50ms base + 10ms per byte on Windows).
      */
@@ -247,6 +313,17 @@ public :
      */
     virtual auto write(const char* buffer, size_t size) noexcept -> bool = 0;
 
+#if defined(LINUX)
+    /**
+     * @brief Gets the file descriptor of the opened port
+     * 
+     * Used to drive the port with AsyncIo or any other event loop.
+     * 
+     * @return int32_t File descriptor, -1 if the port is not opened
+     */
+    virtual auto get_native_handle() const noexcept -> int32_t = 0;
+#endif
+
 public :
     /**
      * @brief Factory method for creating Serial instances
@@ -303,6 +380,9 @@ public :
     virtual auto Wrapper_Close(int32_t fd) -> void;
     virtual auto Wrapper_Read(int32_t fd, char* buffer, size_t size) -> ssize_t;
     virtual auto Wrapper_Write(int32_t fd, const char* buffer, size_t size) -> bool;
+    virtual auto Wrapper_SetCustomBaudrate(int32_t fd, uint32_t baudrate) -> bool;
+    virtual auto Wrapper_GetBaudrate(int32_t fd) -> uint32_t;
+    virtual auto Wrapper_SetLowLatency(int32_t fd, bool enable) -> bool;
 #endif
 };
 
@@ -315,7 +395,8 @@ private :
 #if defined(WINDOWS)
     HANDLE _handle;
 #elif defined(LINUX)
-    int32_t _fd;
+    int32_t _fd = -1;
+    std::string _pending; // received after the last line
 #endif
 
 public :
@@ -328,6 +409,10 @@ public :
     auto open(const std::string& port,
               const Baudrate baudRate,
               const uint8_t mode) noexcept -> bool override;
+    auto open(const std::string& port,
+              const Baudrate baudRate,
+              const uint8_t mode,
+              const SerialOptions& options) noexcept -> bool override;
     auto close() noexcept -> void override;
     inline auto is_open() noexcept -> bool override { return _isOpen; }
     auto read(char* buffer, size_t size) noexcept -> bool override;
@@ -337,6 +422,9 @@ public :
     auto readline(EscapeSequence::type escapeSequence = EscapeSequence::LINE_FEED) noexcept -> std::string override;
 #endif
     auto write(const char* buffer, size_t size) noexcept -> bool override;
+#if defined(LINUX)
+    inline auto get_native_handle() const noexcept -> int32_t override { return _isOpen ? _fd : -1; }
+#endif
 };
 } // namespace detail
 } // namespace common
@@ -0,0 +1,200 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#if defined(LINUX)
+
+#include "CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+#include "common/Factory.hpp"
+#include "common/communication/Event.hpp"
+#include "common/communication/Framing.hpp"
+#include "common/communication/Serial.hpp"
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace common
+{
+/**
+ * @brief Incremental frame parser for byte streams from a serial port
+ * 
+ * Bytes are fed in arbitrary chunks. A frame split across chunks is kept in the parser
+ * and completed by the next feed(). Frames given to the handler are valid only during the call.
+ */
+class COMMON_LIB_API SerialParser : public NonCopyable
+{
+public :
+    using Handler = std::function<void(const Frame& frame)>;
+
+public :
+    virtual ~SerialParser() = default;
+
+public :
+    virtual auto feed(const uint8_t* data, const size_t size, const Handler& handler) -> void = 0;
+
+    /**
+     * @brief Drops a partially received frame (e.g. after the port is reopened).
+     */
+    virtual auto reset() noexcept -> void = 0;
+
+    /**
+     * @brief Gets the number of frames dropped because they exceeded the maximum size or were malformed.
+     */
+    virtual auto get_errors() const noexcept -> size_t = 0;
+};
+
+/**
+ * @brief Frames terminated by a delimiter. The delimiter is not included in the frame.
+ * 
+ * Delimiters are searched with memchr(), which is vectorized by the C library.
+ */
+class COMMON_LIB_API DelimiterParser : public SerialParser
+                                     , public Factory<DelimiterParser>
+{
+    friend class Factory<DelimiterParser>;
+
+private :
+    static auto __create(std::string delimiter = "\n", size_t maxFrameSize = 4096) noexcept -> std::shared_ptr<DelimiterParser>;
+};
+
+/**
+ * @brief Frames prefixed by their payload length in big-endian
+ */
+class COMMON_LIB_API LengthPrefixParser : public SerialParser
+                                        , public Factory<LengthPrefixParser>
+{
+    friend class Factory<LengthPrefixParser>;
+
+private :
+    /**
+     * @param headerSize Size of the length field : 1, 2 or 4 bytes
+     */
+    static auto __create(uint8_t headerSize = 2, size_t maxFrameSize = 4096) noexcept -> std::shared_ptr<LengthPrefixParser>;
+};
+
+/**
+ * @brief SLIP (RFC 1055) frames
+ */
+class COMMON_LIB_API SlipParser : public SerialParser
+                                , public Factory<SlipParser>
+{
+    friend class Factory<SlipParser>;
+
+public :
+    static constexpr uint8_t END = 0xC0;
+    static constexpr uint8_t ESC = 0xDB;
+    static constexpr uint8_t ESC_END = 0xDC;
+    static constexpr uint8_t ESC_ESC = 0xDD;
+
+private :
+    static auto __create(size_t maxFrameSize = 4096) noexcept -> std::shared_ptr<SlipParser>;
+
+public :
+    /**
+     * @brief Appends the SLIP encoded frame of data to out.
+     */
+    static auto encode(const uint8_t* data, const size_t size, std::vector<uint8_t>& out) -> void;
+};
+
+/**
+ * @brief COBS (Consistent Overhead Byte Stuffing) frames delimited by 0x00
+ */
+class COMMON_LIB_API CobsParser : public SerialParser
+                                , public Factory<CobsParser>
+{
+    friend class Factory<CobsParser>;
+
+private :
+    static auto __create(size_t maxFrameSize = 4096) noexcept -> std::shared_ptr<CobsParser>;
+
+public :
+    /**
+     * @brief Appends the COBS encoded frame of data with its 0x00 delimiter to out.
+     */
+    static auto encode(const uint8_t* data, const size_t size, std::vector<uint8_t>& out) -> void;
+};
+
+/**
+ * @brief Asynchronous serial port reader
+ * 
+ * A reader thread waits on the port with epoll and reads everything available into a lock-free
+ * ring buffer, so the port is drained even while frames are being handled.
+ * A dispatch thread runs the parser on the ring and delivers frames to the handler
+ * given to on_frame() and/or publishes them to an EventBus topic.
+ * 
+ * Bytes arriving while the ring is full are dropped and counted by get_dropped().
+ * The port is non-blocking while the reader exists, its flags are restored when the reader is destroyed.
+ */
+class COMMON_LIB_API SerialReader : public NonCopyable
+                                  , public Factory<SerialReader>
+{
+    friend class Factory<SerialReader>;
+
+public :
+    virtual ~SerialReader() = default;
+
+private :
+    /**
+     * @param serial Opened serial port
+     * @param ringSize Size of the ring buffer between the reader and the parser
+     * @return std::shared_ptr<SerialReader> nullptr if the port is not opened
+     */
+    static auto __create(std::shared_ptr<Serial> serial,
+                         std::shared_ptr<SerialParser> parser,
+                         size_t ringSize = 64 * 1024) noexcept -> std::shared_ptr<SerialReader>;
+
+public :
+    /**
+     * @brief Sets the frame handler. Called from the dispatch thread. Set before run().
+     */
+    virtual auto on_frame(SerialParser::Handler handler) -> void = 0;
+
+    /**
+     * @brief Publishes every frame to the topic of the bus. Set before run().
+     */
+    virtual auto publish_to(std::shared_ptr<EventBus> bus, const std::string& topic) -> void = 0;
+
+    /**
+     * @brief Starts the reader and dispatch threads.
+     * 
+     * @return std::future<void> Ready when both threads finished after stop()
+     * @throw common::AlreadyRunningException if run() is called multiple times.
+     */
+    virtual auto run() -> std::future<void> = 0;
+    virtual auto stop() noexcept -> void = 0;
+
+    /**
+     * @brief Gets the number of bytes dropped because the ring buffer was full.
+     */
+    virtual auto get_dropped() const noexcept -> size_t = 0;
+};
+} // namespace common
+
+#endif
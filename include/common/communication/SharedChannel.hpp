@@ -0,0 +1,319 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#if defined(LINUX)
+
+#include "common/NonCopyable.hpp"
+#include "common/Factory.hpp"
+
+#include <atomic>
+#include <climits>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace common
+{
+class COMMON_LIB_API ChannelMode
+{
+public :
+    enum type : uint8_t
+    {
+        SPSC,   // single producer, single consumer
+        MPSC,   // any number of producers, single consumer
+    };
+};
+
+/**
+ * @brief Shared-memory channel with the send/recv shape of Message
+ * 
+ * DataType slots live in a ring mapped from POSIX shared memory, so send/recv copy
+ * straight into the mapping and only enter the kernel when a side has to sleep.
+ * The consumer parks on a futex when the ring is empty and producers wake it only while it is parked.
+ * Producers park the same way when the ring is full.
+ * 
+ * Every process calls create() with the same name and capacity, the first one initializes the ring.
+ * 
+ * @tparam DataType Trivially copyable type exchanged between processes
+ * @tparam Mode SPSC, or MPSC for several producer threads/processes
+ * 
+ * @note There is exactly one consumer in both modes.
+ */
+template <typename DataType, ChannelMode::type Mode = ChannelMode::SPSC>
+class SharedChannel : public NonCopyable, public Factory<SharedChannel<DataType, Mode>>
+{
+    friend class Factory<SharedChannel<DataType, Mode>>;
+    static_assert(std::is_trivially_copyable_v<DataType>, "DataType is copied across processes.");
+
+private :
+    static constexpr uint32_t READY = 0x5348434E;
+    static constexpr uint32_t SPIN_COUNT = 256;
+
+    struct Header
+    {
+        std::atomic<uint32_t> _state;   // 0 : not initialized, 1 : initializing, READY
+        uint32_t _capacity;
+        uint32_t _slotSize;
+        alignas(64) std::atomic<uint64_t> _head;
+        alignas(64) std::atomic<uint64_t> _tail;
+        alignas(64) std::atomic<uint32_t> _consumerParked;
+        alignas(64) std::atomic<uint32_t> _producerParked;
+    };
+
+    struct Slot
+    {
+        std::atomic<uint64_t> _sequence; // MPSC only, position + 1 once published
+        DataType _data;
+    };
+
+    static constexpr size_t SLOT_OFFSET = (sizeof(Header) + 63) & ~size_t(63);
+
+    std::string _name;
+    int32_t _fd;
+    void* _mapping;
+    size_t _mappingSize;
+    Header* _header;
+    Slot* _slots;
+    uint64_t _mask;
+
+public :
+    SharedChannel(const std::string& name, int32_t fd, void* mapping, size_t mappingSize)
+        : _name(name)
+        , _fd(fd)
+        , _mapping(mapping)
+        , _mappingSize(mappingSize)
+        , _header(static_cast<Header*>(mapping))
+        , _slots(reinterpret_cast<Slot*>(static_cast<uint8_t*>(mapping) + SLOT_OFFSET))
+        , _mask(_header->_capacity - 1) {}
+
+    ~SharedChannel() override
+    {
+        ::munmap(_mapping, _mappingSize);
+        ::close(_fd);
+    }
+
+public :
+    auto send(const DataType& data) noexcept -> bool
+    {
+        while(!try_send(data)) { wait(_header->_producerParked, [this](){ return writable(); }); }
+        return true;
+    }
+
+    auto try_send(const DataType& data) noexcept -> bool
+    {
+        if constexpr (Mode == ChannelMode::SPSC)
+        {
+            const uint64_t tail = _header->_tail.load(std::memory_order_relaxed);
+            if(tail - _header->_head.load(std::memory_order_acquire) > _mask) { return false; }
+            _slots[tail & _mask]._data = data;
+            _header->_tail.store(tail + 1, std::memory_order_release);
+        }
+        else
+        {
+            uint64_t tail = _header->_tail.load(std::memory_order_relaxed);
+            Slot* slot = nullptr;
+            while(true)
+            {
+                slot = &_slots[tail & _mask];
+                const int64_t diff = static_cast<int64_t>(slot->_sequence.load(std::memory_order_acquire) - tail);
+                if(diff == 0)
+                {
+                    if(_header->_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) { break; }
+                }
+                else if(diff < 0) { return false; }
+                else { tail = _header->_tail.load(std::memory_order_relaxed); }
+            }
+            slot->_data = data;
+            slot->_sequence.store(tail + 1, std::memory_order_release);
+        }
+        wake(_header->_consumerParked, 1);
+        return true;
+    }
+
+    auto recv() noexcept -> DataType
+    {
+        while(true)
+        {
+            if(auto data = try_recv()) { return *data; }
+            wait(_header->_consumerParked, [this](){ return readable(); });
+        }
+    }
+
+    auto try_recv() noexcept -> std::optional<DataType>
+    {
+        const uint64_t head = _header->_head.load(std::memory_order_relaxed);
+        Slot& slot = _slots[head & _mask];
+        if constexpr (Mode == ChannelMode::SPSC)
+        {
+            if(_header->_tail.load(std::memory_order_acquire) == head) { return std::nullopt; }
+        }
+        else
+        {
+            if(slot._sequence.load(std::memory_order_acquire) != head + 1) { return std::nullopt; }
+        }
+
+        std::optional<DataType> data(slot._data);
+        if constexpr (Mode == ChannelMode::MPSC)
+        {
+            slot._sequence.store(head + _mask + 1, std::memory_order_release);
+        }
+        _header->_head.store(head + 1, std::memory_order_release);
+        wake(_header->_producerParked, INT_MAX);
+        return data;
+    }
+
+    inline auto get_capacity() const noexcept -> size_t { return _mask + 1; }
+
+    /**
+     * @brief Removes the shared memory name, mappings stay valid until every process destroys its channel
+     */
+    auto close() noexcept -> bool
+    {
+        return ::shm_unlink(_name.c_str()) == 0 ? true : false;
+    }
+
+private :
+    auto readable() const noexcept -> bool
+    {
+        const uint64_t head = _header->_head.load(std::memory_order_relaxed);
+        if constexpr (Mode == ChannelMode::SPSC)
+        {
+            return _header->_tail.load(std::memory_order_acquire) != head;
+        }
+        else
+        {
+            return _slots[head & _mask]._sequence.load(std::memory_order_acquire) == head + 1;
+        }
+    }
+
+    auto writable() const noexcept -> bool
+    {
+        if constexpr (Mode == ChannelMode::SPSC)
+        {
+            return _header->_tail.load(std::memory_order_relaxed) - _header->_head.load(std::memory_order_acquire) <= _mask;
+        }
+        else
+        {
+            const uint64_t tail = _header->_tail.load(std::memory_order_relaxed);
+            return _slots[tail & _mask]._sequence.load(std::memory_order_acquire) == tail;
+        }
+    }
+
+    // Spins a little before parking; the flag is raised before the last check so a wake() cannot be missed.
+    template <typename Ready>
+    static auto wait(std::atomic<uint32_t>& parked, Ready&& ready) noexcept -> void
+    {
+        for(uint32_t i = 0; i < SPIN_COUNT; ++i)
+        {
+            if(ready()) { return; }
+            if((i & 0x3F) == 0x3F) { std::this_thread::yield(); }
+        }
+        parked.store(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(!ready())
+        {
+            ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&parked), FUTEX_WAIT, 1, nullptr, nullptr, 0);
+        }
+    }
+
+    static auto wake(std::atomic<uint32_t>& parked, int32_t count) noexcept -> void
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(parked.load(std::memory_order_relaxed) != 0 && parked.exchange(0) != 0)
+        {
+            ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&parked), FUTEX_WAKE, count, nullptr, nullptr, 0);
+        }
+    }
+
+private :
+    /**
+     * @param name Shared memory object name, a leading '/' is added if missing
+     * @param capacity Slots of the ring, rounded up to a power of 2
+     * @param permissions Of the shared memory object if this call creates it, owner only by default
+     * @return std::shared_ptr<SharedChannel> nullptr if the ring cannot be mapped or has another layout
+     */
+    static auto __create(const std::string& name, uint32_t capacity = 1024, mode_t permissions = 0600)
+        -> std::shared_ptr<SharedChannel>
+    {
+        if(capacity == 0 || capacity > (1U << 31)) { return nullptr; }
+        uint32_t rounded = 1;
+        while(rounded < capacity) { rounded <<= 1; }
+
+        const std::string shmName = (!name.empty() && name[0] == '/') ? name : "/" + name;
+        const size_t mappingSize = SLOT_OFFSET + sizeof(Slot) * rounded;
+
+        const int32_t fd = ::shm_open(shmName.c_str(), O_CREAT | O_RDWR, permissions);
+        if(fd < 0) { return nullptr; }
+
+        struct stat status;
+        if(::fstat(fd, &status) < 0 ||
+           (status.st_size == 0 && ::ftruncate(fd, mappingSize) < 0) ||
+           (status.st_size != 0 && static_cast<size_t>(status.st_size) != mappingSize))
+        {
+            ::close(fd);
+            return nullptr;
+        }
+
+        void* mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if(mapping == MAP_FAILED)
+        {
+            ::close(fd);
+            return nullptr;
+        }
+
+        // The fresh object is zero filled, so _state starts at 0 in every process.
+        auto* header = static_cast<Header*>(mapping);
+        uint32_t expected = 0;
+        if(header->_state.compare_exchange_strong(expected, 1))
+        {
+            header->_capacity = rounded;
+            header->_slotSize = sizeof(Slot);
+            auto* slots = reinterpret_cast<Slot*>(static_cast<uint8_t*>(mapping) + SLOT_OFFSET);
+            for(uint32_t i = 0; i < rounded; ++i) { slots[i]._sequence.store(i, std::memory_order_relaxed); }
+            header->_state.store(READY, std::memory_order_release);
+        }
+        while(header->_state.load(std::memory_order_acquire) != READY) { std::this_thread::yield(); }
+
+        if(header->_capacity != rounded || header->_slotSize != sizeof(Slot))
+        {
+            ::munmap(mapping, mappingSize);
+            ::close(fd);
+            return nullptr;
+        }
+        return std::make_shared<SharedChannel>(shmName, fd, mapping, mappingSize);
+    }
+};
+} // namespace common
+
+#endif
@@ -28,9 +28,15 @@ SOFTWARE.
 #include "common/NonCopyable.hpp"
 #include "common/Factory.hpp"
 
+#include <functional>
 #include <stdint.h>
 #include <string>
 #include <memory>
+#include <utility>
+
+#if defined(LINUX)
+#include <sys/uio.h>
+#endif
 
 namespace common
 {
@@ -41,6 +47,12 @@ public :
     {
         SERVER,
         CLIENT,
+        UDP,        // DatagramSocket only
+        MULTICAST,  // DatagramSocket only
+        UNIX_SERVER,
+        UNIX_CLIENT,
+        UNIX_SEQPACKET_SERVER,
+        UNIX_SEQPACKET_CLIENT,
     };
 };
 
@@ -48,13 +60,54 @@ class COMMON_LIB_API Socket : public NonCopyable
                             , public Factory<Socket>
 {
     friend class Factory<Socket>;
-    
+
+public :
+#if defined(LINUX)
+    /**
+     * @brief Called when the kernel no longer references a buffer given to send_zerocopy().
+     * 
+     * copied is true if the kernel fell back to copying (e.g. loopback or small buffer).
+     */
+    using ZeroCopyCompletion = std::function<void(const bool copied)>;
+
+    /**
+     * @brief Buffers smaller than this are copied since page pinning costs more than the copy.
+     */
+    static constexpr size_t ZEROCOPY_THRESHOLD = 10 * 1024;
+
+    /**
+     * @brief Maximum number of descriptors passed by one send_fds() call (SCM_MAX_FD)
+     */
+    static constexpr size_t MAX_FDS = 253;
+#endif
+
 public :
     virtual ~Socket() = default;
 
 public :
+    /**
+     * @brief Creates a socket. Use prepare() and open() to bind/listen/accept (SERVER) or connect (CLIENT).
+     * 
+     * UNIX_* types use the address given to prepare() as the socket path and ignore the port.
+     * A path starting with '@' is bound in the abstract namespace and leaves no file behind.
+     * SEQPACKET types keep message boundaries: every read() returns exactly one send().
+     * 
+     * @return std::shared_ptr<Socket> nullptr for UDP and MULTICAST, use DatagramSocket instead
+     */
     static auto __create(SocketType::type socketType) -> std::shared_ptr<Socket>;
 
+#if defined(LINUX)
+    /**
+     * @brief Creates a pair of connected Unix domain sockets with socketpair().
+     * 
+     * Useful to talk to a forked child or between threads without any path.
+     * 
+     * @param socketType UNIX_CLIENT (stream) or UNIX_SEQPACKET_CLIENT
+     */
+    static auto create_pair(SocketType::type socketType = SocketType::UNIX_CLIENT) noexcept
+        -> std::pair<std::shared_ptr<Socket>, std::shared_ptr<Socket>>;
+#endif
+
 public :
     virtual auto prepare(const std::string& address, const int32_t port) -> void = 0;
     virtual auto open() -> void = 0;
@@ -67,5 +120,105 @@ public :
 
     virtual auto send(void* buffer, const size_t size) -> void = 0;
     virtual auto send(const char* buffer, const size_t size) -> void = 0;
+
+    /**
+     * @brief Gets the descriptor of the connection (the accepted client if server)
+     * 
+     * Used to drive the socket with AsyncIo or any other event loop.
+     */
+    virtual auto get_native_handle() const -> int32_t = 0;
+
+#if defined(LINUX)
+    /**
+     * @brief Sends all buffers with a single sendmsg() call, retrying on partial writes.
+     * 
+     * Header and payload of a frame can be sent without being copied together.
+     * 
+     * @return size_t Total number of bytes sent
+     */
+    virtual auto sendv(const iovec* iov, const size_t count) -> size_t = 0;
+
+    /**
+     * @brief Reads into the buffers in order with a single readv() call.
+     * 
+     * @return size_t Number of bytes read
+     */
+    virtual auto recvv(const iovec* iov, const size_t count) -> size_t = 0;
+
+    /**
+     * @brief Sends a buffer with MSG_ZEROCOPY.
+     * 
+     * The kernel transmits from the pages of the buffer, so the buffer must stay valid and unmodified
+     * until completion is called from poll_zerocopy(). Buffers smaller than ZEROCOPY_THRESHOLD
+     * or sockets without SO_ZEROCOPY support are sent by copy and completed immediately.
+     */
+    virtual auto send_zerocopy(const void* buffer, const size_t size, ZeroCopyCompletion completion) -> void = 0;
+
+    /**
+     * @brief Reads zero-copy notifications from the error queue and calls completions.
+     * 
+     * @param millisecond Maximum time to wait for a notification. 0 does not wait.
+     * @return size_t Number of completed send_zerocopy() calls
+     */
+    virtual auto poll_zerocopy(const uint32_t millisecond = 0) -> size_t = 0;
+
+    /**
+     * @brief Gets the number of send_zerocopy() calls which are not completed yet.
+     */
+    virtual auto get_zerocopy_pending() const -> size_t = 0;
+
+    /**
+     * @brief Streams a file to the socket in the kernel with sendfile().
+     * 
+     * @param fd File descriptor of a regular file (or anything mmap-able)
+     * @param offset Offset in the file to start from
+     * @param size Number of bytes to send
+     * @return size_t Number of bytes sent, less than size if the end of file is reached
+     */
+    virtual auto sendfile(const int32_t fd, const size_t offset, const size_t size) -> size_t = 0;
+
+    /**
+     * @brief Moves data from a file descriptor to the socket through a pipe with splice().
+     * 
+     * Unlike sendfile(), the source can be a pipe, socket or character device.
+     * The data is read from the current position of the source.
+     * 
+     * @return size_t Number of bytes sent, less than size if the end of input is reached
+     */
+    virtual auto splice(const int32_t fd, const size_t size) -> size_t = 0;
+
+    /**
+     * @brief Enables or disables TCP_NODELAY (Nagle's algorithm off).
+     * 
+     * Disable Nagle when writes are already coalesced by the caller (e.g. FramedStream)
+     * so that a flushed batch is not delayed waiting for an ACK.
+     * 
+     * @return bool False if the option is not supported by the socket
+     */
+    virtual auto set_nodelay(const bool enable) -> bool = 0;
+
+    /**
+     * @brief Sends data together with file descriptors (SCM_RIGHTS). Unix domain sockets only.
+     * 
+     * The receiver gets its own descriptors referring to the same open files, so large payloads
+     * can be handed over as a memfd or shared memory instead of being copied through the socket.
+     * At least one byte of data must be sent with the descriptors.
+     * 
+     * @param count Number of descriptors, at most MAX_FDS
+     * @return size_t Number of data bytes sent
+     */
+    virtual auto send_fds(const void* buffer, const size_t size, const int32_t* fds, const size_t count) -> size_t = 0;
+
+    /**
+     * @brief Receives data and file descriptors sent by send_fds().
+     * 
+     * Received descriptors are opened with O_CLOEXEC and owned by the caller.
+     * 
+     * @param fds Output for the descriptors
+     * @param count Capacity of fds in, number of received descriptors out
+     * @return size_t Number of data bytes read
+     */
+    virtual auto recv_fds(void* buffer, const size_t size, int32_t* fds, size_t& count) -> size_t = 0;
+#endif
 };
 } // namespace common
\ No newline at end of file
@@ -0,0 +1,97 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "CommonHeader.hpp"
+
+#include <memory_resource>
+#include <vector>
+
+namespace common
+{
+/**
+ * @brief Monotonic std::pmr::memory_resource that can be rewound and reused
+ * 
+ * Allocation bumps a pointer through chunks taken from the upstream resource, deallocation does nothing.
+ * reset() frees everything at once but keeps the chunks, so a per-frame or per-request arena
+ * stops touching the upstream resource after its first rounds.
+ * 
+ * @warning Not thread-safe, give each thread its own arena.
+ */
+class COMMON_LIB_API Arena final : public std::pmr::memory_resource
+{
+private :
+    struct Chunk
+    {
+        char* _data;
+        size_t _size;
+    };
+
+    std::pmr::memory_resource* _upstream;
+    size_t _chunkSize;
+    std::vector<Chunk> _chunks;
+    size_t _current = 0;        /* chunk being carved */
+    size_t _offset = 0;         /* in the current chunk */
+    size_t _used = 0;           /* bytes of the chunks before the current one */
+
+public :
+    /**
+     * @param chunkSize Bytes taken from upstream at a time, larger requests get a chunk of their own
+     */
+    explicit Arena(size_t chunkSize = 64 * 1024, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept;
+    ~Arena() override;
+
+    Arena(const Arena&) = delete;
+    auto operator=(const Arena&) -> Arena& = delete;
+
+public :
+    /**
+     * @brief Releases every allocation at once and keeps the chunks for reuse
+     * 
+     * @warning Objects still living in the arena must not be used afterwards, their destructors are not run.
+     */
+    auto reset() noexcept -> void;
+
+    /**
+     * @brief Like reset(), and returns the chunks to the upstream resource
+     */
+    auto release() noexcept -> void;
+
+    /**
+     * @brief Gets the bytes handed out since the last reset, including padding and skipped chunk tails
+     */
+    auto get_used() const noexcept -> size_t;
+
+    /**
+     * @brief Gets the bytes held from the upstream resource
+     */
+    auto get_capacity() const noexcept -> size_t;
+
+private :
+    auto do_allocate(size_t bytes, size_t alignment) -> void* override;
+    auto do_deallocate(void* pointer, size_t bytes, size_t alignment) -> void override;
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override;
+};
+} // namespace common
@@ -0,0 +1,186 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/NonCopyable.hpp"
+#include "common/thread/Futex.hpp"
+
+#include <atomic>
+#include <optional>
+#include <stdint.h>
+#include <thread>
+#include <utility>
+
+namespace common
+{
+/**
+ * @brief Blocking push/pop over SpscQueue or MpmcQueue
+ * 
+ * A thread that finds the queue full (or empty) spins briefly, then parks on a futex word
+ * that the other side bumps after each pop (or push). The other side only enters the kernel
+ * while someone is parked, so the uncontended path stays lock-free.
+ * 
+ * close() wakes everyone: push then fails and pop drains what is left before returning nullopt.
+ * 
+ * @tparam Queue SpscQueue<T> or MpmcQueue<T>, used with the same producer/consumer restrictions
+ */
+template <typename Queue>
+class BlockingQueue : public NonCopyable
+{
+public :
+    using value_type = typename Queue::value_type;
+
+private :
+    static constexpr uint32_t SPIN_COUNT = 128;
+
+    /**
+     * @brief Futex word bumped by one side, with the number of threads of the other side parked on it
+     */
+    struct alignas(64) Event
+    {
+        std::atomic<uint32_t> _epoch{0};
+        std::atomic<uint32_t> _waiters{0};
+    };
+
+    Queue _queue;
+    Event _pushed;      /* consumers wait on it */
+    Event _popped;      /* producers wait on it */
+    std::atomic<bool> _closed{false};
+
+private :
+    // The epoch is read before each attempt, so a bump after a failed attempt makes the futex wait return at once.
+    template <typename Attempt>
+    auto wait(Event& event, Attempt&& attempt) noexcept -> bool
+    {
+        for(uint32_t i = 0; i < SPIN_COUNT; ++i)
+        {
+            if(attempt()) { return true; }
+            if(_closed.load(std::memory_order_acquire)) { return attempt(); }
+            if((i & 0xF) == 0xF) { std::this_thread::yield(); }
+        }
+        while(true)
+        {
+            const uint32_t epoch = event._epoch.load(std::memory_order_acquire);
+            if(attempt()) { return true; }
+            if(_closed.load(std::memory_order_acquire)) { return attempt(); }
+            event._waiters.fetch_add(1, std::memory_order_seq_cst);
+            Futex::wait(event._epoch, epoch);
+            event._waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    static auto notify(Event& event, int32_t count) noexcept -> void
+    {
+        event._epoch.fetch_add(1, std::memory_order_seq_cst);
+        if(event._waiters.load(std::memory_order_seq_cst) != 0) { Futex::wake(event._epoch, count); }
+    }
+
+public :
+    explicit BlockingQueue(const size_t capacity) : _queue(capacity) {}
+
+public :
+    /**
+     * @brief Gets the underlying queue for non-blocking access
+     */
+    auto get_queue() noexcept -> Queue& { return _queue; }
+
+    /**
+     * @brief Pushes, waiting while the queue is full
+     * 
+     * @return bool false if the queue was closed
+     */
+    auto push(value_type item) noexcept -> bool
+    {
+        if(_closed.load(std::memory_order_acquire)) { return false; }
+        const bool pushed = wait(_popped, [this, &item](){
+            return !_closed.load(std::memory_order_relaxed) && _queue.try_push(std::move(item));
+        });
+        if(pushed) { notify(_pushed, 1); }
+        return pushed;
+    }
+
+    /**
+     * @brief Pushes every item, waiting for space as needed
+     * 
+     * @return size_t Number of items pushed, less than count only if the queue was closed
+     */
+    auto push_batch(const value_type* items, const size_t count) noexcept -> size_t
+    {
+        size_t pushed = 0;
+        while(pushed < count)
+        {
+            size_t chunk = 0;
+            const bool ready = wait(_popped, [this, &chunk, items, pushed, count](){
+                if(_closed.load(std::memory_order_relaxed)) { return false; }
+                chunk = _queue.push_batch(items + pushed, count - pushed);
+                return chunk != 0;
+            });
+            if(!ready) { break; }
+            pushed += chunk;
+            notify(_pushed, static_cast<int32_t>(chunk));
+        }
+        return pushed;
+    }
+
+    /**
+     * @brief Pops, waiting while the queue is empty
+     * 
+     * @return std::optional<value_type> nullopt once the queue is closed and drained
+     */
+    auto pop() noexcept -> std::optional<value_type>
+    {
+        std::optional<value_type> item;
+        if(wait(_pushed, [this, &item](){ return (item = _queue.try_pop()).has_value(); })) { notify(_popped, 1); }
+        return item;
+    }
+
+    /**
+     * @brief Waits for at least one element, then takes up to count without waiting
+     * 
+     * @return size_t Number of elements taken, 0 once the queue is closed and drained
+     */
+    auto pop_batch(value_type* out, const size_t count) noexcept -> size_t
+    {
+        size_t popped = 0;
+        if(count != 0 && wait(_pushed, [this, &popped, out, count](){ return (popped = _queue.pop_batch(out, count)) != 0; }))
+        {
+            notify(_popped, static_cast<int32_t>(popped));
+        }
+        return popped;
+    }
+
+    /**
+     * @brief Wakes every waiting thread, push fails from now on
+     */
+    auto close() noexcept -> void
+    {
+        _closed.store(true, std::memory_order_release);
+        notify(_pushed, Futex::ALL);
+        notify(_popped, Futex::ALL);
+    }
+
+    auto is_closed() const noexcept -> bool { return _closed.load(std::memory_order_acquire); }
+};
+} // namespace common
@@ -0,0 +1,130 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <stdint.h>
+#include <utility>
+
+namespace common
+{
+/**
+ * @brief Lock-free single-producer single-consumer byte ring
+ * 
+ * The producer writes directly into write_span() (e.g. with ::read) and publishes with commit().
+ * The consumer parses read_span() in place and releases with consume().
+ * Spans are contiguous, so a region crossing the end of the ring is returned in two steps.
+ * 
+ * @note Capacity is rounded up to a power of two.
+ */
+class ByteRing
+{
+private :
+    const size_t _capacity;
+    const size_t _mask;
+    std::unique_ptr<uint8_t[]> _buffer;
+
+    alignas(64) std::atomic<size_t> _head{0}; // written by consumer
+    alignas(64) std::atomic<size_t> _tail{0}; // written by producer
+
+private :
+    static constexpr auto round_up(size_t value) -> size_t
+    {
+        size_t capacity = 1;
+        while(capacity < value) { capacity <<= 1; }
+        return capacity;
+    }
+
+public :
+    explicit ByteRing(const size_t capacity)
+        : _capacity(round_up(capacity)), _mask(_capacity - 1), _buffer(new uint8_t[_capacity]) {}
+
+public :
+    auto capacity() const noexcept -> size_t { return _capacity; }
+    auto size() const noexcept -> size_t { return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire); }
+    auto empty() const noexcept -> bool { return size() == 0; }
+
+    /**
+     * @brief [Producer] Gets the contiguous free region.
+     */
+    auto write_span() noexcept -> std::pair<uint8_t*, size_t>
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        const size_t free = _capacity - (tail - _head.load(std::memory_order_acquire));
+        const size_t offset = tail & _mask;
+        return {_buffer.get() + offset, std::min(free, _capacity - offset)};
+    }
+
+    /**
+     * @brief [Producer] Publishes size bytes written into write_span().
+     */
+    auto commit(const size_t size) noexcept -> void
+    {
+        _tail.store(_tail.load(std::memory_order_relaxed) + size, std::memory_order_release);
+    }
+
+    /**
+     * @brief [Producer] Copies as much of data as fits.
+     * 
+     * @return size_t Number of bytes written
+     */
+    auto write(const uint8_t* data, const size_t size) noexcept -> size_t
+    {
+        size_t written = 0;
+        while(written < size)
+        {
+            auto [span, available] = write_span();
+            if(available == 0) { break; }
+            const size_t chunk = std::min(available, size - written);
+            std::memcpy(span, data + written, chunk);
+            commit(chunk);
+            written += chunk;
+        }
+        return written;
+    }
+
+    /**
+     * @brief [Consumer] Gets the contiguous readable region.
+     */
+    auto read_span() const noexcept -> std::pair<const uint8_t*, size_t>
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        const size_t used = _tail.load(std::memory_order_acquire) - head;
+        const size_t offset = head & _mask;
+        return {_buffer.get() + offset, std::min(used, _capacity - offset)};
+    }
+
+    /**
+     * @brief [Consumer] Releases size bytes of read_span().
+     */
+    auto consume(const size_t size) noexcept -> void
+    {
+        _head.store(_head.load(std::memory_order_relaxed) + size, std::memory_order_release);
+    }
+};
+} // namespace common
@@ -0,0 +1,429 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/utils/Misc.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+namespace common
+{
+/**
+ * @brief Hash map sharded over reader-writer locks, each shard an open-addressing table
+ * 
+ * A key only locks its shard, shared for lookups and exclusive for modifications, so threads working
+ * on different keys rarely meet and lookups never block each other. Each shard probes linearly through
+ * a byte array of hash tags before touching an entry, so a lookup usually reads one metadata cache line
+ * and one entry. Erasing shifts the following entries back, no tombstones are left behind.
+ * 
+ * Values are copied out or visited under the shard lock; callbacks must not call back into the map.
+ * 
+ * @tparam Key Copy or move constructible
+ * @tparam Value Default constructible for upsert()
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class ConcurrentHashMap
+{
+private :
+    struct Entry
+    {
+        uint64_t _hash;
+        Key _key;
+        Value _value;
+    };
+
+    class Table
+    {
+    private :
+        static constexpr uint8_t EMPTY = 0;
+
+        std::vector<uint8_t> _tags;                 /* EMPTY or 0x80 | 7 bits of the hash */
+        std::vector<std::optional<Entry>> _entries;
+        size_t _mask = 0;
+        size_t _size = 0;
+
+        static auto get_tag(uint64_t hash) noexcept -> uint8_t { return static_cast<uint8_t>(0x80 | (hash & 0x7F)); }
+        auto get_home(uint64_t hash) const noexcept -> size_t { return static_cast<size_t>(hash >> 7) & _mask; }
+
+        auto grow() -> void
+        {
+            const size_t capacity = _tags.empty() ? 8 : _tags.size() * 2;
+            std::vector<std::optional<Entry>> entries(capacity);
+            std::swap(entries, _entries);
+            _tags.assign(capacity, EMPTY);
+            _mask = capacity - 1;
+            for(auto& entry : entries)
+            {
+                if(!entry) { continue; }
+                size_t index = get_home(entry->_hash);
+                while(_tags[index] != EMPTY) { index = (index + 1) & _mask; }
+                _tags[index] = get_tag(entry->_hash);
+                _entries[index] = std::move(entry);
+            }
+        }
+
+    public :
+        auto size() const noexcept -> size_t { return _size; }
+
+        static constexpr size_t NPOS = static_cast<size_t>(-1);
+
+        template <typename K>
+        auto find_index(uint64_t hash, const K& key, const KeyEqual& equal) const noexcept -> size_t
+        {
+            if(_size == 0) { return NPOS; }
+            const uint8_t tag = get_tag(hash);
+            for(size_t index = get_home(hash); _tags[index] != EMPTY; index = (index + 1) & _mask)
+            {
+                if(_tags[index] == tag && _entries[index]->_hash == hash && equal(_entries[index]->_key, key)) { return index; }
+            }
+            return NPOS;
+        }
+
+        auto at(size_t index) noexcept -> Entry& { return *_entries[index]; }
+        auto at(size_t index) const noexcept -> const Entry& { return *_entries[index]; }
+
+        template <typename K>
+        auto find(uint64_t hash, const K& key, const KeyEqual& equal) const noexcept -> const Entry*
+        {
+            const size_t index = find_index(hash, key, equal);
+            return index == NPOS ? nullptr : &*_entries[index];
+        }
+
+        template <typename K>
+        auto find(uint64_t hash, const K& key, const KeyEqual& equal) noexcept -> Entry*
+        {
+            const size_t index = find_index(hash, key, equal);
+            return index == NPOS ? nullptr : &*_entries[index];
+        }
+
+        // The key must not be present.
+        template <typename K, typename... Args>
+        auto emplace(uint64_t hash, K&& key, Args&&... args) -> Entry&
+        {
+            if((_size + 1) * 4 > _tags.size() * 3) { grow(); }
+            size_t index = get_home(hash);
+            while(_tags[index] != EMPTY) { index = (index + 1) & _mask; }
+            _entries[index].emplace(Entry{hash, Key(std::forward<K>(key)), Value(std::forward<Args>(args)...)});
+            _tags[index] = get_tag(hash);
+            ++_size;
+            return *_entries[index];
+        }
+
+        auto erase(size_t hole) noexcept -> void
+        {
+            _entries[hole].reset();
+            _tags[hole] = EMPTY;
+            --_size;
+
+            // backward shift: moves up every following entry whose probe sequence passes the hole
+            for(size_t index = (hole + 1) & _mask; _tags[index] != EMPTY; index = (index + 1) & _mask)
+            {
+                const size_t home = get_home(_entries[index]->_hash);
+                if(((index - home) & _mask) < ((index - hole) & _mask)) { continue; }
+                _entries[hole] = std::move(_entries[index]);
+                _tags[hole] = _tags[index];
+                _entries[index].reset();
+                _tags[index] = EMPTY;
+                hole = index;
+            }
+        }
+
+        template <typename Function>
+        auto for_each(Function& function) -> void
+        {
+            for(auto& entry : _entries)
+            {
+                if(entry) { function(static_cast<const Key&>(entry->_key), entry->_value); }
+            }
+        }
+
+        template <typename Predicate>
+        auto erase_if(Predicate& predicate) -> size_t
+        {
+            size_t erased = 0;
+            for(size_t index = 0; index < _entries.size();)
+            {
+                // a backward shift may move an unvisited entry into index, so it is checked again
+                if(_entries[index] && predicate(static_cast<const Key&>(_entries[index]->_key), _entries[index]->_value))
+                {
+                    erase(index);
+                    ++erased;
+                    continue;
+                }
+                ++index;
+            }
+            return erased;
+        }
+
+        auto clear() noexcept -> void
+        {
+            _tags.clear();
+            _entries.clear();
+            _mask = 0;
+            _size = 0;
+        }
+    };
+
+    struct alignas(64) Shard
+    {
+        mutable std::shared_mutex _lock;
+        Table _table;
+    };
+
+    std::unique_ptr<Shard[]> _shards;
+    uint32_t _shardBits;
+    Hash _hasher;
+    KeyEqual _equal;
+
+private :
+    template <typename K>
+    auto hash(const K& key) const noexcept -> uint64_t
+    {
+        // MurmurHash3 finalizer: every input bit reaches the shard, home and tag bits,
+        // so weak hashes such as the identity of integers spread over all of them
+        uint64_t code = static_cast<uint64_t>(_hasher(key));
+        code ^= code >> 33;
+        code *= 0xFF51AFD7ED558CCDull;
+        code ^= code >> 33;
+        code *= 0xC4CEB9FE1A85EC53ull;
+        code ^= code >> 33;
+        return code;
+    }
+
+    auto get_shard(uint64_t hash) const noexcept -> Shard&
+    {
+        return _shards[_shardBits == 0 ? 0 : hash >> (64 - _shardBits)];
+    }
+
+public :
+    /**
+     * @param shards Number of locks, rounded up to a power of 2; a few times the number of threads works well
+     */
+    explicit ConcurrentHashMap(uint32_t shards = 64, const Hash& hasher = Hash(), const KeyEqual& equal = KeyEqual())
+        : _hasher(hasher), _equal(equal)
+    {
+        const uint32_t count = utils::next_pwr_of_2(shards == 0 ? 1 : shards);
+        _shards = std::make_unique<Shard[]>(count);
+        _shardBits = 0;
+        while((1u << _shardBits) < count) { ++_shardBits; }
+    }
+
+    ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+    auto operator=(const ConcurrentHashMap&) -> ConcurrentHashMap& = delete;
+
+public :
+    /**
+     * @brief Inserts the value if the key is absent
+     * 
+     * @return bool false if the key was present, the map is then unchanged
+     */
+    template <typename K, typename... Args>
+    auto try_emplace(K&& key, Args&&... args) -> bool
+    {
+        const uint64_t code = hash(key);
+        Shard& shard = get_shard(code);
+        std::unique_lock<std::shared_mutex> lock(shard._lock);
+        if(shard._table.find(code, key, _equal)) { return false; }
+        shard._table.emplace(code, std::forward<K>(key), std::forward<Args>(args)...);
+        return true;
+    }
+
+    /**
+     * @return bool true if inserted, false if an existing value was replaced
+     */
+    template <typename K, typename V>
+    auto insert_or_assign(K&& key, V&& value) -> bool
+    {
+        const uint64_t code = hash(key);
+        Shard& shard = get_shard(code);
+        std::unique_lock<std::shared_mutex> lock(shard._lock);
+        if(Entry* entry = shard._table.find(code, key, _equal))
+        {
+            entry->_value = std::forward<V>(value);
+            return false;
+        }
+        shard._table.emplace(code, std::forward<K>(key), std::forward<V>(value));
+        return true;
+    }
+
+    /**
+     * @brief Calls function(Value&) on the value of key under the exclusive shard lock,
+     *        default-constructing the value first if the key is absent
+     */
+    template <typename K, typename Function>
+    auto upsert(K&& key, Function&& function) -> void
+    {
+        const uint64_t code = hash(key);
+        Shard& shard = get_shard(code);
+        std::unique_lock<std::shared_mutex> lock(shard._lock);
+        Entry* entry = shard._table.find(code, key, _equal);
+        if(!entry) { entry = &shard._table.emplace(code, std::forward<K>(key)); }
+        function(entry->_value);
+    }
+
+    /**
+     * @brief Copies the value of key
+     */
+    template <typename K>
+    auto find(const K& key) const -> std::optional<Value>
+    {
+        const uint64_t code = hash(key);
+        const Shard& shard = get_shard(code);
+        std::shared_lock<std::shared_mutex> lock(shard._lock);
+        if(const Entry* entry = shard._table.find(code, key, _equal)) { return entry->_value; }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Calls function(const Value&) on the value of key under the shared shard lock
+     * 
+     * @return bool false if the key is absent
+     */
+    template <typename K, typename Function>
+    auto visit(const K& key, Function&& function) const -> bool
+    {
+        const uint64_t code = hash(key);
+        const Shard& shard = get_shard(code);
+        std::shared_lock<std::shared_mutex> lock(shard._lock);
+        const Entry* entry = shard._table.find(code, key, _equal);
+        if(!entry) { return false; }
+        function(entry->_value);
+        return true;
+    }
+
+    /**
+     * @brief Calls function(Value&) on the value of key under the exclusive shard lock
+     * 
+     * @return bool false if the key is absent
+     */
+    template <typename K, typename Function>
+    auto update(const K& key, Function&& function) -> bool
+    {
+        const uint64_t code = hash(key);
+        Shard& shard = get_shard(code);
+        std::unique_lock<std::shared_mutex> lock(shard._lock);
+        Entry* entry = shard._table.find(code, key, _equal);
+        if(!entry) { return false; }
+        function(entry->_value);
+        return true;
+    }
+
+    template <typename K>
+    auto contains(const K& key) const -> bool
+    {
+        return visit(key, [](const Value&){});
+    }
+
+    template <typename K>
+    auto erase(const K& key) -> bool
+    {
+        return extract(key).has_value();
+    }
+
+    /**
+     * @brief Removes key and returns its value
+     */
+    template <typename K>
+    auto extract(const K& key) -> std::optional<Value>
+    {
+        const uint64_t code = hash(key);
+        Shard& shard = get_shard(code);
+        std::unique_lock<std::shared_mutex> lock(shard._lock);
+        const size_t index = shard._table.find_index(code, key, _equal);
+        if(index == Table::NPOS) { return std::nullopt; }
+        std::optional<Value> value(std::move(shard._table.at(index)._value));
+        shard._table.erase(index);
+        return value;
+    }
+
+    /**
+     * @brief Calls function(const Key&, Value&) on every entry, one shard locked exclusively at a time
+     * 
+     * Entries inserted or erased in other shards meanwhile may or may not be visited.
+     */
+    template <typename Function>
+    auto for_each(Function&& function) -> void
+    {
+        for(size_t i = 0; i < (size_t{1} << _shardBits); ++i)
+        {
+            std::unique_lock<std::shared_mutex> lock(_shards[i]._lock);
+            _shards[i]._table.for_each(function);
+        }
+    }
+
+    /**
+     * @brief Erases the entries for which predicate(const Key&, Value&) returns true
+     * 
+     * @return size_t Number of erased entries
+     */
+    template <typename Predicate>
+    auto erase_if(Predicate&& predicate) -> size_t
+    {
+        size_t erased = 0;
+        for(size_t i = 0; i < (size_t{1} << _shardBits); ++i)
+        {
+            std::unique_lock<std::shared_mutex> lock(_shards[i]._lock);
+            erased += _shards[i]._table.erase_if(predicate);
+        }
+        return erased;
+    }
+
+    /**
+     * @brief Gets the number of entries, exact only while no other thread modifies the map
+     */
+    auto size() const -> size_t
+    {
+        size_t size = 0;
+        for(size_t i = 0; i < (size_t{1} << _shardBits); ++i)
+        {
+            std::shared_lock<std::shared_mutex> lock(_shards[i]._lock);
+            size += _shards[i]._table.size();
+        }
+        return size;
+    }
+
+    auto empty() const -> bool
+    {
+        return size() == 0;
+    }
+
+    auto clear() -> void
+    {
+        for(size_t i = 0; i < (size_t{1} << _shardBits); ++i)
+        {
+            std::unique_lock<std::shared_mutex> lock(_shards[i]._lock);
+            _shards[i]._table.clear();
+        }
+    }
+};
+} // namespace common
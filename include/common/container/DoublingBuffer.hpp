@@ -24,26 +24,30 @@ SOFTWARE.
 
 #pragma once
 
+#include "common/container/PersistentVector.hpp"
+
 #include <atomic>
-#include <array>
-#include <vector>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace common
 {
 /**
- * @brief Double buffering container
+ * @brief Copy-on-write container read without locks, RCU style
  * 
- * This container provides thread-safe access to a collection of items without using locks.
- * It maintains two buffers and switches between them atomically when new items are added.
- * This design allows readers to access a stable snapshot while writers prepare the next version.
+ * Every modification builds a new PersistentVector snapshot sharing all but O(log n) nodes with
+ * the current one and publishes it with a single pointer store. Readers load that pointer and
+ * take a reference, so a snapshot stays valid for as long as a reader holds it.
+ * A replaced snapshot is released by the writer once no reader can still be loading it.
  * 
- * @warning This implementation is only safe for single-writer / multi-reader scenarios. 
- *          For high-performance critical applications, consider implementing optimized 
- *          lock-free data structures directly rather than using this general-purpose container.
+ * Writers serialize on a mutex readers never take, so any thread may modify the buffer.
+ * A Transaction applies many modifications and publishes them as one generation.
  * 
  * @tparam Ty The type of elements stored in the buffer
- * @tparam Size Number of buffers to maintain (minimum 2, default 2)
+ * @tparam Size Unused since snapshots are no longer recycled, kept for source compatibility
  */
 template <typename Ty, size_t Size = 2>
 class DoublingBuffer
@@ -51,113 +55,258 @@ class DoublingBuffer
     static_assert(Size >= 2, "DoublingBuffer requires at least 2 buffers.");
     static_assert(Size <= 255, "DoublingBuffer requires smaller than 255 buffers.");
 
+public :
+    using Snapshot = PersistentVector<Ty>;
+
 private :
+    // published version, the snapshot pointer inside is never reassigned
+    struct Version
+    {
+        std::shared_ptr<const Snapshot> _snapshot;
+    };
+
+    struct Retired
+    {
+        std::unique_ptr<Version> _version;
+        uint64_t _epoch;
+    };
+
     std::atomic<uint32_t> _generation{0};
-    std::atomic<uint8_t> _activatedIndex{0};
-    std::array<std::shared_ptr<std::vector<Ty>>, Size> _buffers;
+    std::atomic<Version*> _current{nullptr};
+    std::mutex _writeLock;
+    std::vector<Retired> _retired;              /* under _writeLock */
+
+    // get_buffer() calls in progress, by parity of the epoch they started in
+    alignas(64) std::atomic<uint64_t> _epoch{0};
+    std::atomic<int64_t> _readers[2];
+
+private :
+    auto current() const noexcept -> const Snapshot& { return *_current.load(std::memory_order_relaxed)->_snapshot; }
+
+    auto publish(Snapshot snapshot) -> void
+    {
+        auto next = new Version{std::make_shared<const Snapshot>(std::move(snapshot))};
+        auto previous = _current.exchange(next, std::memory_order_acq_rel);
+        _retired.push_back({std::unique_ptr<Version>(previous), _epoch.load(std::memory_order_relaxed)});
+        _generation.fetch_add(1);
+        reclaim();
+    }
+
+    // Advances the epoch when the readers of the previous one are gone and frees versions retired two epochs ago.
+    auto reclaim() -> void
+    {
+        for(int32_t i = 0; i < 2; ++i)
+        {
+            const uint64_t epoch = _epoch.load(std::memory_order_relaxed);
+            if(_readers[(epoch + 1) & 1].load(std::memory_order_seq_cst) != 0) { break; }
+            _epoch.store(epoch + 1, std::memory_order_seq_cst);
+        }
+
+        const uint64_t epoch = _epoch.load(std::memory_order_relaxed);
+        size_t kept = 0;
+        for(auto& retired : _retired)
+        {
+            if(retired._epoch + 2 > epoch) { _retired[kept++] = std::move(retired); }
+        }
+        _retired.resize(kept);
+    }
+
+public :
+    /**
+     * @brief Batch of modifications published as one generation
+     * 
+     * Holds the writer lock from DoublingBuffer::transaction() until commit() or destruction,
+     * readers keep seeing the previous snapshot meanwhile. Destroying it without commit() discards the changes.
+     * Modifications are applied in place on a private version, so a batch copies each shared node once.
+     */
+    class Transaction
+    {
+        friend class DoublingBuffer;
+
+    private :
+        DoublingBuffer* _buffer;
+        std::unique_lock<std::mutex> _lock;
+        Snapshot _working;
+        bool _modified = false;
+
+    private :
+        explicit Transaction(DoublingBuffer* buffer) : _buffer(buffer), _lock(buffer->_writeLock), _working(buffer->current()) {}
+
+        auto check() const -> void
+        {
+            if(!_lock.owns_lock()) { throw std::logic_error("DoublingBuffer transaction already committed"); }
+        }
+
+    public :
+        Transaction(Transaction&&) noexcept = default;
+
+        auto push(const Ty& item) -> void
+        {
+            check();
+            _working.push_back_in_place(item);
+            _modified = true;
+        }
+
+        auto push(Ty&& item) -> void
+        {
+            check();
+            _working.push_back_in_place(std::move(item));
+            _modified = true;
+        }
+
+        auto erase(size_t index) -> bool
+        {
+            check();
+            if(index >= _working.size()) { return false; }
+            _working.erase_in_place(index);
+            _modified = true;
+            return true;
+        }
+
+        auto update(size_t index, const Ty& item) -> bool
+        {
+            check();
+            if(index >= _working.size()) { return false; }
+            _working.set_in_place(index, item);
+            _modified = true;
+            return true;
+        }
+
+        /**
+         * @brief Gets the snapshot including the modifications made so far
+         */
+        auto get_snapshot() const -> const Snapshot&
+        {
+            return _working;
+        }
+
+        /**
+         * @brief Publishes the modifications, if any, as one generation and releases the writer lock
+         */
+        auto commit() -> void
+        {
+            check();
+            if(_modified) { _buffer->publish(std::move(_working)); }
+            _lock.unlock();
+        }
+    };
 
 public :
     /**
      * @brief Default constructor
      * 
-     * Initializes the first buffer with an empty vector.
+     * Publishes an empty snapshot.
      */
     DoublingBuffer()
     {
-        _buffers[0] = std::make_shared<std::vector<Ty>>();
+        _readers[0].store(0);
+        _readers[1].store(0);
+        _current.store(new Version{std::make_shared<const Snapshot>()});
+    }
+
+    ~DoublingBuffer()
+    {
+        delete _current.load();
     }
 
+    DoublingBuffer(const DoublingBuffer&) = delete;
+    auto operator=(const DoublingBuffer&) -> DoublingBuffer& = delete;
+
     /**
-     * @brief Adds a new item to the buffer using lock-free double buffering
-     * 
-     * Creates a copy of the current active buffer with the new item added,
-     * then atomically switches to the new buffer. This ensures readers always
-     * see a consistent snapshot while avoiding locks.
+     * @brief Appends an item in O(log n)
      * 
-     * @param item The item to add (moved into the buffer)
+     * Builds the next snapshot sharing every untouched node with the current one,
+     * then publishes it with a single pointer exchange.
      * 
-     * @note This operation has O(n) complexity due to buffer copying.
-     *       Consider batching operations for better performance with large datasets.
+     * @param item The item to add
      */
     auto push(Ty&& item) -> void
     {
-        uint8_t currentIndex = _activatedIndex.load();
-        uint8_t selectedIndex = (currentIndex + 1) < static_cast<uint8_t>(Size) ? (currentIndex + 1) : 0;
-        
-        _buffers[selectedIndex] = std::make_shared<std::vector<Ty>>(*_buffers[currentIndex]);
-        _buffers[selectedIndex]->push_back(std::forward<Ty>(item));
-        
-        _activatedIndex.store(selectedIndex);
-        _generation.fetch_add(1);
+        std::lock_guard<std::mutex> lock(_writeLock);
+        publish(current().push_back(std::move(item)));
     }
 
     auto push(Ty& item) -> void
     {
-        uint8_t currentIndex = _activatedIndex.load();
-        uint8_t selectedIndex = (currentIndex + 1) < Size ? (currentIndex + 1) : 0;
-        
-        _buffers[selectedIndex] = std::make_shared<std::vector<Ty>>(*_buffers[currentIndex]);
-        _buffers[selectedIndex]->push_back(item);
-        
-        _activatedIndex.store(selectedIndex);
-        _generation.fetch_add(1);
+        std::lock_guard<std::mutex> lock(_writeLock);
+        publish(current().push_back(item));
     }
 
     /**
-     * @brief Removes item at the specified index from the currently active buffer
-     * 
-     * Creates a copy of the current active buffer with the item at the specified index removed,
-     * then atomically switches to the new buffer.
+     * @brief Removes item at the specified index in O(log n)
      * 
      * @param index The index of the item to remove from the active buffer
      * @return bool True if item was removed, false if index was invalid or buffer was empty
-     * 
-     * @note This operation has O(n) complexity due to buffer copying.
-     *       Index is validated against the currently active buffer size.
      */
     auto erase(size_t index) -> bool
     {
-        uint8_t currentIndex = _activatedIndex.load();
-        uint8_t selectedIndex = (currentIndex + 1) < static_cast<uint8_t>(Size) ? (currentIndex + 1) : 0;
-        
-        if (index >= _buffers[currentIndex]->size()) { return false; }
-        
-        auto buffer = std::make_shared<std::vector<Ty>>();
-        buffer->reserve(_buffers[currentIndex]->size() - 1);
-        
-        for (size_t i = 0; i < _buffers[currentIndex]->size(); ++i) 
-        {
-            if (i == index) { continue; }
-            buffer->push_back((*_buffers[currentIndex])[i]);
-        }
+        std::lock_guard<std::mutex> lock(_writeLock);
+        if(index >= current().size()) { return false; }
+        publish(current().erase(index));
+        return true;
+    }
 
-        _buffers[selectedIndex] = buffer;
-        
-        _activatedIndex.store(selectedIndex);
-        _generation.fetch_add(1);
+    /**
+     * @brief Replaces the item at the specified index in O(log n)
+     * 
+     * @param index The index of the item to replace
+     * @param item The new value
+     * @return bool True if item was replaced, false if index was invalid
+     */
+    auto update(size_t index, const Ty& item) -> bool
+    {
+        std::lock_guard<std::mutex> lock(_writeLock);
+        if(index >= current().size()) { return false; }
+        publish(current().set(index, item));
         return true;
     }
 
     /**
-     * @brief Gets a shared pointer to the currently active buffer
+     * @brief Starts a batch of modifications
+     * 
+     * Blocks other writers, not readers, until the transaction is committed or destroyed.
+     * 
+     * @return Transaction Apply push/erase/update to it, then call commit()
+     */
+    auto transaction() -> Transaction
+    {
+        return Transaction(this);
+    }
+
+    /**
+     * @brief Gets the current snapshot
      * 
-     * Returns a snapshot of the current buffer state. The returned shared_ptr
-     * ensures the buffer remains valid even if the active buffer changes.
+     * The snapshot is found with a single atomic load and referenced inside an epoch guard,
+     * so the writer never frees a version a reader is still loading.
+     * Unlike a plain RCU read this is not free: the guard is two read-modify-writes on a counter
+     * shared by all readers, and the reference is a shared_ptr increment. Readers on many cores
+     * contend on those lines, so hold on to a snapshot instead of calling this per element.
      * 
-     * @return std::shared_ptr<std::vector<Ty>> Shared pointer to the active buffer
+     * @return std::shared_ptr<const Snapshot> Immutable snapshot with vector-like read access
      * 
-     * @note The returned buffer is immutable from the caller's perspective.
-     *       Concurrent push() operations will not affect the returned buffer.
+     * @note Concurrent push()/erase()/update() operations will not affect the returned snapshot.
      */
-    auto get_buffer() -> std::shared_ptr<std::vector<Ty>>
+    auto get_buffer() -> std::shared_ptr<const Snapshot>
     {
-        return _buffers[_activatedIndex.load()];
+        while(true)
+        {
+            const uint64_t epoch = _epoch.load(std::memory_order_seq_cst);
+            _readers[epoch & 1].fetch_add(1, std::memory_order_seq_cst);
+            if(_epoch.load(std::memory_order_seq_cst) == epoch)
+            {
+                auto snapshot = _current.load(std::memory_order_acquire)->_snapshot;
+                _readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+                return snapshot;
+            }
+            _readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+        }
     }
 
     /**
      * @brief Gets the current generation number
      * 
-     * The generation number is incremented with each buffer modification operation (push/erase),
+     * The generation number is incremented with each buffer modification operation (push/erase/update)
+     * and once per committed transaction,
      * allowing clients to detect when the buffer has been updated.
      * 
      * @return uint32_t Current generation number
@@ -167,4 +316,4 @@ public :
         return _generation.load();
     }
 };
-}
\ No newline at end of file
+}
@@ -24,9 +24,15 @@ SOFTWARE.
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
-#include <functional>
+#include <new>
+#include <stdint.h>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace common
 {
@@ -35,67 +41,99 @@ inline namespace v2
 
 // Chase-Lev Work-Stealing Deque
 // 소유자 스레드는 bottom에서 push/pop, 다른 스레드들은 top에서 steal
+//
+// steal은 top CAS로 인덱스를 먼저 확보한 뒤 슬롯 상태 CAS(FULL -> TAKEN)로 원소를 가져간다.
+// 소유자가 배열을 키우거나 줄일 때도 같은 슬롯 CAS(FULL -> MOVED)로 원소를 옮기므로
+// 원소는 한 번만 이동(move)되고, T는 move 생성만 가능하면 된다.
+// 교체된 배열은 epoch가 두 번 넘어갈 때까지(그 배열을 볼 수 있었던 steal이 모두 끝날 때까지) 보관 후 해제한다.
 template<typename T>
 class LockFreeWorkQueue
 {
 private:
+    // 슬롯 상태 : (인덱스 << 2) | 태그
+    static constexpr uint64_t FREE = 0;
+    static constexpr uint64_t FULL = 1;
+    static constexpr uint64_t TAKEN = 2;   // steal이 원소를 꺼내는 중
+    static constexpr uint64_t MOVED = 3;   // 새 배열로 옮겨짐
+    static constexpr uint64_t TAG_MASK = 3;
+
+    static constexpr uint64_t state(int64_t index, uint64_t tag) noexcept
+    {
+        return (static_cast<uint64_t>(index) << 2) | tag;
+    }
+
+    struct Slot
+    {
+        std::atomic<uint64_t> _state{FREE};
+        alignas(T) unsigned char _data[sizeof(T)];
+
+        T* item() noexcept { return std::launder(reinterpret_cast<T*>(_data)); }
+    };
+
+    // 원소의 생성/소멸은 슬롯 상태에 따라 소유자 또는 steal한 스레드가 맡는다
     struct CircularArray
     {
-        std::atomic<T*> _buffer;
-        size_t _size;
-        
-        CircularArray(size_t size) : _size(size)
-        {
-            _buffer.store(new T[size]);
-        }
-        
-        ~CircularArray()
-        {
-            delete[] _buffer.load();
-        }
-        
-        T get(size_t index) const
-        {
-            return _buffer.load()[index % _size];
-        }
-        
-        void put(size_t index, const T& item)
-        {
-            _buffer.load()[index % _size] = item;
-        }
-        
-        std::unique_ptr<CircularArray> resize(size_t bottom, size_t top)
-        {
-            auto newArray = std::make_unique<CircularArray>(_size * 2);
-            T* oldBuffer = _buffer.load();
-            
-            for (size_t i = top; i < bottom; ++i)
-            {
-                newArray->put(i, oldBuffer[i % _size]);
-            }
-            
-            return newArray;
-        }
-    };    std::atomic<size_t> _top{0};
-    std::atomic<size_t> _bottom{0};
-    std::atomic<std::shared_ptr<CircularArray>> _array;
-    
+        const int64_t _size;
+        const int64_t _mask;
+        std::unique_ptr<Slot[]> _slots;
+
+        explicit CircularArray(int64_t size) : _size(size), _mask(size - 1), _slots(new Slot[size]) {}
+
+        Slot& at(int64_t index) noexcept { return _slots[index & _mask]; }
+    };
+
+    struct Retired
+    {
+        CircularArray* _array;
+        uint64_t _epoch;
+    };
+
+    alignas(64) std::atomic<int64_t> _top{0};
+    alignas(64) std::atomic<int64_t> _bottom{0};
+    std::atomic<CircularArray*> _array;
+    const int64_t _initialSize;
+
+    // steal 중인 스레드 수 (epoch의 홀짝별)
+    alignas(64) std::atomic<uint64_t> _epoch{0};
+    std::atomic<int64_t> _readers[2];
+    std::vector<Retired> _retired;          // 소유자 전용
+
     // 성능 모니터링용 카운터들
     mutable std::atomic<size_t> _resizeCount{0};
     mutable std::atomic<size_t> _maxSize{0};
 
 public:
     // 사용 패턴에 따른 초기 크기 설정
-    explicit LockFreeWorkQueue(size_t initialSize = 256) 
-        : _array(std::make_shared<CircularArray>(nextPowerOf2(initialSize)))
+    explicit LockFreeWorkQueue(size_t initialSize = 256)
+        : _array(new CircularArray(static_cast<int64_t>(nextPowerOf2(initialSize))))
+        , _initialSize(static_cast<int64_t>(nextPowerOf2(initialSize)))
     {
+        _readers[0].store(0);
+        _readers[1].store(0);
     }
 
+    // 다른 스레드가 사용 중이지 않을 때 소멸해야 한다
+    ~LockFreeWorkQueue()
+    {
+        CircularArray* array = _array.load();
+        const int64_t bottom = _bottom.load();
+        for(int64_t i = _top.load(); i < bottom; ++i)
+        {
+            Slot& slot = array->at(i);
+            if(slot._state.load() == state(i, FULL)) { slot.item()->~T(); }
+        }
+        delete array;
+        for(auto& retired : _retired) { delete retired._array; }
+    }
+
+    LockFreeWorkQueue(const LockFreeWorkQueue&) = delete;
+    LockFreeWorkQueue& operator=(const LockFreeWorkQueue&) = delete;
+
 private:
     // 2의 거듭제곱으로 올림
     static constexpr size_t nextPowerOf2(size_t n) noexcept
     {
-        if (n <= 1) return 1;
+        if (n <= 1) return 2;
         n--;
         n |= n >> 1;
         n |= n >> 2;
@@ -106,113 +144,203 @@ private:
         return n + 1;
     }
 
-public:    // 소유자 스레드가 bottom에 작업 추가
-    void push(const T& item)
+    // steal 구간 진입, 반환한 epoch로 leave() 호출
+    uint64_t enter() noexcept
     {
-        size_t bottom = _bottom.load(std::memory_order_relaxed);
-        size_t top = _top.load(std::memory_order_acquire);
-        
-        auto array = _array.load(std::memory_order_relaxed);
-          // 큐가 가득 찬 경우 크기 확장 (75% 사용률에서 확장)
-        if (bottom - top >= array->_size * 3 / 4)
+        while(true)
         {
-            auto newArray = array->resize(bottom, top);
-            _array.store(newArray, std::memory_order_release);
-            array = newArray;
-            _resizeCount.fetch_add(1, std::memory_order_relaxed);
+            const uint64_t epoch = _epoch.load(std::memory_order_seq_cst);
+            _readers[epoch & 1].fetch_add(1, std::memory_order_seq_cst);
+            if(_epoch.load(std::memory_order_seq_cst) == epoch) { return epoch; }
+            _readers[epoch & 1].fetch_sub(1, std::memory_order_release);
         }
-        
-        array->put(bottom, item);
-        std::atomic_thread_fence(std::memory_order_release);
-        _bottom.store(bottom + 1, std::memory_order_relaxed);
-        
+    }
+
+    void leave(uint64_t epoch) noexcept
+    {
+        _readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+    }
+
+    // 직전 epoch의 steal이 모두 끝났으면 epoch를 넘기고, 두 번 넘어간 배열을 해제
+    void reclaim()
+    {
+        for(int32_t i = 0; i < 2; ++i)
+        {
+            const uint64_t epoch = _epoch.load(std::memory_order_relaxed);
+            if(_readers[(epoch + 1) & 1].load(std::memory_order_acquire) != 0) { break; }
+            _epoch.store(epoch + 1, std::memory_order_seq_cst);
+        }
+
+        const uint64_t epoch = _epoch.load(std::memory_order_relaxed);
+        size_t kept = 0;
+        for(auto& retired : _retired)
+        {
+            if(retired._epoch + 2 <= epoch) { delete retired._array; }
+            else { _retired[kept++] = retired; }
+        }
+        _retired.resize(kept);
+    }
+
+    // 배열에 남은 원소를 size 크기의 새 배열로 옮김
+    // top 아래라도 steal이 인덱스만 확보하고 아직 꺼내지 않은 원소가 있으므로 배열 전체 범위를 확인한다
+    CircularArray* relocate(CircularArray* array, int64_t bottom, int64_t size)
+    {
+        auto* next = new CircularArray(size);
+        for(int64_t i = std::max<int64_t>(bottom - array->_size, 0); i < bottom; ++i)
+        {
+            Slot& from = array->at(i);
+            uint64_t expected = state(i, FULL);
+            if(from._state.compare_exchange_strong(expected, state(i, MOVED), std::memory_order_acq_rel))
+            {
+                Slot& to = next->at(i);
+                new (to._data) T(std::move(*from.item()));
+                from.item()->~T();
+                to._state.store(state(i, FULL), std::memory_order_relaxed);
+            }
+        }
+        _array.store(next, std::memory_order_release);
+        _retired.push_back({array, _epoch.load(std::memory_order_relaxed)});
+        _resizeCount.fetch_add(1, std::memory_order_relaxed);
+        reclaim();
+        return next;
+    }
+
+    // 아직 꺼내지지 않은 가장 작은 인덱스
+    int64_t lowest(CircularArray* array, int64_t bottom) noexcept
+    {
+        int64_t i = std::max<int64_t>(bottom - array->_size, 0);
+        while(i < bottom && array->at(i)._state.load(std::memory_order_acquire) != state(i, FULL)) { ++i; }
+        return i;
+    }
+
+    // 인덱스의 소유권을 가진 스레드가 원소를 꺼냄
+    bool take(Slot& slot, int64_t index, T& result)
+    {
+        uint64_t expected = state(index, FULL);
+        if(!slot._state.compare_exchange_strong(expected, state(index, TAKEN), std::memory_order_acq_rel)) { return false; }
+        result = std::move(*slot.item());
+        slot.item()->~T();
+        slot._state.store(state(index, FREE), std::memory_order_release);
+        return true;
+    }
+
+public:
+    // 소유자 스레드가 bottom에 작업 추가
+    template <typename ... Args>
+    void emplace(Args&&... args)
+    {
+        const int64_t bottom = _bottom.load(std::memory_order_relaxed);
+        const int64_t top = _top.load(std::memory_order_acquire);
+        CircularArray* array = _array.load(std::memory_order_relaxed);
+
+        // 가득 찼거나, 한 바퀴 전 원소를 steal이 아직 꺼내지 않았으면 두 배로 확장
+        if(bottom - top >= array->_size ||
+           (array->at(bottom)._state.load(std::memory_order_acquire) & TAG_MASK) != FREE)
+        {
+            array = relocate(array, bottom, array->_size * 2);
+        }
+
+        Slot& slot = array->at(bottom);
+        new (slot._data) T(std::forward<Args>(args)...);
+        slot._state.store(state(bottom, FULL), std::memory_order_relaxed);
+        _bottom.store(bottom + 1, std::memory_order_release);
+
         // 최대 크기 추적
-        size_t currentSize = bottom - top + 1;
+        const size_t currentSize = static_cast<size_t>(bottom - top + 1);
         size_t maxSize = _maxSize.load(std::memory_order_relaxed);
-        while (currentSize > maxSize && 
+        while (currentSize > maxSize &&
                !_maxSize.compare_exchange_weak(maxSize, currentSize, std::memory_order_relaxed)) {
             // CAS 재시도
         }
     }
 
+    void push(const T& item) { emplace(item); }
+    void push(T&& item) { emplace(std::move(item)); }
+
     // 소유자 스레드가 bottom에서 작업 제거
     bool pop(T& result)
     {
-        size_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
-        auto array = _array.load(std::memory_order_relaxed);
+        const int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+        CircularArray* array = _array.load(std::memory_order_relaxed);
         _bottom.store(bottom, std::memory_order_relaxed);
-        
+
         std::atomic_thread_fence(std::memory_order_seq_cst);
-        size_t top = _top.load(std::memory_order_relaxed);
-        
-        if (top <= bottom)
-        {
-            // 큐에 작업이 있음
-            result = array->get(bottom);
-            
-            if (top == bottom)
-            {
-                // 마지막 작업인 경우 경쟁 상황 체크
-                if (!_top.compare_exchange_strong(top, top + 1, 
-                    std::memory_order_seq_cst, std::memory_order_relaxed))
-                {
-                    // steal에 의해 이미 가져감
-                    _bottom.store(bottom + 1, std::memory_order_relaxed);
-                    return false;
-                }
-                _bottom.store(bottom + 1, std::memory_order_relaxed);
-            }
-            return true;
-        }
-        else
+        int64_t top = _top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
         {
             // 큐가 비어있음
             _bottom.store(bottom + 1, std::memory_order_relaxed);
             return false;
         }
+        if (top == bottom)
+        {
+            // 마지막 작업인 경우 경쟁 상황 체크
+            const bool won = _top.compare_exchange_strong(top, top + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            if (!won) { return false; }   // steal에 의해 이미 가져감
+        }
+
+        // bottom 인덱스는 소유자만 접근하므로 CAS 없이 꺼냄
+        Slot& slot = array->at(bottom);
+        result = std::move(*slot.item());
+        slot.item()->~T();
+        slot._state.store(state(bottom, FREE), std::memory_order_relaxed);
+
+        // 사용률이 1/8 미만이면 절반으로 축소
+        const int64_t end = _bottom.load(std::memory_order_relaxed);
+        if (array->_size > _initialSize && end - _top.load(std::memory_order_relaxed) < array->_size / 8 &&
+            end - lowest(array, end) < array->_size / 2)
+        {
+            relocate(array, end, array->_size / 2);
+        }
+        return true;
     }
 
     // 다른 스레드가 top에서 작업 훔쳐가기
     bool steal(T& result)
     {
-        size_t top = _top.load(std::memory_order_acquire);
+        const uint64_t epoch = enter();
+        int64_t top = _top.load(std::memory_order_acquire);
         std::atomic_thread_fence(std::memory_order_seq_cst);
-        size_t bottom = _bottom.load(std::memory_order_acquire);
-        
-        if (top < bottom)
+        const int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+        bool stolen = false;
+        if (top < bottom &&
+            _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
         {
-            auto array = _array.load(std::memory_order_consume);
-            result = array->get(top);
-            
-            if (!_top.compare_exchange_strong(top, top + 1,
-                std::memory_order_seq_cst, std::memory_order_relaxed))
+            // 인덱스를 확보했으므로 소유자가 옮기는 중이면 새 배열이 게시될 때까지 재시도
+            while (!take(_array.load(std::memory_order_acquire)->at(top), top, result))
             {
-                return false;  // 다른 스레드가 먼저 steal함
+                std::this_thread::yield();
             }
-            return true;
+            stolen = true;
         }
-        
-        return false;  // 큐가 비어있음
+        leave(epoch);
+        return stolen;  // 비어있거나 다른 스레드가 먼저 steal함
     }
 
     // 큐가 비어있는지 확인 (정확하지 않을 수 있음, 힌트용)
     bool empty() const
     {
-        size_t bottom = _bottom.load(std::memory_order_relaxed);
-        size_t top = _top.load(std::memory_order_relaxed);
+        const int64_t bottom = _bottom.load(std::memory_order_relaxed);
+        const int64_t top = _top.load(std::memory_order_relaxed);
         return top >= bottom;
-    }    // 큐의 대략적인 크기 (정확하지 않을 수 있음, 힌트용)
+    }
+
+    // 큐의 대략적인 크기 (정확하지 않을 수 있음, 힌트용)
     size_t size() const
     {
-        size_t bottom = _bottom.load(std::memory_order_relaxed);
-        size_t top = _top.load(std::memory_order_relaxed);
-        return bottom >= top ? bottom - top : 0;
+        const int64_t bottom = _bottom.load(std::memory_order_relaxed);
+        const int64_t top = _top.load(std::memory_order_relaxed);
+        return bottom >= top ? static_cast<size_t>(bottom - top) : 0;
     }
-    
-    // 성능 통계 조회
+
+    // 성능 통계 조회 (getCapacity는 소유자 스레드 전용)
     size_t getResizeCount() const { return _resizeCount.load(std::memory_order_relaxed); }
     size_t getMaxSize() const { return _maxSize.load(std::memory_order_relaxed); }
-    size_t getCapacity() const { return _array.load(std::memory_order_relaxed)->_size; }
+    size_t getCapacity() const { return static_cast<size_t>(_array.load(std::memory_order_relaxed)->_size); }
 };
 
 } // v2
@@ -0,0 +1,265 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/NonCopyable.hpp"
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+namespace common
+{
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer queue
+ * 
+ * Vyukov ring: every cell carries a sequence number telling whether it is free for the
+ * producer of a given ticket or full for its consumer, so each side only contends on its own index
+ * with a single CAS per operation (per batch with push_batch/pop_batch).
+ * 
+ * A ticket is claimed before its element is constructed. If the constructor throws, the cell is
+ * published as a skip entry that consumers step over, so the ring keeps moving, and the exception is rethrown.
+ * Consumers cannot give a claimed element back, so taking one out must not throw.
+ * 
+ * @note Capacity is rounded up to a power of two.
+ */
+template <typename T>
+class alignas(64) MpmcQueue : public NonCopyable
+{
+public :
+    using value_type = T;
+
+private :
+    struct Cell
+    {
+        std::atomic<size_t> _sequence;
+        bool _skip = false;     // no element, its constructor threw; published by _sequence
+        alignas(T) unsigned char _data[sizeof(T)];
+    };
+
+    const size_t _capacity;
+    const size_t _mask;
+    std::unique_ptr<Cell[]> _cells;
+
+    alignas(64) std::atomic<size_t> _head{0};   // next ticket of consumers
+    alignas(64) std::atomic<size_t> _tail{0};   // next ticket of producers
+
+private :
+    static constexpr auto round_up(size_t value) -> size_t
+    {
+        size_t capacity = 1;
+        while(capacity < value) { capacity <<= 1; }
+        return capacity;
+    }
+
+    static auto item(Cell& cell) noexcept -> T* { return std::launder(reinterpret_cast<T*>(cell._data)); }
+
+    static auto distance(size_t sequence, size_t expected) noexcept -> intptr_t
+    {
+        return static_cast<intptr_t>(sequence - expected);
+    }
+
+    /**
+     * @brief Claims up to count consecutive tickets whose cells have sequence ticket + offset
+     * 
+     * @return size_t Number of tickets claimed from ticket, 0 if the first cell is not ready
+     */
+    auto claim(std::atomic<size_t>& index, size_t& ticket, const size_t count, const size_t offset) noexcept -> size_t
+    {
+        ticket = index.load(std::memory_order_relaxed);
+        while(true)
+        {
+            size_t ready = 0;
+            while(ready < count &&
+                  _cells[(ticket + ready) & _mask]._sequence.load(std::memory_order_acquire) == ticket + ready + offset)
+            {
+                ++ready;
+            }
+
+            if(ready == 0)
+            {
+                const size_t sequence = _cells[ticket & _mask]._sequence.load(std::memory_order_acquire);
+                if(distance(sequence, ticket + offset) < 0) { return 0; }    // full for producers, empty for consumers
+                ticket = index.load(std::memory_order_relaxed);              // another thread took the ticket
+                continue;
+            }
+            if(index.compare_exchange_weak(ticket, ticket + ready, std::memory_order_relaxed)) { return ready; }
+        }
+    }
+
+    // Publishes the claimed cells [_done, _count) from _ticket without elements when a constructor throws.
+    struct SkipGuard
+    {
+        MpmcQueue& _queue;
+        const size_t _ticket;
+        const size_t _count;
+        size_t _done = 0;
+
+        ~SkipGuard()
+        {
+            for(size_t i = _done; i < _count; ++i)
+            {
+                Cell& cell = _queue._cells[(_ticket + i) & _queue._mask];
+                cell._skip = true;
+                cell._sequence.store(_ticket + i + 1, std::memory_order_release);
+            }
+        }
+    };
+
+    // Frees a consumed cell for the producer one lap later.
+    auto release(Cell& cell, const size_t ticket) noexcept -> void
+    {
+        cell._skip = false;
+        cell._sequence.store(ticket + _capacity, std::memory_order_release);
+    }
+
+public :
+    explicit MpmcQueue(const size_t capacity)
+        : _capacity(round_up(capacity < 2 ? 2 : capacity)), _mask(_capacity - 1), _cells(new Cell[_capacity])
+    {
+        for(size_t i = 0; i < _capacity; ++i) { _cells[i]._sequence.store(i, std::memory_order_relaxed); }
+    }
+
+    ~MpmcQueue()
+    {
+        const size_t tail = _tail.load();
+        for(size_t head = _head.load(); head != tail; ++head)
+        {
+            if(!_cells[head & _mask]._skip) { item(_cells[head & _mask])->~T(); }
+        }
+    }
+
+public :
+    auto capacity() const noexcept -> size_t { return _capacity; }
+
+    /**
+     * @brief Gets the number of elements, approximate while other threads push or pop
+     */
+    auto size() const noexcept -> size_t
+    {
+        const size_t head = _head.load(std::memory_order_acquire);
+        const size_t tail = _tail.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+    auto empty() const noexcept -> bool { return size() == 0; }
+
+    /**
+     * @brief Constructs an element in place
+     * 
+     * @return bool false if the queue is full, args are then left untouched
+     */
+    template <typename ... Args>
+    auto try_emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) -> bool
+    {
+        size_t ticket = 0;
+        if(claim(_tail, ticket, 1, 0) == 0) { return false; }
+        SkipGuard guard{*this, ticket, 1};
+        Cell& cell = _cells[ticket & _mask];
+        new (cell._data) T(std::forward<Args>(args)...);
+        cell._sequence.store(ticket + 1, std::memory_order_release);
+        guard._done = 1;
+        return true;
+    }
+
+    auto try_push(const T& item) noexcept(std::is_nothrow_copy_constructible_v<T>) -> bool { return try_emplace(item); }
+    auto try_push(T&& item) noexcept(std::is_nothrow_move_constructible_v<T>) -> bool { return try_emplace(std::move(item)); }
+
+    /**
+     * @brief Copies as many consecutive free cells as are available, claimed with one CAS
+     * 
+     * @return size_t Number of items pushed
+     */
+    auto push_batch(const T* items, const size_t count) noexcept(std::is_nothrow_copy_constructible_v<T>) -> size_t
+    {
+        if(count == 0) { return 0; }
+        size_t ticket = 0;
+        const size_t pushed = claim(_tail, ticket, count, 0);
+        SkipGuard guard{*this, ticket, pushed};
+        for(; guard._done < pushed; ++guard._done)
+        {
+            Cell& cell = _cells[(ticket + guard._done) & _mask];
+            new (cell._data) T(items[guard._done]);
+            cell._sequence.store(ticket + guard._done + 1, std::memory_order_release);
+        }
+        return pushed;
+    }
+
+    /**
+     * @brief Takes the oldest element
+     */
+    auto try_pop() noexcept -> std::optional<T>
+    {
+        static_assert(std::is_nothrow_move_constructible_v<T>, "A claimed element cannot be given back.");
+        size_t ticket = 0;
+        while(claim(_head, ticket, 1, 1) != 0)
+        {
+            Cell& cell = _cells[ticket & _mask];
+            if(cell._skip)
+            {
+                release(cell, ticket);
+                continue;
+            }
+            std::optional<T> value(std::move(*item(cell)));
+            item(cell)->~T();
+            release(cell, ticket);
+            return value;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Moves up to count consecutive elements into out, claimed with one CAS
+     * 
+     * @return size_t Number of elements taken, 0 only if the queue is empty
+     */
+    auto pop_batch(T* out, const size_t count) noexcept -> size_t
+    {
+        static_assert(std::is_nothrow_move_assignable_v<T>, "A claimed element cannot be given back.");
+        if(count == 0) { return 0; }
+        size_t popped = 0;
+        while(popped == 0)
+        {
+            size_t ticket = 0;
+            const size_t claimed = claim(_head, ticket, count, 1);
+            if(claimed == 0) { break; }
+            for(size_t i = 0; i < claimed; ++i)
+            {
+                Cell& cell = _cells[(ticket + i) & _mask];
+                if(!cell._skip)
+                {
+                    out[popped++] = std::move(*item(cell));
+                    item(cell)->~T();
+                }
+                release(cell, ticket + i);
+            }
+        }
+        return popped;
+    }
+};
+} // namespace common
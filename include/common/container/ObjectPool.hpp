@@ -0,0 +1,173 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "CommonHeader.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace common
+{
+namespace detail
+{
+constexpr size_t POOL_MAX_BLOCK = 1024;                     /* larger requests bypass the pools */
+constexpr size_t POOL_ALIGNMENT = alignof(std::max_align_t);
+
+/**
+ * @brief Takes a block of at least size bytes from the size class pools
+ * 
+ * Every thread caches free blocks per size class and trades them with a central list a batch at a time,
+ * so the common case takes no lock. A block may be returned by any thread.
+ * 
+ * @param size 1 to POOL_MAX_BLOCK
+ * @throw std::bad_alloc if a new chunk cannot be allocated
+ */
+COMMON_LIB_API auto pool_allocate(size_t size) -> void*;
+
+/**
+ * @param size The size passed to pool_allocate()
+ */
+COMMON_LIB_API auto pool_deallocate(void* block, size_t size) noexcept -> void;
+} // namespace detail
+
+/**
+ * @brief Allocator drawing single objects from the size class pools
+ * 
+ * Arrays and over-aligned types go to the global operator new, so it also suits containers
+ * such as std::list or std::map whose nodes are allocated one at a time.
+ */
+template <typename T>
+class PoolAllocator
+{
+public :
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+    auto allocate(size_t count) -> T*
+    {
+        if(pooled(count)) { return static_cast<T*>(detail::pool_allocate(sizeof(T) * count)); }
+        return static_cast<T*>(::operator new(sizeof(T) * count));
+    }
+
+    auto deallocate(T* pointer, size_t count) noexcept -> void
+    {
+        if(pooled(count)) { detail::pool_deallocate(pointer, sizeof(T) * count); }
+        else { ::operator delete(pointer); }
+    }
+
+    template <typename U>
+    auto operator==(const PoolAllocator<U>&) const noexcept -> bool { return true; }
+    template <typename U>
+    auto operator!=(const PoolAllocator<U>&) const noexcept -> bool { return false; }
+
+private :
+    static constexpr auto pooled(size_t count) noexcept -> bool
+    {
+        return alignof(T) <= detail::POOL_ALIGNMENT && count <= detail::POOL_MAX_BLOCK / sizeof(T);
+    }
+};
+
+/**
+ * @brief Fixed-size object pool for hot-path objects
+ * 
+ * Objects come from the thread-caching pool of their size class instead of the global heap.
+ * 
+ * @tparam T At most 1024 bytes and fundamentally aligned
+ */
+template <typename T>
+class ObjectPool
+{
+    static_assert(sizeof(T) <= detail::POOL_MAX_BLOCK, "ObjectPool requires objects of at most 1024 bytes.");
+    static_assert(alignof(T) <= detail::POOL_ALIGNMENT, "ObjectPool requires fundamentally aligned objects.");
+
+public :
+    struct Deleter
+    {
+        auto operator()(T* object) const noexcept -> void
+        {
+            object->~T();
+            detail::pool_deallocate(object, sizeof(T));
+        }
+    };
+
+    using Pointer = std::unique_ptr<T, Deleter>;
+
+public :
+    template <typename... Args>
+    static auto make_unique(Args&&... args) -> Pointer
+    {
+        void* block = detail::pool_allocate(sizeof(T));
+        try
+        {
+            return Pointer(new (block) T(std::forward<Args>(args)...));
+        }
+        catch(...)
+        {
+            detail::pool_deallocate(block, sizeof(T));
+            throw;
+        }
+    }
+
+    /**
+     * @brief Allocates the object and its reference count as one pooled block
+     */
+    template <typename... Args>
+    static auto make_shared(Args&&... args) -> std::shared_ptr<T>
+    {
+        return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(args)...);
+    }
+};
+
+/**
+ * @brief std::pmr::memory_resource serving small requests from the size class pools
+ * 
+ * Requests larger than 1024 bytes or over-aligned go to the upstream resource.
+ */
+class COMMON_LIB_API PoolResource final : public std::pmr::memory_resource
+{
+private :
+    std::pmr::memory_resource* _upstream;
+
+public :
+    explicit PoolResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept;
+
+    /**
+     * @brief Gets the process-wide instance, used as the default resource of TaskExecutor, EventBus and ActiveRunnable
+     */
+    static auto get() noexcept -> PoolResource*;
+
+private :
+    auto do_allocate(size_t bytes, size_t alignment) -> void* override;
+    auto do_deallocate(void* pointer, size_t bytes, size_t alignment) -> void override;
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override;
+};
+} // namespace common
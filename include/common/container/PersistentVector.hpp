@@ -0,0 +1,397 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace common
+{
+/**
+ * @brief Immutable vector whose modifications return a new version sharing most of the old one
+ * 
+ * Elements are kept in a B-tree of chunks counted by size. push_back, insert, erase and set copy only
+ * the O(log n) nodes on the path to the element, every other node is shared with the previous version,
+ * so a version can be read by any number of threads while newer ones are built.
+ * 
+ * @tparam T Copy constructible
+ */
+template <typename T>
+class PersistentVector
+{
+private :
+    static constexpr size_t BRANCH = 32;    /* maximum elements of a leaf and children of a branch */
+    static constexpr size_t MERGE = BRANCH / 4;
+
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+
+    struct Node
+    {
+        bool _leaf = true;
+        size_t _size = 0;                   /* elements below this node */
+        std::vector<T> _items;              /* leaf */
+        std::vector<NodePtr> _children;     /* branch */
+
+        auto count() const noexcept -> size_t { return _leaf ? _items.size() : _children.size(); }
+    };
+
+    NodePtr _root;
+
+private :
+    explicit PersistentVector(NodePtr root) noexcept : _root(std::move(root)) {}
+
+    static auto make_branch(std::vector<NodePtr> children) -> std::shared_ptr<Node>
+    {
+        auto node = std::make_shared<Node>();
+        node->_leaf = false;
+        for(const auto& child : children) { node->_size += child->_size; }
+        node->_children = std::move(children);
+        return node;
+    }
+
+    static auto make_leaf(std::vector<T> items) -> std::shared_ptr<Node>
+    {
+        auto node = std::make_shared<Node>();
+        node->_size = items.size();
+        node->_items = std::move(items);
+        return node;
+    }
+
+    // Finds the child holding index and makes index relative to it.
+    static auto locate(const Node& node, size_t& index) noexcept -> size_t
+    {
+        size_t child = 0;
+        while(index >= node._children[child]->_size)
+        {
+            index -= node._children[child]->_size;
+            ++child;
+        }
+        return child;
+    }
+
+    // Node to modify in place, copied first unless this tree is its only owner.
+    static auto edit(NodePtr& ptr) -> Node&
+    {
+        if(ptr.use_count() != 1) { ptr = std::make_shared<Node>(*ptr); }
+        else { std::atomic_thread_fence(std::memory_order_acquire); }   /* former owners are done with it */
+        return const_cast<Node&>(*ptr);
+    }
+
+    // Inserts item, returns the right half split off if the node overflowed.
+    template <typename Item>
+    static auto insert(NodePtr& ptr, size_t index, Item&& item) -> NodePtr
+    {
+        Node& node = edit(ptr);
+        if(node._leaf)
+        {
+            const bool append = index == node._items.size();
+            node._items.insert(node._items.begin() + index, std::forward<Item>(item));
+            node._size = node._items.size();
+            if(node._size <= BRANCH) { return nullptr; }
+
+            // appending keeps the left leaf full so that push_back builds a dense tree
+            const size_t half = append ? BRANCH : node._size / 2;
+            std::vector<T> right(std::make_move_iterator(node._items.begin() + half), std::make_move_iterator(node._items.end()));
+            node._items.erase(node._items.begin() + half, node._items.end());
+            node._size = half;
+            return make_leaf(std::move(right));
+        }
+
+        // appending goes to the last child
+        size_t child = node._children.size() - 1;
+        if(index < node._size) { child = locate(node, index); }
+        else { index -= node._size - node._children.back()->_size; }
+        ++node._size;
+
+        NodePtr right = insert(node._children[child], index, std::forward<Item>(item));
+        if(!right) { return nullptr; }
+        node._children.insert(node._children.begin() + child + 1, std::move(right));
+        if(node._children.size() <= BRANCH) { return nullptr; }
+
+        const size_t half = child + 2 == node._children.size() ? BRANCH : node._children.size() / 2;
+        auto second = make_branch(std::vector<NodePtr>(node._children.begin() + half, node._children.end()));
+        node._children.erase(node._children.begin() + half, node._children.end());
+        node._size -= second->_size;
+        return second;
+    }
+
+    // Removes the element, leaves ptr null if the node became empty.
+    static auto erase(NodePtr& ptr, size_t index) -> void
+    {
+        if(ptr->_size == 1) { ptr = nullptr; return; }
+
+        Node& node = edit(ptr);
+        --node._size;
+        if(node._leaf)
+        {
+            node._items.erase(node._items.begin() + index);
+            return;
+        }
+
+        auto& children = node._children;
+        const size_t child = locate(node, index);
+        erase(children[child], index);
+        if(!children[child])
+        {
+            children.erase(children.begin() + child);
+            return;
+        }
+
+        // keeps nodes from thinning out: a small child is merged with a neighbour when both fit in one node
+        if(children[child]->count() < MERGE && children.size() > 1)
+        {
+            const size_t first = child + 1 < children.size() ? child : child - 1;
+            if(children[first]->count() + children[first + 1]->count() <= BRANCH)
+            {
+                merge(children[first], *children[first + 1]);
+                children.erase(children.begin() + first + 1);
+            }
+        }
+    }
+
+    static auto merge(NodePtr& left, const Node& right) -> void
+    {
+        Node& node = edit(left);
+        node._size += right._size;
+        if(node._leaf) { node._items.insert(node._items.end(), right._items.begin(), right._items.end()); }
+        else { node._children.insert(node._children.end(), right._children.begin(), right._children.end()); }
+    }
+
+    static auto set(NodePtr& ptr, size_t index, const T& item) -> void
+    {
+        Node& node = edit(ptr);
+        if(node._leaf)
+        {
+            node._items[index] = item;
+            return;
+        }
+        const size_t child = locate(node, index);
+        set(node._children[child], index, item);
+    }
+
+    template <typename Visitor>
+    static auto for_each_span(const Node& node, Visitor& visitor) -> void
+    {
+        if(node._leaf) { visitor(node._items.data(), node._items.size()); return; }
+        for(const auto& child : node._children) { for_each_span(*child, visitor); }
+    }
+
+    // Leaf holding index, with index made relative to it.
+    auto find_leaf(size_t& index) const noexcept -> const Node*
+    {
+        const Node* node = _root.get();
+        while(!node->_leaf) { node = node->_children[locate(*node, index)].get(); }
+        return node;
+    }
+
+public :
+    /**
+     * @brief Forward iterator, walks leaf by leaf
+     */
+    class const_iterator
+    {
+    private :
+        std::vector<std::pair<const Node*, size_t>> _path;     /* branches above _leaf and the child taken */
+        const Node* _leaf = nullptr;
+        size_t _index = 0;      /* in the vector */
+        size_t _offset = 0;     /* in _leaf */
+
+        auto descend(const Node* node, size_t index) -> void
+        {
+            while(!node->_leaf)
+            {
+                const size_t child = locate(*node, index);
+                _path.emplace_back(node, child);
+                node = node->_children[child].get();
+            }
+            _leaf = node;
+            _offset = index;
+        }
+
+        auto next_leaf() -> void
+        {
+            while(!_path.empty() && _path.back().second + 1 == _path.back().first->_children.size()) { _path.pop_back(); }
+            if(_path.empty()) { return; }
+
+            auto& [branch, child] = _path.back();
+            ++child;
+            descend(branch->_children[child].get(), 0);
+        }
+
+    public :
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() = default;
+        const_iterator(const PersistentVector* vector, size_t index) : _index(index)
+        {
+            if(_index < vector->size()) { descend(vector->_root.get(), index); }
+        }
+
+        auto operator*() const -> reference { return _leaf->_items[_offset]; }
+        auto operator->() const -> pointer { return &_leaf->_items[_offset]; }
+        auto operator++() -> const_iterator&
+        {
+            ++_index;
+            if(++_offset == _leaf->_items.size()) { next_leaf(); }
+            return *this;
+        }
+        auto operator++(int) -> const_iterator
+        {
+            const_iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+        auto operator==(const const_iterator& other) const -> bool { return _index == other._index; }
+        auto operator!=(const const_iterator& other) const -> bool { return _index != other._index; }
+    };
+
+public :
+    PersistentVector() = default;
+
+    auto size() const noexcept -> size_t { return _root ? _root->_size : 0; }
+    auto empty() const noexcept -> bool { return size() == 0; }
+
+    /**
+     * @brief Gets an element in O(log n)
+     */
+    auto operator[](size_t index) const -> const T&
+    {
+        const Node* leaf = find_leaf(index);
+        return leaf->_items[index];
+    }
+
+    auto at(size_t index) const -> const T&
+    {
+        if(index >= size()) { throw std::out_of_range("PersistentVector index out of range"); }
+        return (*this)[index];
+    }
+
+    auto begin() const -> const_iterator { return const_iterator(this, 0); }
+    auto end() const -> const_iterator { return const_iterator(this, size()); }
+
+    /**
+     * @brief Calls visitor(const T* data, size_t size) for every leaf in order
+     * 
+     * Leaves are contiguous, so loops over them vectorize where the element iterator does not.
+     */
+    template <typename Visitor>
+    auto for_each_span(Visitor&& visitor) const -> void
+    {
+        if(_root) { for_each_span(*_root, visitor); }
+    }
+
+    /**
+     * @brief Returns a version with item inserted before index
+     */
+    auto insert(size_t index, const T& item) const -> PersistentVector
+    {
+        PersistentVector next(*this);
+        next.insert_in_place(index, item);
+        return next;
+    }
+
+    auto insert(size_t index, T&& item) const -> PersistentVector
+    {
+        PersistentVector next(*this);
+        next.insert_in_place(index, std::move(item));
+        return next;
+    }
+
+    auto push_back(const T& item) const -> PersistentVector { return insert(size(), item); }
+    auto push_back(T&& item) const -> PersistentVector { return insert(size(), std::move(item)); }
+
+    /**
+     * @brief Returns a version without the element at index
+     */
+    auto erase(size_t index) const -> PersistentVector
+    {
+        PersistentVector next(*this);
+        next.erase_in_place(index);
+        return next;
+    }
+
+    /**
+     * @brief Returns a version with the element at index replaced
+     */
+    auto set(size_t index, const T& item) const -> PersistentVector
+    {
+        PersistentVector next(*this);
+        next.set_in_place(index, item);
+        return next;
+    }
+
+    /**
+     * @brief Modifies this version, copying only the nodes it shares with other versions
+     * 
+     * Nodes already copied by an earlier in-place call are modified directly, so a batch of
+     * modifications on one version copies each shared node at most once.
+     * Must not be called on a version other threads are reading.
+     */
+    auto insert_in_place(size_t index, const T& item) -> void { emplace_in_place(index, item); }
+    auto insert_in_place(size_t index, T&& item) -> void { emplace_in_place(index, std::move(item)); }
+
+    auto push_back_in_place(const T& item) -> void { insert_in_place(size(), item); }
+    auto push_back_in_place(T&& item) -> void { insert_in_place(size(), std::move(item)); }
+
+    auto erase_in_place(size_t index) -> void
+    {
+        if(index >= size()) { throw std::out_of_range("PersistentVector index out of range"); }
+        erase(_root, index);
+        while(_root && !_root->_leaf && _root->_children.size() == 1) { _root = NodePtr(_root->_children.front()); }
+    }
+
+    auto set_in_place(size_t index, const T& item) -> void
+    {
+        if(index >= size()) { throw std::out_of_range("PersistentVector index out of range"); }
+        set(_root, index, item);
+    }
+
+private :
+    template <typename Item>
+    auto emplace_in_place(size_t index, Item&& item) -> void
+    {
+        if(index > size()) { throw std::out_of_range("PersistentVector index out of range"); }
+        if(!_root)
+        {
+            std::vector<T> items;
+            items.push_back(std::forward<Item>(item));
+            _root = make_leaf(std::move(items));
+            return;
+        }
+        NodePtr right = insert(_root, index, std::forward<Item>(item));
+        if(right) { _root = make_branch({_root, std::move(right)}); }
+    }
+};
+} // namespace common
@@ -0,0 +1,193 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace common
+{
+namespace detail
+{
+constexpr uint32_t SEQLOCK_SPINS = 64;   /* failed reads before a reader yields */
+} // namespace detail
+
+/**
+ * @brief Latest-value cell written without waiting and read without locks
+ * 
+ * The writer makes the sequence odd, copies the value and makes it even again; a reader copies the value
+ * between two reads of the sequence and retries if they differ or are odd. The value is held in relaxed
+ * atomic words, so a torn copy is discarded without a data race.
+ * 
+ * @warning store() must come from a single writer thread at a time.
+ * 
+ * @tparam T Trivially copyable, for large T prefer LatestValue so that readers rarely retry
+ */
+template <typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock requires a trivially copyable type.");
+
+private :
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    alignas(64) std::atomic<uint64_t> _sequence{0};
+    std::array<std::atomic<uint64_t>, WORDS> _words{};
+
+public :
+    SeqLock() noexcept = default;
+    explicit SeqLock(const T& value) noexcept { store(value); }
+
+    SeqLock(const SeqLock&) = delete;
+    auto operator=(const SeqLock&) -> SeqLock& = delete;
+
+public :
+    /**
+     * @brief Replaces the value, never waits
+     */
+    auto store(const T& value) noexcept -> void
+    {
+        uint64_t words[WORDS];
+        words[WORDS - 1] = 0;   /* padding of a partial last word */
+        std::memcpy(words, &value, sizeof(T));
+
+        const uint64_t sequence = _sequence.load(std::memory_order_relaxed);
+        _sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for(size_t i = 0; i < WORDS; ++i) { _words[i].store(words[i], std::memory_order_relaxed); }
+        _sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copies the value once
+     * 
+     * @return bool false if a store() overlapped the copy, value is then unspecified
+     */
+    auto try_load(T& value) const noexcept -> bool
+    {
+        uint64_t words[WORDS];
+        const uint64_t before = _sequence.load(std::memory_order_acquire);
+        if(before & 1) { return false; }
+        for(size_t i = 0; i < WORDS; ++i) { words[i] = _words[i].load(std::memory_order_relaxed); }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(_sequence.load(std::memory_order_relaxed) != before) { return false; }
+
+        std::memcpy(&value, words, sizeof(T));
+        return true;
+    }
+
+    /**
+     * @brief Copies the value, retrying while store() overlaps
+     */
+    auto load() const noexcept -> T
+    {
+        T value;
+        for(uint32_t retry = 1; !try_load(value); ++retry)
+        {
+            if(retry % detail::SEQLOCK_SPINS == 0) { std::this_thread::yield(); }  /* the writer may have been preempted */
+        }
+        return value;
+    }
+
+    /**
+     * @brief Gets the number of stores so far, readers can compare it to skip unchanged values
+     */
+    auto get_version() const noexcept -> uint64_t
+    {
+        return _sequence.load(std::memory_order_acquire) / 2;
+    }
+};
+
+/**
+ * @brief Latest-value cell for large values, rotating through several SeqLock slots
+ * 
+ * Each store() goes into the slot after the published one, so a reader copying the newest value
+ * only retries when the writer laps all the other slots during the copy.
+ * 
+ * @warning store() must come from a single writer thread at a time.
+ * 
+ * @tparam T Trivially copyable
+ * @tparam Slots At least 2
+ */
+template <typename T, size_t Slots = 4>
+class LatestValue
+{
+    static_assert(Slots >= 2, "LatestValue requires at least 2 slots.");
+
+private :
+    alignas(64) std::atomic<uint64_t> _version{0};     /* stores so far, the newest is in slot _version % Slots */
+    std::array<SeqLock<T>, Slots> _slots;
+
+public :
+    LatestValue() noexcept = default;
+    explicit LatestValue(const T& value) noexcept { _slots[0].store(value); }
+
+public :
+    /**
+     * @brief Replaces the value, never waits
+     */
+    auto store(const T& value) noexcept -> void
+    {
+        const uint64_t version = _version.load(std::memory_order_relaxed) + 1;
+        _slots[version % Slots].store(value);
+        _version.store(version, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copies the newest value once
+     * 
+     * @return bool false if the writer lapped the slot during the copy, value is then unspecified
+     */
+    auto try_load(T& value) const noexcept -> bool
+    {
+        return _slots[_version.load(std::memory_order_acquire) % Slots].try_load(value);
+    }
+
+    /**
+     * @brief Copies the newest value, retrying while the writer laps the slot
+     */
+    auto load() const noexcept -> T
+    {
+        T value;
+        for(uint32_t retry = 1; !try_load(value); ++retry)
+        {
+            if(retry % detail::SEQLOCK_SPINS == 0) { std::this_thread::yield(); }
+        }
+        return value;
+    }
+
+    /**
+     * @brief Gets the number of stores so far, readers can compare it to skip unchanged values
+     */
+    auto get_version() const noexcept -> uint64_t
+    {
+        return _version.load(std::memory_order_acquire);
+    }
+};
+} // namespace common
@@ -24,41 +24,111 @@ SOFTWARE.
 
 #pragma once
 
-#include <queue>
+#include <algorithm>
+#include <array>
+#include <stdexcept>
 #include <stdint.h>
+#include <type_traits>
+#include <utility>
 
 namespace common
 {
+/**
+ * @brief Fixed capacity FIFO that drops its oldest element when pushed while full, e.g. a sliding window of samples
+ * 
+ * Elements are stored inline in a ring whose size is _size rounded up to a power of two, so indexing is a mask
+ * and nothing is allocated after construction. Index 0 is the oldest element.
+ * spans() exposes the window as at most two contiguous ranges for vectorized processing.
+ * 
+ * @tparam _tp Default constructible and move assignable
+ * @tparam _size Maximum number of elements
+ */
 template <typename _tp, uint64_t _size>
 class SizedQueue
 {
     static_assert(_size != 0, "Size of the buffer must be greater than zero.");
+    static_assert(std::is_default_constructible_v<_tp>, "SizedQueue requires a default constructible type.");
 
 private :
-    std::queue<_tp> _q;
+    static constexpr auto round_up(uint64_t value) -> uint64_t
+    {
+        uint64_t capacity = 1;
+        while(capacity < value) { capacity <<= 1; }
+        return capacity;
+    }
+
+    static constexpr uint64_t STORAGE = round_up(_size);
+    static constexpr uint64_t MASK = STORAGE - 1;
+
+private :
+    alignas(64) std::array<_tp, STORAGE> _buffer{};
+    uint64_t _head = 0;
+    uint64_t _count = 0;
 
 public :
-    auto front() -> const _tp&
-    { 
-        return _q.front(); 
-    }
+    auto front() -> _tp& { return _buffer[_head & MASK]; }
+    auto front() const -> const _tp& { return _buffer[_head & MASK]; }
+
+    auto back() -> _tp& { return _buffer[(_head + _count - 1) & MASK]; }
+    auto back() const -> const _tp& { return _buffer[(_head + _count - 1) & MASK]; }
+
+    auto operator[](size_t index) -> _tp& { return _buffer[(_head + index) & MASK]; }
+    auto operator[](size_t index) const -> const _tp& { return _buffer[(_head + index) & MASK]; }
 
-    auto back() -> const _tp&
-    { 
-        return _q.back(); 
+    auto at(size_t index) -> _tp&
+    {
+        if(index >= _count) { throw std::out_of_range("SizedQueue index out of range"); }
+        return (*this)[index];
+    }
+    auto at(size_t index) const -> const _tp&
+    {
+        if(index >= _count) { throw std::out_of_range("SizedQueue index out of range"); }
+        return (*this)[index];
     }
 
-    auto empty() -> bool { return _q.empty(); }
-    auto size() -> size_t { return _q.size(); }
+    auto empty() const -> bool { return _count == 0; }
+    auto full() const -> bool { return _count == _size; }
+    auto size() const -> size_t { return _count; }
+    static constexpr auto capacity() -> size_t { return _size; }
 
     auto push_back(const _tp& x) -> void { emplace_back(x); }
     auto push_back(_tp&& x) -> void { emplace_back(std::move(x)); }
-    template <typename ...Args> auto push_back(Args&&... args) -> void { emplace_back(args...); }
-    template <typename ...Args> auto emplace_back(Args&&... args) -> void { 
-        if(_q.size() == _size) { _q.pop(); }
-        _q.emplace(args...); 
+    template <typename ...Args> auto push_back(Args&&... args) -> void { emplace_back(std::forward<Args>(args)...); }
+    template <typename ...Args> auto emplace_back(Args&&... args) -> void
+    {
+        if(_count == _size)
+        {
+            ++_head;
+            --_count;
+        }
+        _buffer[(_head + _count) & MASK] = _tp(std::forward<Args>(args)...);
+        ++_count;
+    }
+
+    auto pop_front() -> void
+    {
+        // releases what the element owns instead of waiting for it to be overwritten
+        if constexpr (!std::is_trivially_destructible_v<_tp>) { _buffer[_head & MASK] = _tp(); }
+        ++_head;
+        --_count;
     }
 
-    auto pop_front() -> void { _q.pop(); }
+    auto clear() -> void
+    {
+        while(_count != 0) { pop_front(); }
+        _head = 0;
+    }
+
+    /**
+     * @brief Gets the elements as two contiguous ranges, oldest first
+     * 
+     * The second range is empty unless the window wraps around the end of the ring.
+     */
+    auto spans() const -> std::array<std::pair<const _tp*, size_t>, 2>
+    {
+        const uint64_t offset = _head & MASK;
+        const uint64_t first = std::min(_count, STORAGE - offset);
+        return {{ {_buffer.data() + offset, first}, {_buffer.data(), _count - first} }};
+    }
 };
 } // namespace common
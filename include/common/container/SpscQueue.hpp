@@ -0,0 +1,196 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "common/NonCopyable.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+namespace common
+{
+/**
+ * @brief Bounded lock-free single-producer single-consumer queue
+ * 
+ * Lamport ring where each side keeps a cached copy of the other side's index,
+ * so the shared cache line is only read when the cached value says full or empty.
+ * Head and tail live on separate cache lines.
+ * 
+ * @note Capacity is rounded up to a power of two.
+ */
+template <typename T>
+class alignas(64) SpscQueue : public NonCopyable
+{
+public :
+    using value_type = T;
+
+private :
+    struct Slot
+    {
+        alignas(T) unsigned char _data[sizeof(T)];
+    };
+
+    const size_t _capacity;
+    const size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+
+    alignas(64) std::atomic<size_t> _head{0};   // written by consumer
+    size_t _cachedTail = 0;                     // consumer's view of _tail
+    alignas(64) std::atomic<size_t> _tail{0};   // written by producer
+    size_t _cachedHead = 0;                     // producer's view of _head
+
+private :
+    static constexpr auto round_up(size_t value) -> size_t
+    {
+        size_t capacity = 1;
+        while(capacity < value) { capacity <<= 1; }
+        return capacity;
+    }
+
+    auto at(size_t index) noexcept -> T* { return std::launder(reinterpret_cast<T*>(_slots[index & _mask]._data)); }
+
+public :
+    explicit SpscQueue(const size_t capacity)
+        : _capacity(round_up(capacity)), _mask(_capacity - 1), _slots(new Slot[_capacity]) {}
+
+    ~SpscQueue()
+    {
+        const size_t tail = _tail.load();
+        for(size_t head = _head.load(); head != tail; ++head) { at(head)->~T(); }
+    }
+
+public :
+    auto capacity() const noexcept -> size_t { return _capacity; }
+    auto size() const noexcept -> size_t { return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire); }
+    auto empty() const noexcept -> bool { return size() == 0; }
+
+    /**
+     * @brief [Producer] Constructs an element in place
+     * 
+     * @return bool false if the queue is full, args are then left untouched
+     */
+    template <typename ... Args>
+    auto try_emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) -> bool
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if(tail - _cachedHead == _capacity)
+        {
+            _cachedHead = _head.load(std::memory_order_acquire);
+            if(tail - _cachedHead == _capacity) { return false; }
+        }
+        new (_slots[tail & _mask]._data) T(std::forward<Args>(args)...);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    auto try_push(const T& item) noexcept(std::is_nothrow_copy_constructible_v<T>) -> bool { return try_emplace(item); }
+    auto try_push(T&& item) noexcept(std::is_nothrow_move_constructible_v<T>) -> bool { return try_emplace(std::move(item)); }
+
+    /**
+     * @brief [Producer] Copies as many items as fit, published at once
+     * 
+     * @return size_t Number of items pushed
+     */
+    auto push_batch(const T* items, const size_t count) noexcept(std::is_nothrow_copy_constructible_v<T>) -> size_t
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if(_capacity - (tail - _cachedHead) < count) { _cachedHead = _head.load(std::memory_order_acquire); }
+        const size_t pushed = std::min(count, _capacity - (tail - _cachedHead));
+        // nothing is published if a copy throws, the elements constructed so far are destroyed
+        struct Staging
+        {
+            SpscQueue& _queue;
+            const size_t _tail;
+            size_t _constructed = 0;
+            bool _published = false;
+
+            ~Staging()
+            {
+                if(_published) { return; }
+                for(size_t i = 0; i < _constructed; ++i) { _queue.at(_tail + i)->~T(); }
+            }
+        } staging{*this, tail};
+        for(; staging._constructed < pushed; ++staging._constructed)
+        {
+            new (_slots[(tail + staging._constructed) & _mask]._data) T(items[staging._constructed]);
+        }
+        staging._published = true;
+        _tail.store(tail + pushed, std::memory_order_release);
+        return pushed;
+    }
+
+    /**
+     * @brief [Consumer] Takes the oldest element
+     */
+    auto try_pop() noexcept(std::is_nothrow_move_constructible_v<T>) -> std::optional<T>
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if(head == _cachedTail)
+        {
+            _cachedTail = _tail.load(std::memory_order_acquire);
+            if(head == _cachedTail) { return std::nullopt; }
+        }
+        T* item = at(head);
+        std::optional<T> value(std::move(*item));
+        item->~T();
+        _head.store(head + 1, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief [Consumer] Moves up to count elements into out, released at once
+     * 
+     * @return size_t Number of elements taken
+     */
+    auto pop_batch(T* out, const size_t count) noexcept(std::is_nothrow_move_assignable_v<T>) -> size_t
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if(_cachedTail - head < count) { _cachedTail = _tail.load(std::memory_order_acquire); }
+        const size_t popped = std::min(count, _cachedTail - head);
+        // if a move throws, the elements already moved out are still released
+        struct Release
+        {
+            std::atomic<size_t>& _head;
+            const size_t _first;
+            size_t _taken = 0;
+
+            ~Release() { _head.store(_first + _taken, std::memory_order_release); }
+        } release{_head, head};
+        for(; release._taken < popped; ++release._taken)
+        {
+            T* item = at(head + release._taken);
+            out[release._taken] = std::move(*item);
+            item->~T();
+        }
+        return popped;
+    }
+};
+} // namespace common
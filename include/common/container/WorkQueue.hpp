@@ -24,8 +24,11 @@ SOFTWARE.
 
 #pragma once
 
+#include "common/container/ObjectPool.hpp"
+
 #include <deque>
 #include <memory>
+#include <memory_resource>
 #include <thread>
 #include <future>
 
@@ -40,40 +43,148 @@ namespace common
  * WorkQueue provides a thread-safe container for storing and managing tasks
  * that can be executed by worker threads. It supports both FIFO task retrieval
  * and work-stealing from the back of the queue for load balancing.
+ * Tasks and their result states are allocated from the queue's memory resource.
  */
 class WorkQueue
 {
+public :
+    /**
+     * @brief Move-only callable stored in the queue, allocated from a memory resource
+     * 
+     * Running a task never throws: an exception from the callable is caught and dropped.
+     */
+    class Task
+    {
+    private :
+        struct Base
+        {
+            std::pmr::memory_resource* _resource;
+
+            explicit Base(std::pmr::memory_resource* resource) noexcept : _resource(resource) {}
+            virtual ~Base() = default;
+            virtual auto run() -> void = 0;
+            virtual auto destroy() noexcept -> void = 0;
+        };
+
+        template <typename Function>
+        struct Callable final : Base
+        {
+            Function _function;
+
+            Callable(std::pmr::memory_resource* resource, Function&& function)
+                : Base(resource), _function(std::move(function)) {}
+
+            auto run() -> void override
+            {
+                // a worker has nobody to rethrow to, letting it escape would terminate the process
+                try { _function(); }
+                catch(...) {}
+            }
+            auto destroy() noexcept -> void override
+            {
+                auto resource = this->_resource;
+                this->~Callable();
+                resource->deallocate(this, sizeof(Callable), alignof(Callable));
+            }
+        };
+
+        Base* _callable = nullptr;
+
+    public :
+        Task() noexcept = default;
+        Task(std::nullptr_t) noexcept {}
+        Task(Task&& other) noexcept : _callable(std::exchange(other._callable, nullptr)) {}
+        ~Task() { if(_callable) { _callable->destroy(); } }
+
+        auto operator=(Task&& other) noexcept -> Task&
+        {
+            if(this != &other)
+            {
+                if(_callable) { _callable->destroy(); }
+                _callable = std::exchange(other._callable, nullptr);
+            }
+            return *this;
+        }
+
+        template <typename Function>
+        static auto make(std::pmr::memory_resource* resource, Function&& function) -> Task
+        {
+            using Type = Callable<std::decay_t<Function>>;
+            void* memory = resource->allocate(sizeof(Type), alignof(Type));
+            Task task;
+            try
+            {
+                task._callable = new (memory) Type(resource, std::decay_t<Function>(std::forward<Function>(function)));
+            }
+            catch(...)
+            {
+                resource->deallocate(memory, sizeof(Type), alignof(Type));
+                throw;
+            }
+            return task;
+        }
+
+        explicit operator bool() const noexcept { return _callable != nullptr; }
+        auto operator()() -> void { _callable->run(); }
+    };
+
 private :
-    std::deque<std::function<void()>> _tasks;
+    std::pmr::memory_resource* _resource;
+    std::deque<Task> _tasks;
     mutable std::mutex _lock;
     std::condition_variable _cv;
     
-public :          
+public :
+    /**
+     * @param resource Memory of the queued tasks and their futures, must outlive the queue
+     */
+    explicit WorkQueue(std::pmr::memory_resource* resource = PoolResource::get()) noexcept : _resource(resource) {}
+
+    /**
+     * @brief Adds a task whose result nobody waits for
+     * 
+     * Unlike push(), the callable is stored as is: no std::function, promise or future is allocated.
+     * An exception thrown by the callable is dropped, like one stored in a future nobody reads.
+     */
+    template <typename Function>
+    auto post(Function&& function) -> void
+    {
+        auto task = Task::make(_resource, std::forward<Function>(function));
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _tasks.push_back(std::move(task));
+        }
+
+        _cv.notify_one();
+    }
+          
     /**
      * @brief Adds a task to the work queue
      * @tparam ReturnType The return type of the task function
      * @param task The task function to be executed
      * @return A future object that can be used to retrieve the task result
      * 
-     * Wraps the task in a packaged_task and adds it to the queue. The task
+     * Pairs the task with a promise, both allocated from the queue's resource, and adds it to the queue. The task
      * will be executed asynchronously by a worker thread. Returns a future
      * that can be used to wait for completion and retrieve the result.
      */
     template <typename ReturnType>
     auto push(std::function<ReturnType()>&& task) noexcept -> std::future<ReturnType>
     {
-        using TaskType = std::packaged_task<ReturnType()>;
-        
-        auto packagedTask = std::make_shared<TaskType>(std::move(task));
-        std::future<ReturnType> future = packagedTask->get_future();
-        {
-            std::lock_guard<std::mutex> lock(_lock);
-            _tasks.emplace_back([task = std::move(packagedTask)]() { 
-                (*task)(); 
-            });
-        }
-        
-        _cv.notify_one();
+        std::promise<ReturnType> promise(std::allocator_arg, std::pmr::polymorphic_allocator<std::byte>(_resource));
+        std::future<ReturnType> future = promise.get_future();
+        post([task = std::move(task), promise = std::move(promise)]() mutable {
+            try
+            {
+                if constexpr (std::is_void_v<ReturnType>)
+                {
+                    task();
+                    promise.set_value();
+                }
+                else { promise.set_value(task()); }
+            }
+            catch(...) { promise.set_exception(std::current_exception()); }
+        });
         return future;
     }
 
@@ -85,7 +196,7 @@ public :
      * Blocks until a task is available or the system stops running. Uses condition
      * variable to efficiently wait for new tasks. Returns the first task in FIFO order.
      */
-    auto pop(const std::atomic<bool>& running) -> std::function<void()>
+    auto pop(const std::atomic<bool>& running) -> Task
     {
         std::unique_lock<std::mutex> lock(_lock);
         _cv.wait(lock, [this, &running]() {
@@ -120,7 +231,7 @@ public :
      * a task from the back of the queue. Used for work-stealing load balancing.
      * Returns nullptr if lock cannot be acquired or queue is empty.
      */
-    auto try_steal() -> std::function<void()>
+    auto try_steal() -> Task
     {
         std::unique_lock<std::mutex> lock(_lock, std::try_to_lock);
         if (!lock.owns_lock() || _tasks.empty()) {
@@ -0,0 +1,235 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+#include "common/Factory.hpp"
+#include "common/logging/LogSink.hpp"
+#include "common/logging/LogArgument.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace common
+{
+namespace detail
+{
+/*
+ * Binary log file layout, native byte order:
+ *   BinaryLogHeader, then 8 byte aligned records each starting with BinaryLogRecord.
+ *   A record with _size 0 ends the file (the rest of a segment is zero filled).
+ *   DICTIONARY : BinaryLogSite, signature, file and format as C strings. Written before the first EVENT of a site in every file.
+ *   EVENT      : BinaryLogEvent, then the arguments as captured by LogArgument.
+ *   TEXT       : BinaryLogText, then file and message as C strings. Records that were formatted before reaching the sink.
+ */
+struct BinaryLogHeader
+{
+    char _magic[8];             /* "CLBINLOG" */
+    uint32_t _version;
+    uint32_t _headerSize;
+    uint64_t _clockBase;        /* clock ticks at _realtimeBase */
+    uint64_t _realtimeBase;     /* system clock, ns since epoch */
+    double _ticksPerNs;
+};
+
+struct BinaryLogRecord
+{
+    enum type : uint32_t
+    {
+        DICTIONARY = 1,
+        EVENT,
+        TEXT,
+    };
+
+    uint32_t _size;             /* whole record, published last */
+    uint32_t _type;
+};
+
+struct BinaryLogSite
+{
+    BinaryLogRecord _record;
+    uint32_t _id;
+    LogLevel _level;
+    uint8_t _argc;
+    int32_t _line;
+};
+
+struct BinaryLogEvent
+{
+    BinaryLogRecord _record;
+    uint32_t _id;
+    uint32_t _thread;
+    uint64_t _clock;
+};
+
+struct BinaryLogText
+{
+    BinaryLogRecord _record;
+    LogLevel _level;
+    int32_t _line;
+    uint32_t _thread;
+    uint64_t _clock;
+};
+
+struct BinaryLogSegment;
+
+struct BinaryLogSlot
+{
+    uint8_t* _data;
+    BinaryLogSegment* _segment;
+    size_t _size;
+};
+} // namespace detail
+
+struct BinaryLogOptions
+{
+    size_t _segmentSize = 64 * 1024 * 1024;     /* bytes per file, preallocated and mapped */
+    uint32_t _maxFiles = 4;                     /* rolled files kept, older ones are deleted */
+};
+
+#if defined(LINUX)
+/**
+ * @brief Sink writing the captured arguments instead of the formatted text
+ * 
+ * Statements logged through the macros (or Logger::log with a LogSite) store the site id,
+ * a TSC (steady clock off x86) timestamp and the raw arguments straight into a memory-mapped file.
+ * Each site is described once per file by a dictionary record, so nothing is formatted at run time.
+ * Writers reserve space with a single atomic add and never block each other.
+ * 
+ * Files roll over at BinaryLogOptions::_segmentSize : path, path.1, path.2, ...
+ * Use BinaryLogReader or the binlog-decoder tool to read them back.
+ */
+class COMMON_LIB_API BinarySink : public LogSink
+                                , public Factory<BinarySink>
+{
+    friend class Factory<BinarySink>;
+
+private :
+    struct Detail;
+    std::unique_ptr<Detail> _detail;
+
+public :
+    explicit BinarySink(std::unique_ptr<Detail> detail) noexcept;
+    ~BinarySink() override;
+
+public :
+    template <typename ... Args>
+    auto log(detail::LogSite& site, Args ... args) noexcept -> void
+    {
+        if(!is_known(site._id.load(std::memory_order_acquire)) &&
+           !add_site(site, detail::LogSignature<Args ...>::VALUE, sizeof...(Args)))
+        {
+            return;
+        }
+
+        const size_t size = sizeof(detail::BinaryLogEvent) + (size_t(0) + ... + detail::LogArgument<Args>::size(args));
+        const detail::BinaryLogSlot slot = reserve(size);
+        if(slot._data == nullptr) { return; }
+
+        auto* event = reinterpret_cast<detail::BinaryLogEvent*>(slot._data);
+        event->_id = site._id.load(std::memory_order_relaxed);
+        event->_thread = detail::get_thread_id();
+        event->_clock = read_clock();
+        [[maybe_unused]] uint8_t* out = slot._data + sizeof(detail::BinaryLogEvent);
+        ((out = detail::LogArgument<Args>::encode(out, args)), ...);
+        publish(slot, detail::BinaryLogRecord::EVENT);
+    }
+
+    auto write(const LogRecord& record) noexcept -> void override;
+
+    /**
+     * @brief Does nothing, the mapped pages reach the file through the page cache
+     */
+    auto flush() noexcept -> void override;
+
+    /**
+     * @brief Gets the number of records lost because they were larger than a segment or the site table was full
+     */
+    auto get_dropped() const noexcept -> uint64_t;
+
+    static inline auto read_clock() noexcept -> uint64_t
+    {
+#if defined(__x86_64__) || defined(_M_X64)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+private :
+    auto is_known(uint32_t id) const noexcept -> bool;
+    auto add_site(detail::LogSite& site, const char* signature, size_t argc) noexcept -> bool;
+    auto reserve(size_t size) noexcept -> detail::BinaryLogSlot;
+    auto publish(const detail::BinaryLogSlot& slot, uint32_t type) noexcept -> void;
+
+private :
+    /**
+     * @return std::shared_ptr<BinarySink> nullptr if the first file cannot be created
+     */
+    static auto __create(const std::string& path, const BinaryLogOptions& options = BinaryLogOptions()) noexcept -> std::shared_ptr<BinarySink>;
+};
+#endif
+
+/**
+ * @brief Reads a binary log file back as formatted records
+ */
+class COMMON_LIB_API BinaryLogReader : public NonCopyable
+                                     , public Factory<BinaryLogReader>
+{
+    friend class Factory<BinaryLogReader>;
+
+private :
+    std::string _data;
+
+public :
+    explicit BinaryLogReader(std::string data) noexcept : _data(std::move(data)) {}
+
+public :
+    /**
+     * @brief Calls handler for every complete record in file order
+     * 
+     * @return size_t Number of records read
+     */
+    auto read(const std::function<void(const LogRecord&)>& handler) const noexcept -> size_t;
+
+private :
+    /**
+     * @return std::shared_ptr<BinaryLogReader> nullptr if the file cannot be read or is not a binary log
+     */
+    static auto __create(const std::string& path) noexcept -> std::shared_ptr<BinaryLogReader>;
+};
+} // namespace common
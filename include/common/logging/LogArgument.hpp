@@ -0,0 +1,142 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "CommonHeader.hpp"
+#include "common/logging/LogSink.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace common::detail
+{
+template <typename T, bool = std::is_enum_v<T>>
+struct LogUnderlying { using type = T; };
+
+template <typename T>
+struct LogUnderlying<T, true> { using type = std::underlying_type_t<T>; };
+
+/**
+ * @brief How an argument is captured for the async backend and the binary sink
+ * 
+ * Values are copied as is. Strings are copied by content since the pointer
+ * would be dangling by the time the record is formatted.
+ * TYPE tells the binary log decoder how to read the value back:
+ * c/C h/H i/I l/L signed/unsigned 1/2/4/8 bytes, f float, d double, D long double, p pointer, s string.
+ */
+template <typename T>
+struct LogArgument
+{
+    static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>,
+                  "Only printf compatible arguments can be logged.");
+
+    static constexpr auto type() noexcept -> char
+    {
+        using U = typename LogUnderlying<T>::type;
+        if constexpr (std::is_pointer_v<U>) { return 'p'; }
+        else if constexpr (std::is_floating_point_v<U>)
+        {
+            return sizeof(U) == sizeof(float) ? 'f' : (sizeof(U) == sizeof(double) ? 'd' : 'D');
+        }
+        else
+        {
+            constexpr const char* CODES = std::is_signed_v<U> ? "chil" : "CHIL";
+            return CODES[sizeof(U) == 1 ? 0 : (sizeof(U) == 2 ? 1 : (sizeof(U) == 4 ? 2 : 3))];
+        }
+    }
+    static constexpr char TYPE = type();
+
+    static auto size(const T&) noexcept -> size_t { return sizeof(T); }
+    static auto encode(uint8_t* out, const T& value) noexcept -> uint8_t*
+    {
+        std::memcpy(out, &value, sizeof(T));
+        return out + sizeof(T);
+    }
+    static auto decode(const uint8_t*& in) noexcept -> T
+    {
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        in += sizeof(T);
+        return value;
+    }
+};
+
+template <>
+struct LogArgument<const char*>
+{
+    static constexpr char TYPE = 's';
+
+    static auto size(const char* value) noexcept -> size_t { return std::strlen(value != nullptr ? value : "(null)") + 1; }
+    static auto encode(uint8_t* out, const char* value) noexcept -> uint8_t*
+    {
+        const size_t length = size(value);
+        std::memcpy(out, value != nullptr ? value : "(null)", length);
+        return out + length;
+    }
+    static auto decode(const uint8_t*& in) noexcept -> const char*
+    {
+        const char* value = reinterpret_cast<const char*>(in);
+        in += std::strlen(value) + 1;
+        return value;
+    }
+};
+
+template <>
+struct LogArgument<char*> : LogArgument<const char*> {};
+
+template <typename ... Args>
+struct LogSignature
+{
+    static constexpr char VALUE[sizeof...(Args) + 1] = { LogArgument<Args>::TYPE ..., '\0' };
+};
+
+/**
+ * @brief A logging statement, one static instance per macro call site
+ * 
+ * Constant initialized, so declaring it costs nothing at run time.
+ */
+struct LogSite
+{
+    LogLevel _level;
+    const char* _file;
+    int32_t _line;
+    const char* _format;
+    std::atomic<uint32_t> _id{0};   /* binary log id, 0 until first written to a BinarySink */
+
+    constexpr LogSite(LogLevel level, const char* path, int32_t line, const char* format) noexcept
+        : _level(level), _file(basename(path)), _line(line), _format(format) {}
+
+    static constexpr auto basename(const char* path) noexcept -> const char*
+    {
+        const char* name = path;
+        for(const char* c = path; *c != '\0'; ++c)
+        {
+            if(*c == '/' || *c == '\\') { name = c + 1; }
+        }
+        return name;
+    }
+};
+} // namespace common::detail
@@ -0,0 +1,136 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "CommonHeader.hpp"
+#include "common/NonCopyable.hpp"
+#include "common/Factory.hpp"
+
+#include <cstdio>
+#include <mutex>
+#include <string>
+
+namespace common
+{
+enum class LogLevel : uint8_t
+{
+    DEBUG = 0,
+    INFO,
+    ERR,    /* ERROR is a macro in wingdi.h */
+    OFF,
+};
+
+/**
+ * @brief One formatted log statement handed to a LogSink
+ * 
+ * The pointers are only valid during LogSink::write().
+ */
+struct LogRecord
+{
+    LogLevel _level;
+    uint64_t _timestamp;    /* system clock, ns since epoch */
+    uint32_t _thread;       /* OS thread id */
+    const char* _file;      /* nullptr if the location is unknown */
+    int32_t _line;
+    const char* _message;
+    size_t _size;
+};
+
+namespace detail
+{
+COMMON_LIB_API auto get_thread_id() noexcept -> uint32_t;
+} // namespace detail
+
+/**
+ * @brief Destination of log records
+ * 
+ * write() is called once per record and flush() once per batch, so a sink should buffer in write()
+ * and hand the whole batch to the OS in flush(). Both may be called from any thread.
+ */
+class COMMON_LIB_API LogSink : public NonCopyable
+{
+public :
+    virtual ~LogSink() = default;
+
+public :
+    virtual auto write(const LogRecord& record) noexcept -> void = 0;
+    virtual auto flush() noexcept -> void = 0;
+
+public :
+    /**
+     * @brief Appends "[LEVEL] message (file:line)\n", prefixed by the local time and thread id if withTime is set
+     */
+    static auto append_line(std::string& out, const LogRecord& record, bool withTime) noexcept -> void;
+};
+
+/**
+ * @brief Writes to stdout, the default sink of Logger
+ */
+class COMMON_LIB_API ConsoleSink : public LogSink
+                                 , public Factory<ConsoleSink>
+{
+    friend class Factory<ConsoleSink>;
+
+private :
+    std::mutex _lock;
+    std::string _buffer;
+
+public :
+    auto write(const LogRecord& record) noexcept -> void override;
+    auto flush() noexcept -> void override;
+
+private :
+    static auto __create() noexcept -> std::shared_ptr<ConsoleSink>;
+};
+
+/**
+ * @brief Appends to a file, one fwrite per batch
+ */
+class COMMON_LIB_API FileSink : public LogSink
+                              , public Factory<FileSink>
+{
+    friend class Factory<FileSink>;
+
+private :
+    std::mutex _lock;
+    std::string _buffer;
+    std::FILE* _file;
+
+public :
+    explicit FileSink(std::FILE* file) : _file(file) {}
+    ~FileSink() override;
+
+public :
+    auto write(const LogRecord& record) noexcept -> void override;
+    auto flush() noexcept -> void override;
+
+private :
+    /**
+     * @param path File to append to, created if missing
+     * @return std::shared_ptr<FileSink> nullptr if the file cannot be opened
+     */
+    static auto __create(const std::string& path) noexcept -> std::shared_ptr<FileSink>;
+};
+} // namespace common
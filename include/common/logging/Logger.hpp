@@ -25,55 +25,353 @@ SOFTWARE.
 #pragma once
 
 #include "CommonHeader.hpp"
+#include "common/logging/LogSink.hpp"
+#include "common/logging/LogArgument.hpp"
+#include "common/logging/BinaryLog.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 #include <string>
-#include <cstring>
-#include <iostream>
-#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #define VA_ARGS(...) , ##__VA_ARGS__
 #define __FILENAME__ (strrchr(__FILE__, '/') ? strrchr(__FILE__, '/') + 1 : __FILE__)
 
-#define _INFO_(format, ...) ::common::__logger.info(format + std::string(" (%s:%d)"), ##__VA_ARGS__, __FILENAME__, __LINE__);
-#define _DEBUG_(format, ...) ::common::__logger.debug(format + std::string(" (%s:%d)"), ##__VA_ARGS__, __FILENAME__, __LINE__);
-#define _ERROR_(format, ...) ::common::__logger.error(format + std::string(" (%s:%d)"), ##__VA_ARGS__, __FILENAME__, __LINE__);
+/* Lowest level compiled in : 0 DEBUG, 1 INFO, 2 ERROR, 3 OFF. Set by the COMMON_LIB_LOG_LEVEL CMake option. */
+#if !defined(COMMON_LIB_LOG_LEVEL)
+#define COMMON_LIB_LOG_LEVEL 0
+#endif
+
+/*
+ * Statements below COMMON_LIB_LOG_LEVEL are discarded at compile time, arguments included.
+ * The others check the runtime level before evaluating the arguments.
+ * The format is checked against the arguments by the compiler in both cases.
+ */
+#define _LOG_TO_(logger, level, format, ...)                                                        \
+    do                                                                                              \
+    {                                                                                               \
+        if(false) { ::common::detail::check_format(format, ##__VA_ARGS__); }                        \
+        if constexpr (level >= ::common::detail::COMPILED_LOG_LEVEL)                                 \
+        {                                                                                           \
+            if(::common::Logger::is_enabled(level))                                                 \
+            {                                                                                       \
+                static ::common::detail::LogSite __site(level, __FILE__, __LINE__, format);         \
+                (logger).log(__site, ##__VA_ARGS__);                                                \
+            }                                                                                       \
+        }                                                                                           \
+    } while(0)
+
+#define _LOG_(level, format, ...) _LOG_TO_(::common::__logger, level, format, ##__VA_ARGS__)
+
+#define _INFO_(format, ...) _LOG_(::common::LogLevel::INFO, format, ##__VA_ARGS__)
+#define _DEBUG_(format, ...) _LOG_(::common::LogLevel::DEBUG, format, ##__VA_ARGS__)
+#define _ERROR_(format, ...) _LOG_(::common::LogLevel::ERR, format, ##__VA_ARGS__)
 
 namespace common
 {
+struct AsyncLogOptions
+{
+    size_t _ringSize = 256 * 1024;                          /* bytes per logging thread */
+    std::chrono::milliseconds _interval{1};                 /* backend poll period while idle */
+};
+
+namespace detail
+{
+constexpr LogLevel COMPILED_LOG_LEVEL = static_cast<LogLevel>(COMMON_LIB_LOG_LEVEL);
+
+// Never called, lets the compiler validate the format of the logging macros.
+#if defined(__GNUC__)
+__attribute__((format(printf, 1, 2)))
+#endif
+inline auto check_format(const char*, ...) noexcept -> void {}
+
+using LogFormatter = int32_t (*)(const char* format, const uint8_t* args, char* out, size_t size);
+
+/**
+ * @brief snprintf() of a format without arguments, where "%%" is the only valid conversion
+ */
+inline auto print_format(char* out, size_t size, const char* format) noexcept -> int32_t
+{
+    size_t length = 0;
+    for(const char* c = format; *c != '\0'; ++c)
+    {
+        if(*c == '%' && c[1] == '%') { ++c; }
+        if(length + 1 < size) { out[length] = *c; }
+        ++length;
+    }
+    if(size != 0) { out[std::min(length, size - 1)] = '\0'; }
+    return static_cast<int32_t>(length);
+}
+
+template <typename ... Args>
+auto print_format(char* out, size_t size, const char* format, Args ... args) noexcept -> int32_t
+{
+    return std::snprintf(out, size, format, args ...);
+}
+
+template <typename ... Args>
+auto format_captured(const char* format, const uint8_t* args, char* out, size_t size) -> int32_t
+{
+    if constexpr (sizeof...(Args) == 0)
+    {
+        return print_format(out, size, format);
+    }
+    else
+    {
+        // braced initialization keeps the decoding order
+        std::tuple<decltype(LogArgument<Args>::decode(args))...> values{LogArgument<Args>::decode(args)...};
+        return std::apply([format, out, size](auto ... value){ return std::snprintf(out, size, format, value ...); }, values);
+    }
+}
+
+/**
+ * @brief Header of a record in the per-thread ring, followed by the captured arguments
+ * 
+ * _size is rounded up to 8 bytes. Its top bit marks padding at the end of the ring.
+ */
+struct AsyncLogRecord
+{
+    uint32_t _size;
+    LogLevel _level;
+    int32_t _line;
+    uint64_t _timestamp;
+    const char* _file;
+    const char* _format;
+    LogSink* _sink;
+    LogFormatter _formatter;
+};
+
+class COMMON_LIB_API AsyncLogger
+{
+public :
+    static std::atomic<bool> _enabled;
+
+public :
+    /**
+     * @brief Reserves size contiguous bytes in the ring of the calling thread, commit() must follow
+     * 
+     * @return uint8_t* nullptr if the ring is full, the record is then counted as dropped,
+     *                  or if async mode was turned off since the caller checked _enabled
+     */
+    static auto reserve(size_t size) noexcept -> uint8_t*;
+    static auto commit() noexcept -> void;
+};
+
+COMMON_LIB_API auto get_default_sink() noexcept -> LogSink*;
+#if defined(LINUX)
+/**
+ * @brief Gets the default sink if it is a BinarySink, nullptr otherwise
+ */
+COMMON_LIB_API auto get_default_binary_sink() noexcept -> BinarySink*;
+#endif
+
+/**
+ * @brief Gets the formatting buffer of the calling thread, grown to at least size bytes
+ * 
+ * The buffer is reused by every statement of the thread, so formatting does not allocate once it is large enough.
+ */
+COMMON_LIB_API auto get_format_buffer(size_t size) noexcept -> std::pair<char*, size_t>;
+
+/**
+ * @brief Formats into the buffer of the calling thread, valid until the next statement of the thread
+ */
+template <typename ... Args>
+auto format_message(const char* format, Args ... args) noexcept -> std::pair<const char*, size_t>
+{
+    auto [buffer, capacity] = get_format_buffer(0);
+    const int32_t length = print_format(buffer, capacity, format, args ...);
+    if(length < 0) { return {"", 0}; }
+    if(static_cast<size_t>(length) >= capacity)
+    {
+        std::tie(buffer, capacity) = get_format_buffer(static_cast<size_t>(length) + 1);
+        if(capacity == 0) { return {"", 0}; }
+        print_format(buffer, capacity, format, args ...);
+    }
+    return {buffer, std::min(static_cast<size_t>(length), capacity - 1)};
+}
+} // namespace detail
+
+/**
+ * @brief printf style logger
+ * 
+ * Records go to the sink of the instance, or to the default sink (stdout unless set_default_sink() is called).
+ * Give an instance its own sink and log through _LOG_TO_ to keep a component in its own file.
+ * By default the calling thread formats and writes the record.
+ * After start_async() the calling thread only copies the format pointer and the arguments
+ * into its own lock-free ring, and a single backend thread formats and writes them in batches.
+ * A full ring drops the record instead of blocking, see get_dropped().
+ */
 class COMMON_LIB_API Logger
 {
 private :
+    static std::atomic<LogLevel> _level;
+    std::shared_ptr<LogSink> _sink;
+#if defined(LINUX)
+    BinarySink* _binary = nullptr;     /* _sink if it takes raw arguments */
+#endif
+
+private :
+    auto write(LogLevel level, const char* file, int32_t line, const char* message, size_t size) noexcept -> void;
+
+    // Formats now since the format of info(), debug() and error() may be a temporary string.
     template <typename ... Args>
-    auto string_format(const std::string& format, Args ... args) -> std::string
+    auto log_message(LogLevel level, const char* format, Args ... args) noexcept -> void
     {
-        const int32_t size = std::snprintf(nullptr, 0, format.c_str(), args ...) + 1;\
-        std::unique_ptr<char[]> buf( new char[ size ] );
-        std::snprintf( buf.get(), size, format.c_str(), args ... );\
-        return std::string( buf.get(), buf.get() + size - 1 );
+        if(!is_enabled(level)) { return; }
+        const char* message = format;
+        size_t size = 0;
+        if constexpr (sizeof...(Args) == 0) { size = std::strlen(format); }
+        else { std::tie(message, size) = detail::format_message(format, args ...); }
+
+        // message may live in the formatting buffer, log() would format it into itself
+        if(!detail::AsyncLogger::_enabled.load(std::memory_order_relaxed)) { write(level, nullptr, 0, message, size); }
+        else { log(level, nullptr, 0, "%s", message); }
     }
 
 public :
+    Logger() = default;
+    explicit Logger(std::shared_ptr<LogSink> sink);
+    ~Logger();
+
+public :
+    /**
+     * @brief Logs a printf style message
+     * 
+     * @param file Source file of the statement, nullptr to omit the location
+     * @param format Must outlive the process in async mode, a string literal in practice
+     */
     template <typename ... Args>
-    auto info(const std::string& format, Args ... args) -> void
+    auto log(LogLevel level, const char* file, int32_t line, const char* format, Args ... args) noexcept -> void
     {
-        info(string_format(format, args ...));
+        if(!is_enabled(level)) { return; }
+        if(!detail::AsyncLogger::_enabled.load(std::memory_order_relaxed))
+        {
+            // without arguments the format is the message unless it escapes a '%'
+            if constexpr (sizeof...(Args) == 0)
+            {
+                if(std::strchr(format, '%') == nullptr)
+                {
+                    write(level, file, line, format, std::strlen(format));
+                    return;
+                }
+            }
+            const auto [message, size] = detail::format_message(format, args ...);
+            write(level, file, line, message, size);
+            return;
+        }
+
+        const size_t size = sizeof(detail::AsyncLogRecord) + (size_t(0) + ... + detail::LogArgument<Args>::size(args));
+        uint8_t* out = detail::AsyncLogger::reserve(size);
+        if(out == nullptr)
+        {
+            // stop_async() ran meanwhile, the record is written by the calling thread instead
+            if(!detail::AsyncLogger::_enabled.load(std::memory_order_relaxed)) { log(level, file, line, format, args ...); }
+            return;
+        }
+
+        auto* record = reinterpret_cast<detail::AsyncLogRecord*>(out);
+        record->_level = level;
+        record->_line = line;
+        record->_timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::system_clock::now().time_since_epoch()).count());
+        record->_file = file;
+        record->_format = format;
+        record->_sink = _sink ? _sink.get() : detail::get_default_sink();
+        record->_formatter = &detail::format_captured<Args ...>;
+        out += sizeof(detail::AsyncLogRecord);
+        ((out = detail::LogArgument<Args>::encode(out, args)), ...);
+        detail::AsyncLogger::commit();
     }
-    auto info(const std::string& format) -> void;
 
+    /**
+     * @brief Logs the statement of a call site, used by the macros
+     * 
+     * A BinarySink, of the instance or the default one, receives the site id and the raw arguments,
+     * other sinks the formatted message.
+     */
     template <typename ... Args>
-    auto debug(const std::string& format, Args ... args) -> void
+    auto log(detail::LogSite& site, Args ... args) noexcept -> void
     {
-        debug(string_format(format, args ...));
+#if defined(LINUX)
+        BinarySink* binary = _sink ? _binary : detail::get_default_binary_sink();
+        if(binary != nullptr)
+        {
+            if(is_enabled(site._level)) { binary->log(site, args ...); }
+            return;
+        }
+#endif
+        log(site._level, site._file, site._line, site._format, args ...);
     }
-    auto debug(const std::string& format) -> void;
 
     template <typename ... Args>
-    auto error(const std::string& format, Args ... args) -> void
+    auto info(const char* format, Args ... args) -> void { log_message(LogLevel::INFO, format, args ...); }
+    template <typename ... Args>
+    auto info(const std::string& format, Args ... args) -> void { info(format.c_str(), args ...); }
+
+    template <typename ... Args>
+    auto debug(const char* format, Args ... args) -> void { log_message(LogLevel::DEBUG, format, args ...); }
+    template <typename ... Args>
+    auto debug(const std::string& format, Args ... args) -> void { debug(format.c_str(), args ...); }
+
+    template <typename ... Args>
+    auto error(const char* format, Args ... args) -> void { log_message(LogLevel::ERR, format, args ...); }
+    template <typename ... Args>
+    auto error(const std::string& format, Args ... args) -> void { error(format.c_str(), args ...); }
+
+    /**
+     * @brief Replaces the sink, call before logging through this instance
+     */
+    auto set_sink(std::shared_ptr<LogSink> sink) noexcept -> void;
+
+    /**
+     * @brief Waits until every record logged so far is written to the sink
+     */
+    auto flush() noexcept -> void;
+
+public :
+    /**
+     * @brief Sets the lowest level written by every Logger, DEBUG by default
+     * 
+     * Levels below COMMON_LIB_LOG_LEVEL are compiled out by the macros regardless.
+     */
+    static inline auto set_level(LogLevel level) noexcept -> void { _level.store(level, std::memory_order_relaxed); }
+    static inline auto get_level() noexcept -> LogLevel { return _level.load(std::memory_order_relaxed); }
+    static inline auto is_enabled(LogLevel level) noexcept -> bool
     {
-        error(string_format(format, args ...));
+        return level >= detail::COMPILED_LOG_LEVEL && level >= _level.load(std::memory_order_relaxed);
     }
-    auto error(const std::string& format) -> void;
+
+    /**
+     * @brief Replaces stdout as the sink of every Logger without its own, including the static __logger
+     * 
+     * The previous sinks are kept alive until exit since pending records may still refer to them.
+     */
+    static auto set_default_sink(std::shared_ptr<LogSink> sink) noexcept -> void;
+
+    /**
+     * @brief Switches every Logger to asynchronous mode
+     * 
+     * @return bool false if already started
+     */
+    static auto start_async(const AsyncLogOptions& options = AsyncLogOptions()) noexcept -> bool;
+
+    /**
+     * @brief Writes the pending records and goes back to synchronous mode
+     * 
+     * Also called at exit.
+     */
+    static auto stop_async() noexcept -> void;
+
+    /**
+     * @brief Gets the number of records dropped because the ring of the logging thread was full
+     */
+    static auto get_dropped() noexcept -> uint64_t;
 };
 
 // Warning False Alram
@@ -0,0 +1,102 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "CommonHeader.hpp"
+#include "common/Factory.hpp"
+#include "common/logging/LogSink.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace common
+{
+struct RotatingFileOptions
+{
+    size_t _segmentSize = 16 * 1024 * 1024;     /* bytes per file, preallocated and mapped */
+    std::chrono::seconds _interval{0};          /* also rotates files older than this, 0 to disable */
+    uint32_t _maxFiles = 8;                     /* path and path.1 ... path.N-1, older ones are deleted */
+    size_t _syncBytes = 1024 * 1024;            /* fdatasync once this many bytes are pending ... */
+    std::chrono::milliseconds _syncInterval{1000}; /* ... or the oldest pending byte is this old, 0 for every flush */
+};
+
+#if defined(LINUX)
+/**
+ * @brief Writes text lines into a memory-mapped, preallocated file and rotates it by size or age
+ * 
+ * The current file is always path. On rotation it is truncated to its used size and renamed to path.1,
+ * path.1 to path.2 and so on, so no line is lost and no external rotation is needed.
+ * A file left by a previous run is rotated away on creation.
+ * Lines only go through a memcpy into the mapping; flush() batches fdatasync() by size and time
+ * and runs it without the sink's lock, so other threads keep writing during the disk flush.
+ */
+class COMMON_LIB_API RotatingFileSink : public LogSink
+                                      , public Factory<RotatingFileSink>
+{
+    friend class Factory<RotatingFileSink>;
+
+private :
+    struct Detail;
+    std::unique_ptr<Detail> _detail;
+
+public :
+    explicit RotatingFileSink(std::unique_ptr<Detail> detail) noexcept;
+    ~RotatingFileSink() override;
+
+public :
+    auto write(const LogRecord& record) noexcept -> void override;
+
+    /**
+     * @brief Calls fdatasync() if RotatingFileOptions::_syncBytes or _syncInterval is reached
+     */
+    auto flush() noexcept -> void override;
+
+    /**
+     * @brief Calls fdatasync() now for every line written before the call
+     */
+    auto sync() noexcept -> void;
+
+    /**
+     * @brief Starts a new file now
+     * 
+     * @return bool false if the new file cannot be created, lines are then dropped until the next rotation
+     */
+    auto rotate() noexcept -> bool;
+
+    /**
+     * @brief Gets the number of lines lost because they were larger than a segment or no file was open
+     */
+    auto get_dropped() const noexcept -> uint64_t;
+
+private :
+    /**
+     * @return std::shared_ptr<RotatingFileSink> nullptr if the first file cannot be created
+     */
+    static auto __create(const std::string& path, const RotatingFileOptions& options = RotatingFileOptions())
+        noexcept -> std::shared_ptr<RotatingFileSink>;
+};
+#endif
+} // namespace common
@@ -27,16 +27,65 @@ SOFTWARE.
 #include "CommonHeader.hpp"
 
 #include "common/communication/Event.hpp"
+#include "common/container/SeqLock.hpp"
 
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <typeindex>
+#include <unordered_map>
 
 namespace common
 {
+/**
+ * @brief How GenericEventBus::publish() delivers a topic
+ */
+class TopicMode
+{
+public :
+    enum type : uint8_t
+    {
+        EVENT,      // every value is queued to the subscribers
+        STATE,      // only the newest value is kept, read with get_state() or the cell
+        BOTH        // kept as state and queued to the subscribers
+    };
+};
+
 class GenericEventBus
 {
+public :
+    // values up to a cache line fit one SeqLock, larger ones rotate through LatestValue slots
+    template <typename DataType>
+    using StateCell = std::conditional_t<sizeof(DataType) <= 64, SeqLock<DataType>, LatestValue<DataType>>;
+
 private :
+    struct StateBase
+    {
+        const std::type_index _type;
+        std::atomic<TopicMode::type> _mode;
+
+        StateBase(std::type_index type, TopicMode::type mode) : _type(type), _mode(mode) {}
+        virtual ~StateBase() = default;
+    };
+
+    template <typename DataType>
+    struct State final : StateBase
+    {
+        std::mutex _writeLock;      /* the cells take one writer at a time */
+        std::shared_ptr<StateCell<DataType>> _cell = std::make_shared<StateCell<DataType>>();
+
+        explicit State(TopicMode::type mode) : StateBase(typeid(DataType), mode) {}
+    };
+
     EventBus _bus;
 
+    std::atomic<size_t> _stateCount{0};     /* publish() skips the lookup while no topic keeps state */
+    mutable std::shared_mutex _stateLock;
+    std::unordered_map<std::string, std::shared_ptr<StateBase>> _states;
+
 public :
     template <typename DataType>
     auto subscribe(const std::string& topic, 
@@ -60,10 +109,74 @@ public :
     {
         static_assert(std::is_trivially_copyable_v<DataType>,
                       "DataType must be copyable");
+        if(_stateCount.load(std::memory_order_acquire) != 0)
+        {
+            if(auto state = find_state<DataType>(topic))
+            {
+                {
+                    std::lock_guard<std::mutex> lock(state->_writeLock);
+                    state->_cell->store(data);
+                }
+                if(state->_mode.load(std::memory_order_relaxed) == TopicMode::STATE) { return; }
+            }
+        }
         _bus.publish(topic, GenericEventBus::serialize(data));
     }
 
+    /**
+     * @brief Makes publish() keep the newest value of a topic
+     * 
+     * With TopicMode::STATE the values are no longer queued to subscribers, readers poll the newest one
+     * without locks or allocations. Calling it again only changes the mode.
+     * 
+     * @return std::shared_ptr<const StateCell<DataType>> The cell itself, for readers that skip the topic lookup
+     * @throw std::logic_error if the topic already keeps state of another type
+     */
+    template <typename DataType>
+    auto set_mode(const std::string& topic, TopicMode::type mode) -> std::shared_ptr<const StateCell<DataType>>
+    {
+        static_assert(std::is_trivially_copyable_v<DataType>,
+                      "DataType must be copyable");
+        std::unique_lock<std::shared_mutex> lock(_stateLock);
+        auto itor = _states.find(topic);
+        if(itor == _states.end())
+        {
+            // built before it is inserted, a failed allocation leaves no empty entry behind
+            auto created = std::make_shared<State<DataType>>(mode);
+            itor = _states.emplace(topic, std::move(created)).first;
+            _stateCount.fetch_add(1, std::memory_order_release);
+        }
+        const auto& state = itor->second;
+        if(state->_type != typeid(DataType)) { throw std::logic_error("Topic state has another type: " + topic); }
+
+        state->_mode.store(mode, std::memory_order_relaxed);
+        return std::static_pointer_cast<State<DataType>>(state)->_cell;
+    }
+
+    /**
+     * @brief Gets the newest value published on a topic set to TopicMode::STATE or BOTH
+     * 
+     * @return std::optional<DataType> nullopt if the topic keeps no state or nothing was published yet
+     */
+    template <typename DataType>
+    auto get_state(const std::string& topic) const -> std::optional<DataType>
+    {
+        auto state = find_state<DataType>(topic);
+        if(!state || state->_cell->get_version() == 0) { return std::nullopt; }
+        return state->_cell->load();
+    }
+
 private :
+    template <typename DataType>
+    auto find_state(const std::string& topic) const -> std::shared_ptr<State<DataType>>
+    {
+        std::shared_lock<std::shared_mutex> lock(_stateLock);
+        auto itor = _states.find(topic);
+        if(itor == _states.end()) { return nullptr; }
+        if(itor->second->_type != typeid(DataType)) { throw std::logic_error("Topic state has another type: " + topic); }
+        return std::static_pointer_cast<State<DataType>>(itor->second);
+    }
+
     template <typename DataType>
     static auto serialize(const DataType& data) -> std::vector<uint8_t>
     {
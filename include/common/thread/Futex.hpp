@@ -0,0 +1,75 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#pragma once
+
+#include "CommonHeader.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <thread>
+
+#if defined(LINUX)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace common
+{
+/**
+ * @brief Parks threads on a 32-bit word of the process
+ * 
+ * wait() returns once the word differs from expected, after a wake(), or spuriously,
+ * so callers re-check their condition in a loop.
+ * 
+ * @note Other platforms poll the word instead of sleeping in the kernel.
+ */
+class Futex
+{
+public :
+    static constexpr int32_t ALL = INT_MAX;
+
+public :
+    static auto wait(std::atomic<uint32_t>& word, uint32_t expected) noexcept -> void
+    {
+#if defined(LINUX)
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#else
+        if(word.load(std::memory_order_acquire) == expected) { std::this_thread::sleep_for(std::chrono::microseconds(50)); }
+#endif
+    }
+
+    static auto wake(std::atomic<uint32_t>& word, int32_t count) noexcept -> void
+    {
+#if defined(LINUX)
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+#else
+        (void)word;
+        (void)count;
+#endif
+    }
+};
+} // namespace common
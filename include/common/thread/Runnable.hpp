@@ -28,9 +28,11 @@ SOFTWARE.
 #include "common/thread/Thread.hpp"
 #include "common/Exception.hpp"
 #include "common/NonCopyable.hpp"
+#include "common/container/ObjectPool.hpp"
 
 #include <vector>
 #include <atomic>
+#include <memory_resource>
 
 namespace common
 {
@@ -205,6 +207,7 @@ public :
  * The thread waits for notify() calls and executes __work() with the provided data.
  * The task can be stopped by calling stop(), and the thread started by run() will be stopped.
  * If the task is stopped, status() will return false.
+ * The promise behind each notify() is allocated from the memory resource given to the constructor.
  *
  * @tparam DataType The type of data to be passed to __work(). Use void for no input data.
  * @tparam ReturnType The return type of __work(). Use void for no return value.
@@ -229,6 +232,7 @@ private :
                                         std::pair<DataType, PromiseType>>;
 
     std::vector<TaskType> _tasks;
+    std::pmr::memory_resource* _resource;
 
 #if defined(WIN32)
     Thread::Priority _priority = Thread::Policies::DEFAULT;
@@ -237,6 +241,19 @@ private :
 #endif
     std::string _name;
 
+private :
+    // the promise takes the allocator by uses-allocator construction
+    auto make_promise() -> PromiseType
+    {
+        return std::allocate_shared<std::promise<ReturnType>>(std::pmr::polymorphic_allocator<std::promise<ReturnType>>(_resource));
+    }
+
+public :
+    /**
+     * @param resource Memory of the promises created by notify(), must outlive the runnable
+     */
+    explicit ActiveRunnable(std::pmr::memory_resource* resource = PoolResource::get()) noexcept : _resource(resource) {}
+
 public :
     /**
      * @brief Start a new thread and call __work() in the thread continuously with the data that is passed by notify() function.
@@ -300,7 +317,7 @@ public :
     template<typename T = DataType>
     auto notify(const T& data) noexcept -> std::enable_if_t<!std::is_void_v<T>, std::future<ReturnType>>
     {
-        PromiseType promise = std::make_shared<std::promise<ReturnType>>();
+        PromiseType promise = make_promise();
         auto future = promise->get_future();
 
         std::unique_lock<std::mutex> lock(_notifyLock);
@@ -318,7 +335,7 @@ public :
     template<typename T = DataType>
     auto notify(const T&& data) noexcept -> std::enable_if_t<!std::is_void_v<T>, std::future<ReturnType>>
     {
-        PromiseType promise = std::make_shared<std::promise<ReturnType>>();
+        PromiseType promise = make_promise();
         auto future = promise->get_future();
 
         std::unique_lock<std::mutex> lock(_notifyLock);
@@ -336,7 +353,7 @@ public :
     template<typename T = DataType>
     auto notify() noexcept -> std::enable_if_t<std::is_void_v<T>, std::future<ReturnType>>
     {
-        PromiseType promise = std::make_shared<std::promise<ReturnType>>();
+        PromiseType promise = make_promise();
         auto future = promise->get_future();
 
         std::unique_lock<std::mutex> lock(_notifyLock);
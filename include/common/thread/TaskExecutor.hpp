@@ -30,9 +30,11 @@ SOFTWARE.
 #include "common/Factory.hpp"
 #include "common/utils/Misc.hpp"
 #include "common/thread/Thread.hpp"
+#include "common/container/ObjectPool.hpp"
 #include "common/container/WorkQueue.hpp"
 
 #include <iostream>
+#include <memory_resource>
 #include <vector>
 
 namespace common
@@ -61,24 +63,27 @@ private :
     /**
      * @brief Factory method to create a TaskExecutor instance
      * @param threadCount Number of worker threads to create
+     * @param resource Memory of the queued tasks and their futures, must outlive the executor
      * @return Shared pointer to the created TaskExecutor instance
      */
-    static auto __create(uint32_t threadCount) noexcept -> std::shared_ptr<TaskExecutor>
+    static auto __create(uint32_t threadCount, std::pmr::memory_resource* resource = PoolResource::get()) noexcept
+        -> std::shared_ptr<TaskExecutor>
     {
-        return std::shared_ptr<TaskExecutor>(new TaskExecutor(threadCount));
+        return std::shared_ptr<TaskExecutor>(new TaskExecutor(threadCount, resource));
     }
 
 public :
     /**
      * @brief Constructor that initializes the thread pool with specified number of threads
      * @param threadCount Number of worker threads to create (will be adjusted to next power of 2)
+     * @param resource Memory of the queued tasks and their futures, the thread-caching pools by default
      * 
      * Creates a thread pool with the specified number of threads. The actual thread count
      * is adjusted to the next power of 2 for efficient bit masking operations.
      * Each thread runs a work-stealing loop that processes tasks from its own queue
      * and steals work from other queues when idle.
      */
-    explicit TaskExecutor(uint32_t threadCount) noexcept
+    explicit TaskExecutor(uint32_t threadCount, std::pmr::memory_resource* resource = PoolResource::get()) noexcept
     {
         const uint32_t adjustedThreadCount = utils::next_pwr_of_2(threadCount);
         _running.store(true);
@@ -87,7 +92,7 @@ public :
 
         for(uint32_t i = 0; i < adjustedThreadCount; ++i)
         {
-            auto queue = std::make_shared<WorkQueue>();
+            auto queue = std::make_shared<WorkQueue>(resource);
             _queues.push_back(std::move(queue));
         }
 
@@ -144,6 +149,20 @@ public :
         return _queues[queueIndex]->push(std::move(task));
     }
 
+    /**
+     * @brief Submits a task whose result nobody waits for
+     * @param task Any callable, stored as is in one pooled allocation
+     * 
+     * Cheaper than load() for fire-and-forget work: no std::function, promise or future is created.
+     * An exception thrown by the task is caught and dropped on the worker thread.
+     */
+    template <typename Function>
+    auto post(Function&& task) -> void
+    {
+        const uint32_t queueIndex = _index.fetch_add(1) & (_queues.size() - 1);
+        _queues[queueIndex]->post(std::forward<Function>(task));
+    }
+
     /**
      * @brief Stops all worker threads and waits for them to complete
      * 
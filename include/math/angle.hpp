@@ -26,13 +26,14 @@ SOFTWARE.
 
 #include "CommonHeader.hpp"
 
+#include "math/matrix.hpp"
+
 #include <cmath>
 
 namespace common::math
 {
 class Euler;
 class Quaternion;
-template <typename T> class Matrix;
 
 class COMMON_LIB_API Euler
 {
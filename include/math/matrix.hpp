@@ -26,9 +26,15 @@ SOFTWARE.
 
 #include "CommonHeader.hpp"
 
+#include <algorithm>
+#include <array>
 #include <functional>
+#include <memory>
+#include <new>
 #include <stdint.h>
 #include <cmath>
+#include <type_traits>
+#include <utility>
 
 #define MATH_EXCEPTION_ENABLE
 
@@ -40,7 +46,13 @@ SOFTWARE.
 
 namespace common::math
 {
-template <typename T>
+// dimension of a Matrix sized at runtime
+constexpr int32_t Dynamic = -1;
+
+/**
+ * @brief Matrix<T> is sized at runtime, Matrix<T, R, C> is an inline R x C matrix sized at compile time
+ */
+template <typename T, int32_t R = Dynamic, int32_t C = Dynamic>
 class Matrix;
 
 namespace util
@@ -64,87 +76,130 @@ template <typename T>
 auto inverse(const Matrix<T>& mat) -> Matrix<T>;
 } // namespace util
 
+namespace kernel
+{
+/**
+ * @brief Instruction sets of the float and double kernels, picked once from the CPU at load time
+ */
+enum class Isa : uint8_t
+{
+    SCALAR,
+    SSE2,
+    AVX2
+};
+
+COMMON_LIB_API auto get_supported_isa() noexcept -> Isa;
+COMMON_LIB_API auto get_isa() noexcept -> Isa;
+
+/**
+ * @brief Switches the kernels used by every thread, for tests and benchmarks
+ * 
+ * @return Isa The selected instruction set, isa capped at get_supported_isa()
+ */
+COMMON_LIB_API auto set_isa(Isa isa) noexcept -> Isa;
+
+// out(rows x cols) = lhs(rows x inner) * rhs(inner x cols), all row-major and not overlapping
+COMMON_LIB_API auto multiply(const float* lhs, const float* rhs, float* out, int32_t rows, int32_t inner, int32_t cols) -> void;
+COMMON_LIB_API auto multiply(const double* lhs, const double* rhs, double* out, int32_t rows, int32_t inner, int32_t cols) -> void;
+
+COMMON_LIB_API auto add(const float* lhs, const float* rhs, float* out, size_t count) -> void;
+COMMON_LIB_API auto add(const double* lhs, const double* rhs, double* out, size_t count) -> void;
+
+COMMON_LIB_API auto subtract(const float* lhs, const float* rhs, float* out, size_t count) -> void;
+COMMON_LIB_API auto subtract(const double* lhs, const double* rhs, double* out, size_t count) -> void;
+
+COMMON_LIB_API auto scale(const float* in, float scalar, float* out, size_t count) -> void;
+COMMON_LIB_API auto scale(const double* in, double scalar, double* out, size_t count) -> void;
+
+// out(cols x rows) = transpose of in(rows x cols)
+COMMON_LIB_API auto transpose(const float* in, float* out, int32_t rows, int32_t cols) -> void;
+COMMON_LIB_API auto transpose(const double* in, double* out, int32_t rows, int32_t cols) -> void;
+
 template <typename T>
-class COMMON_LIB_API Matrix
+constexpr bool is_accelerated = std::is_same_v<T, float> || std::is_same_v<T, double>;
+} // namespace kernel
+
+/**
+ * @brief Matrix sized at runtime, stored row-major in one buffer aligned for the SIMD kernels
+ */
+template <typename T>
+class COMMON_LIB_API Matrix<T, Dynamic, Dynamic>
 {
 private :
-    T** _mat = nullptr;
+    static constexpr size_t ALIGNMENT = 64;
+
+    T* _mat = nullptr;
 
 public :
     const int32_t _row;
     const int32_t _col;
 
+private :
+    auto get_count() const noexcept -> size_t { return static_cast<size_t>(_row) * static_cast<size_t>(_col); }
+
+    auto allocate() -> void
+    {
+        if (get_count() == 0) return;
+        _mat = static_cast<T*>(::operator new(sizeof(T) * get_count(), std::align_val_t(ALIGNMENT)));
+        std::uninitialized_default_construct_n(_mat, get_count());
+    }
+
 public :
     Matrix(const int32_t row, const int32_t col)
         : _row(row), _col(col)
     {
-        _mat = new T * [_row];
-        for (int32_t x = 0; x < _row; ++x)
-            _mat[x] = new T[_col];
+        allocate();
     }
 
     Matrix(const int32_t size)
         : Matrix(size, size) {}
 
     Matrix(const int32_t size, const T mat[][4])
-        : Matrix(size, size, mat)
+        : Matrix(size, size)
     {
-        _mat = new T * [_row];
-        for (int32_t row = 0; row < _row; ++row)
-        {
-            _mat[row] = new T[_col];
-            for (int32_t col = 0; col < _col; ++col)
-                _mat[row][col] = mat[row][col];
-        };
+        traversal([this, mat](const int32_t row, const int32_t col) {
+            (*this)[row][col] = mat[row][col];
+        });
     }
 
     Matrix(const Matrix& mat)
         : _row(mat._row), _col(mat._col)
     {
-        _mat = new T * [_row];
-        for (int32_t row = 0; row < _row; ++row)
-        {
-            _mat[row] = new T[_col];
-            for (int32_t col = 0; col < _col; ++col)
-                _mat[row][col] = mat[row][col];
-        };
+        allocate();
+        std::copy(mat._mat, mat._mat + get_count(), _mat);
     }
 
     Matrix(Matrix&& mat) noexcept
-        : _row(mat._row), _col(mat._col)
+        : _mat(mat._mat), _row(mat._row), _col(mat._col)
     {
-        _mat = new T * [_row];
-        for (int32_t row = 0; row < _row; ++row)
-        {
-            _mat[row] = new T[_col];
-            for (int32_t col = 0; col < _col; ++col)
-                _mat[row][col] = std::move(mat[row][col]);
-        };
+        mat._mat = nullptr;
     }
 
     ~Matrix()
     {
-        if (_row > 0)
+        if (_mat)
         {
-            for (int32_t row = 0; row < _row; ++row)
-                delete[] _mat[row];
-            delete[] _mat;
+            std::destroy_n(_mat, get_count());
+            ::operator delete(_mat, std::align_val_t(ALIGNMENT));
         }
     }
 
 public :
-    T* operator[](const int32_t row) { return _mat[row]; };
-    const T* operator[](const int32_t row) const { return _mat[row]; };
-    Matrix operator=(const Matrix& mat)
+    T* operator[](const int32_t row) { return _mat + static_cast<size_t>(row) * _col; };
+    const T* operator[](const int32_t row) const { return _mat + static_cast<size_t>(row) * _col; };
+    Matrix& operator=(const Matrix& mat)
     {
         if (_col != mat._col || _row != mat._row)
             throw std::out_of_range("Matrix size not matched.");
 
-        traversal([this, &mat](const int32_t row, const int32_t col) {
-            _mat[row][col] = mat[row][col];
-        });
+        if (this != &mat)
+            std::copy(mat._mat, mat._mat + get_count(), _mat);
+        return (*this);
     };
 
+    auto data() noexcept -> T* { return _mat; }
+    auto data() const noexcept -> const T* { return _mat; }
+
     auto print() -> void
     {
         std::string output;
@@ -152,47 +207,55 @@ public :
         {
             for (int32_t col = 0; col < _col; ++col)
             {
-                output += std::to_string(_mat[row][col]) + "\t";
+                output += std::to_string((*this)[row][col]) + "\t";
             }
             output += "\n";
         }
         std::cout << output;
     }
 
-    auto traversal(std::function<void(const int32_t row, const int32_t col)> func) -> void
-    {
-        for (int32_t __row = 0; __row < _row; ++__row)
-            for (int32_t __col = 0; __col < _col; ++__col)
-                func(__row, __col);
-    }
-
-    auto traversal(std::function<void(const int32_t row, const int32_t col)> func) const -> void
-    {
-        for (int32_t __row = 0; __row < _row; ++__row)
-            for (int32_t __col = 0; __col < _col; ++__col)
-                func(__row, __col);
-    }
-
-    auto traversal(std::function<void(const int32_t row, const int32_t col, const T& value)> func) -> void
+    /**
+     * @brief Calls func(row, col) or func(row, col, value) for every element in row-major order
+     */
+    template <typename Function>
+    auto traversal(Function&& func) -> void
     {
         for (int32_t __row = 0; __row < _row; ++__row)
             for (int32_t __col = 0; __col < _col; ++__col)
-                func(__row, __col, _mat[__row][__col]);
+            {
+                if constexpr (std::is_invocable_v<Function&, const int32_t, const int32_t, const T&>)
+                    func(__row, __col, (*this)[__row][__col]);
+                else
+                    func(__row, __col);
+            }
     }
 
-    auto traversal(std::function<void(const int32_t row, const int32_t col, const T& value)> func) const -> void
+    template <typename Function>
+    auto traversal(Function&& func) const -> void
     {
         for (int32_t __row = 0; __row < _row; ++__row)
             for (int32_t __col = 0; __col < _col; ++__col)
-                func(__row, __col, _mat[__row][__col]);
+            {
+                if constexpr (std::is_invocable_v<Function&, const int32_t, const int32_t, const T&>)
+                    func(__row, __col, (*this)[__row][__col]);
+                else
+                    func(__row, __col);
+            }
     }
 
     auto transpose() const -> Matrix
     {
         Matrix<T> rtn(_col, _row);
-        traversal([&rtn](const int32_t row, const int32_t col, const T& value) {
-            rtn[col][row] = value;
-        });
+        if constexpr (kernel::is_accelerated<T>)
+        {
+            kernel::transpose(_mat, rtn._mat, _row, _col);
+        }
+        else
+        {
+            traversal([&rtn](const int32_t row, const int32_t col, const T& value) {
+                rtn[col][row] = value;
+            });
+        }
         return rtn;
     }
 
@@ -231,9 +294,16 @@ Matrix<T> operator+(const Matrix<T>& lhs, const Matrix<T>& rhs)
         throw std::out_of_range("Size not matched.");
 #endif
     Matrix<T> rtn(lhs._row, lhs._col);
-    rtn.traversal([&rtn, &lhs, &rhs](const int32_t row, const int32_t col) -> void {
-        rtn[row][col] = lhs[row][col] + rhs[row][col];
-    });
+    const size_t count = static_cast<size_t>(lhs._row) * lhs._col;
+    if constexpr (kernel::is_accelerated<T>)
+    {
+        kernel::add(lhs.data(), rhs.data(), rtn.data(), count);
+    }
+    else
+    {
+        for (size_t x = 0; x < count; ++x)
+            rtn.data()[x] = lhs.data()[x] + rhs.data()[x];
+    }
     return rtn;
 };
 
@@ -245,10 +315,16 @@ Matrix<T> operator-(const Matrix<T>& lhs, const Matrix<T>& rhs)
         throw std::out_of_range("Size not matched.");
 #endif
     Matrix<T> rtn(lhs._row, lhs._col);
-    rtn.traversal([&rtn, &lhs, &rhs](const int32_t row, const int32_t col)
+    const size_t count = static_cast<size_t>(lhs._row) * lhs._col;
+    if constexpr (kernel::is_accelerated<T>)
     {
-        rtn[row][col] = lhs[row][col] - rhs[row][col];
-    });
+        kernel::subtract(lhs.data(), rhs.data(), rtn.data(), count);
+    }
+    else
+    {
+        for (size_t x = 0; x < count; ++x)
+            rtn.data()[x] = lhs.data()[x] - rhs.data()[x];
+    }
     return rtn;
 };
 
@@ -261,18 +337,24 @@ Matrix<T> operator*(const Matrix<T>& lhs, const Matrix<T>& rhs)
 #endif
 
     Matrix<T> rtn(lhs._row, rhs._col);
-    for (int32_t row = 0; row < lhs._row; ++row)
+    if constexpr (kernel::is_accelerated<T>)
+    {
+        kernel::multiply(lhs.data(), rhs.data(), rtn.data(), lhs._row, lhs._col, rhs._col);
+    }
+    else
     {
-        for (int32_t col = 0; col < rhs._col; ++col)
+        for (int32_t row = 0; row < lhs._row; ++row)
         {
-            T sum = lhs[row][0] * rhs[0][col];
-            for (int32_t x = 1; x < lhs._col; ++x)
+            for (int32_t col = 0; col < rhs._col; ++col)
             {
-                sum += lhs[row][x] * rhs[x][col];
+                T sum = lhs[row][0] * rhs[0][col];
+                for (int32_t x = 1; x < lhs._col; ++x)
+                {
+                    sum += lhs[row][x] * rhs[x][col];
+                }
+                rtn[row][col] = sum;
             }
-            rtn[row][col] = sum;
         }
-        
     }
     return rtn;
 };
@@ -280,21 +362,24 @@ Matrix<T> operator*(const Matrix<T>& lhs, const Matrix<T>& rhs)
 template <typename T>
 Matrix<T> operator*(const Matrix<T>& lhs, const T& scalar)
 {
-    Matrix<T> rtn(lhs._col, lhs._mat);
-    lhs.traversal([&rtn, &scalar](const int32_t row, const int32_t col, const T& value) {
-        rtn[row][col] = value * scalar;
-    });
+    Matrix<T> rtn(lhs._row, lhs._col);
+    const size_t count = static_cast<size_t>(lhs._row) * lhs._col;
+    if constexpr (kernel::is_accelerated<T>)
+    {
+        kernel::scale(lhs.data(), scalar, rtn.data(), count);
+    }
+    else
+    {
+        for (size_t x = 0; x < count; ++x)
+            rtn.data()[x] = lhs.data()[x] * scalar;
+    }
     return rtn;
 };
 
 template <typename T>
 Matrix<T> operator*(const T& scalar, const Matrix<T>& rhs)
 {
-    Matrix<T> rtn(rhs._col, rhs._row);
-    rhs.traversal([&rtn, &scalar](const int32_t row, const int32_t col, const T& value) {
-        rtn[row][col] = value * scalar;
-    });
-    return rtn;
+    return rhs * scalar;
 }
 
 template <typename T>
@@ -307,9 +392,9 @@ template <typename T>
 Matrix<T> operator/(const Matrix<T>& lhs, const T& scalar)
 {
     Matrix<T> rtn(lhs);
-    rtn.traversal([&rtn, scalar](const int32_t row, const int32_t col) {
-        rtn[row][col] = rtn[row][col] / scalar;
-    });
+    const size_t count = static_cast<size_t>(lhs._row) * lhs._col;
+    for (size_t x = 0; x < count; ++x)
+        rtn.data()[x] = rtn.data()[x] / scalar;
     return rtn;
 };
 
@@ -438,4 +523,356 @@ auto inverse(const Matrix<T>& mat) -> Matrix<T>
     }
 };
 } // namespace util
+
+namespace detail
+{
+// kernels of fixed-size matrices up to this many elements are unrolled at compile time
+constexpr size_t MATRIX_UNROLL_LIMIT = 64;
+
+template <typename Function, size_t... I>
+constexpr auto unroll(Function& function, std::index_sequence<I...>) -> void
+{
+    (function(I), ...);
+}
+
+template <size_t N, typename Function>
+constexpr auto for_each_index(Function&& function) -> void
+{
+    if constexpr (N <= MATRIX_UNROLL_LIMIT)
+    {
+        unroll(function, std::make_index_sequence<N>{});
+    }
+    else
+    {
+        for (size_t i = 0; i < N; ++i)
+            function(i);
+    }
+}
+
+template <int32_t... Dims>
+constexpr bool is_fixed = ((Dims != Dynamic) && ...);
+} // namespace detail
+
+/**
+ * @brief R x C matrix stored inline in row-major order
+ * 
+ * Nothing is allocated, the dimensions are checked at compile time and the kernels of small matrices
+ * are unrolled, which suits the 3x3 and 4x4 transforms of poses. Use Matrix<T> for sizes known at runtime.
+ */
+template <typename T, int32_t R, int32_t C>
+class COMMON_LIB_API Matrix
+{
+    static_assert(R > 0 && C > 0, "Fixed-size matrix needs positive dimensions, use Matrix<T> for runtime sizes.");
+
+private :
+    std::array<T, static_cast<size_t>(R * C)> _data{};
+
+public :
+    static constexpr int32_t _row = R;
+    static constexpr int32_t _col = C;
+    static constexpr size_t SIZE = static_cast<size_t>(R * C);
+
+public :
+    constexpr Matrix() = default;
+
+    constexpr Matrix(const T (&mat)[R][C])
+    {
+        detail::for_each_index<SIZE>([this, &mat](const size_t i) {
+            _data[i] = mat[i / C][i % C];
+        });
+    }
+
+    explicit Matrix(const Matrix<T>& mat)
+    {
+        if (mat._row != R || mat._col != C)
+            throw std::out_of_range("Matrix size not matched.");
+
+        detail::for_each_index<SIZE>([this, &mat](const size_t i) {
+            _data[i] = mat[static_cast<int32_t>(i / C)][i % C];
+        });
+    }
+
+public :
+    constexpr T* operator[](const int32_t row) { return _data.data() + row * C; };
+    constexpr const T* operator[](const int32_t row) const { return _data.data() + row * C; };
+    constexpr T& operator()(const int32_t row, const int32_t col) { return _data[row * C + col]; };
+    constexpr const T& operator()(const int32_t row, const int32_t col) const { return _data[row * C + col]; };
+
+    constexpr auto data() noexcept -> T* { return _data.data(); }
+    constexpr auto data() const noexcept -> const T* { return _data.data(); }
+
+    auto print() const -> void
+    {
+        std::string output;
+        for (int32_t row = 0; row < R; ++row)
+        {
+            for (int32_t col = 0; col < C; ++col)
+            {
+                output += std::to_string((*this)(row, col)) + "\t";
+            }
+            output += "\n";
+        }
+        std::cout << output;
+    }
+
+    constexpr auto transpose() const -> Matrix<T, C, R>
+    {
+        Matrix<T, C, R> rtn;
+        detail::for_each_index<SIZE>([this, &rtn](const size_t i) {
+            rtn(static_cast<int32_t>(i % C), static_cast<int32_t>(i / C)) = _data[i];
+        });
+        return rtn;
+    }
+
+    auto to_dynamic() const -> Matrix<T>
+    {
+        Matrix<T> rtn(R, C);
+        detail::for_each_index<SIZE>([this, &rtn](const size_t i) {
+            rtn[static_cast<int32_t>(i / C)][i % C] = _data[i];
+        });
+        return rtn;
+    }
+
+    constexpr auto determinant() const -> T
+    {
+        static_assert(R == C, "Determinant needs a square matrix.");
+
+        const auto& m = *this;
+        if constexpr (R == 1)
+        {
+            return m(0, 0);
+        }
+        else if constexpr (R == 2)
+        {
+            return m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+        }
+        else if constexpr (R == 3)
+        {
+            return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1))
+                 - m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0))
+                 + m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+        }
+        else
+        {
+            // gaussian elimination with partial pivoting
+            Matrix lu(*this);
+            T det = 1;
+            for (int32_t k = 0; k < R; ++k)
+            {
+                int32_t pivot = k;
+                for (int32_t row = k + 1; row < R; ++row)
+                    if (std::abs(lu(row, k)) > std::abs(lu(pivot, k))) pivot = row;
+                if (lu(pivot, k) == 0) return 0;
+                if (pivot != k)
+                {
+                    for (int32_t col = 0; col < C; ++col) std::swap(lu(k, col), lu(pivot, col));
+                    det = -det;
+                }
+                det *= lu(k, k);
+                for (int32_t row = k + 1; row < R; ++row)
+                {
+                    const T factor = lu(row, k) / lu(k, k);
+                    for (int32_t col = k; col < C; ++col) lu(row, col) -= factor * lu(k, col);
+                }
+            }
+            return det;
+        }
+    }
+
+    auto inverse() const -> Matrix
+    {
+        static_assert(R == C, "Inverse needs a square matrix.");
+
+        const T det = determinant();
+        if (det == 0)
+        {
+#if defined(MATH_EXCEPTION_ENABLE)
+            throw std::out_of_range("Has no inverse");
+#else
+            return (*this);
+#endif
+        }
+
+        const auto& m = *this;
+        Matrix rtn;
+        if constexpr (R == 1)
+        {
+            rtn(0, 0) = 1 / det;
+        }
+        else if constexpr (R == 2)
+        {
+            rtn(0, 0) = m(1, 1) / det;
+            rtn(0, 1) = -m(0, 1) / det;
+            rtn(1, 0) = -m(1, 0) / det;
+            rtn(1, 1) = m(0, 0) / det;
+        }
+        else if constexpr (R == 3)
+        {
+            // transposed cofactors
+            rtn(0, 0) = (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) / det;
+            rtn(0, 1) = (m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2)) / det;
+            rtn(0, 2) = (m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1)) / det;
+            rtn(1, 0) = (m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2)) / det;
+            rtn(1, 1) = (m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0)) / det;
+            rtn(1, 2) = (m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2)) / det;
+            rtn(2, 0) = (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0)) / det;
+            rtn(2, 1) = (m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1)) / det;
+            rtn(2, 2) = (m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)) / det;
+        }
+        else
+        {
+            // gauss-jordan elimination with partial pivoting
+            Matrix work(*this);
+            for (int32_t k = 0; k < R; ++k) rtn(k, k) = 1;
+            for (int32_t k = 0; k < R; ++k)
+            {
+                int32_t pivot = k;
+                for (int32_t row = k + 1; row < R; ++row)
+                    if (std::abs(work(row, k)) > std::abs(work(pivot, k))) pivot = row;
+                for (int32_t col = 0; col < C; ++col)
+                {
+                    std::swap(work(k, col), work(pivot, col));
+                    std::swap(rtn(k, col), rtn(pivot, col));
+                }
+
+                const T scale = 1 / work(k, k);
+                for (int32_t col = 0; col < C; ++col)
+                {
+                    work(k, col) *= scale;
+                    rtn(k, col) *= scale;
+                }
+                for (int32_t row = 0; row < R; ++row)
+                {
+                    if (row == k) continue;
+                    const T factor = work(row, k);
+                    for (int32_t col = 0; col < C; ++col)
+                    {
+                        work(row, col) -= factor * work(k, col);
+                        rtn(row, col) -= factor * rtn(k, col);
+                    }
+                }
+            }
+        }
+        return rtn;
+    }
+
+    constexpr Matrix& operator+=(const Matrix& rhs)
+    {
+        detail::for_each_index<SIZE>([this, &rhs](const size_t i) { _data[i] += rhs._data[i]; });
+        return *this;
+    }
+
+    constexpr Matrix& operator-=(const Matrix& rhs)
+    {
+        detail::for_each_index<SIZE>([this, &rhs](const size_t i) { _data[i] -= rhs._data[i]; });
+        return *this;
+    }
+
+    constexpr Matrix& operator*=(const T& scalar)
+    {
+        detail::for_each_index<SIZE>([this, &scalar](const size_t i) { _data[i] *= scalar; });
+        return *this;
+    }
+
+    constexpr Matrix& operator/=(const T& scalar)
+    {
+        detail::for_each_index<SIZE>([this, &scalar](const size_t i) { _data[i] /= scalar; });
+        return *this;
+    }
+
+    constexpr bool operator==(const Matrix& rhs) const
+    {
+        for (size_t i = 0; i < SIZE; ++i)
+            if (_data[i] != rhs._data[i]) return false;
+        return true;
+    }
+
+    constexpr bool operator!=(const Matrix& rhs) const { return !(*this == rhs); }
+};
+
+template <typename T, int32_t R1, int32_t C1, int32_t R2, int32_t C2,
+          typename = std::enable_if_t<detail::is_fixed<R1, C1, R2, C2>>>
+constexpr Matrix<T, R1, C1> operator+(const Matrix<T, R1, C1>& lhs, const Matrix<T, R2, C2>& rhs)
+{
+    static_assert(R1 == R2 && C1 == C2, "Matrix size not matched.");
+    Matrix<T, R1, C1> rtn(lhs);
+    rtn += rhs;
+    return rtn;
+}
+
+template <typename T, int32_t R1, int32_t C1, int32_t R2, int32_t C2,
+          typename = std::enable_if_t<detail::is_fixed<R1, C1, R2, C2>>>
+constexpr Matrix<T, R1, C1> operator-(const Matrix<T, R1, C1>& lhs, const Matrix<T, R2, C2>& rhs)
+{
+    static_assert(R1 == R2 && C1 == C2, "Matrix size not matched.");
+    Matrix<T, R1, C1> rtn(lhs);
+    rtn -= rhs;
+    return rtn;
+}
+
+template <typename T, int32_t R, int32_t C, typename = std::enable_if_t<detail::is_fixed<R, C>>>
+constexpr Matrix<T, R, C> operator-(const Matrix<T, R, C>& mat)
+{
+    Matrix<T, R, C> rtn;
+    detail::for_each_index<static_cast<size_t>(R * C)>([&rtn, &mat](const size_t i) { rtn.data()[i] = -mat.data()[i]; });
+    return rtn;
+}
+
+template <typename T, int32_t R, int32_t K1, int32_t K2, int32_t C,
+          typename = std::enable_if_t<detail::is_fixed<R, K1, K2, C>>>
+constexpr Matrix<T, R, C> operator*(const Matrix<T, R, K1>& lhs, const Matrix<T, K2, C>& rhs)
+{
+    static_assert(K1 == K2, "Matrix size not matched.");
+    Matrix<T, R, C> rtn;
+    detail::for_each_index<static_cast<size_t>(R * C)>([&rtn, &lhs, &rhs](const size_t i) {
+        const int32_t row = static_cast<int32_t>(i / C);
+        const int32_t col = static_cast<int32_t>(i % C);
+        T sum = lhs(row, 0) * rhs(0, col);
+        detail::for_each_index<static_cast<size_t>(K1 - 1)>([&sum, &lhs, &rhs, row, col](const size_t k) {
+            sum += lhs(row, static_cast<int32_t>(k + 1)) * rhs(static_cast<int32_t>(k + 1), col);
+        });
+        rtn(row, col) = sum;
+    });
+    return rtn;
+}
+
+template <typename T, int32_t R, int32_t C, typename = std::enable_if_t<detail::is_fixed<R, C>>>
+constexpr Matrix<T, R, C> operator*(const Matrix<T, R, C>& lhs, const T& scalar)
+{
+    Matrix<T, R, C> rtn(lhs);
+    rtn *= scalar;
+    return rtn;
+}
+
+template <typename T, int32_t R, int32_t C, typename = std::enable_if_t<detail::is_fixed<R, C>>>
+constexpr Matrix<T, R, C> operator*(const T& scalar, const Matrix<T, R, C>& rhs)
+{
+    return rhs * scalar;
+}
+
+template <typename T, int32_t R, int32_t C, typename = std::enable_if_t<detail::is_fixed<R, C>>>
+constexpr Matrix<T, R, C> operator/(const Matrix<T, R, C>& lhs, const T& scalar)
+{
+    Matrix<T, R, C> rtn(lhs);
+    rtn /= scalar;
+    return rtn;
+}
+
+namespace util
+{
+template <typename T, int32_t R, int32_t C = R, typename = std::enable_if_t<detail::is_fixed<R, C>>>
+constexpr auto eye() -> Matrix<T, R, C>
+{
+    Matrix<T, R, C> rtn;
+    for (int32_t x = 0; x < (R < C ? R : C); ++x)
+        rtn(x, x) = 1;
+    return rtn;
+};
+
+template <typename T, int32_t N, typename = std::enable_if_t<detail::is_fixed<N>>>
+auto inverse(const Matrix<T, N, N>& mat) -> Matrix<T, N, N>
+{
+    return mat.inverse();
+};
+} // namespace util
 } // namespace common::math
\ No newline at end of file
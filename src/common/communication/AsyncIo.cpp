@@ -0,0 +1,913 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include "common/communication/AsyncIo.hpp"
+#include "common/logging/Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include <unistd.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+
+#if defined(COMMON_LIB_HAS_IO_URING)
+#include <linux/io_uring.h>
+#include <linux/time_types.h>
+#endif
+
+namespace common
+{
+namespace detail
+{
+class IoRequest
+{
+public :
+    enum type : uint8_t
+    {
+        READ,
+        WRITE,
+        RECV_MULTISHOT,
+    };
+};
+
+#if defined(COMMON_LIB_HAS_IO_URING)
+/**
+ * @brief io_uring backend talking to the kernel ABI directly (no liburing dependency)
+ */
+class UringIo final : public AsyncIo
+{
+private :
+    static constexpr uint64_t INTERNAL_REQUEST = UINT64_MAX;
+    static constexpr uint64_t REMOVE_BUFFERS_REQUEST = uint64_t{1} << 63;    // | group
+    static constexpr uint64_t CANCEL_FD_REQUEST = uint64_t{1} << 62;         // | fd
+
+    struct Request
+    {
+        IoRequest::type _type = IoRequest::READ;
+        int32_t _fd = -1;
+        uint16_t _group = 0;
+        bool _used = false;
+        Completion _completion;
+        RecvHandler _handler;
+    };
+
+    struct BufferGroup
+    {
+        std::vector<uint8_t> _memory;
+        size_t _size = 0;
+        uint16_t _count = 0;
+    };
+
+    int32_t _ring = -1;
+    uint32_t _sqEntries = 0;
+
+    void* _sqPtr = MAP_FAILED;
+    size_t _sqSize = 0;
+    void* _cqPtr = MAP_FAILED;
+    size_t _cqSize = 0;
+    io_uring_sqe* _sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t _sqesSize = 0;
+
+    uint32_t* _sqHead = nullptr;
+    uint32_t* _sqTail = nullptr;
+    uint32_t _sqMask = 0;
+    uint32_t* _sqArray = nullptr;
+    uint32_t _sqLocalTail = 0;
+
+    uint32_t* _cqHead = nullptr;
+    uint32_t* _cqTail = nullptr;
+    uint32_t _cqMask = 0;
+    io_uring_cqe* _cqes = nullptr;
+
+    bool _extArg = false;
+
+    std::vector<Request> _requests;
+    std::vector<uint32_t> _freeRequests;
+    size_t _pending = 0;
+
+    std::unordered_map<int32_t, int32_t> _fixedFiles;
+    std::vector<iovec> _buffers;
+    std::unordered_map<uint16_t, BufferGroup> _groups;     // alive until the kernel gave back every buffer
+    std::vector<uint16_t> _retiring;                         // groups still waiting for a REMOVE_BUFFERS slot
+    std::vector<std::pair<uint32_t, int32_t>> _canceling;     // requests (index, fd) still waiting for a cancel slot
+    uint16_t _nextGroup = 0;
+
+public :
+    explicit UringIo(const uint32_t depth) noexcept
+    {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        params.flags = IORING_SETUP_COOP_TASKRUN;
+        _ring = static_cast<int32_t>(syscall(__NR_io_uring_setup, depth, &params));
+        if(_ring < 0 && errno == EINVAL)
+        {
+            std::memset(&params, 0, sizeof(params));
+            _ring = static_cast<int32_t>(syscall(__NR_io_uring_setup, depth, &params));
+        }
+        if(_ring < 0) { return; }
+
+        _sqEntries = params.sq_entries;
+        _extArg = (params.features & IORING_FEAT_EXT_ARG) != 0;
+
+        _sqSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        _cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if(singleMmap) { _sqSize = _cqSize = std::max(_sqSize, _cqSize); }
+
+        _sqPtr = mmap(nullptr, _sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring, IORING_OFF_SQ_RING);
+        if(_sqPtr == MAP_FAILED) { release(); return; }
+
+        _cqPtr = singleMmap ? _sqPtr
+                            : mmap(nullptr, _cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring, IORING_OFF_CQ_RING);
+        if(_cqPtr == MAP_FAILED) { release(); return; }
+
+        _sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        _sqes = static_cast<io_uring_sqe*>(mmap(nullptr, _sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring, IORING_OFF_SQES));
+        if(_sqes == MAP_FAILED) { release(); return; }
+
+        auto* sq = static_cast<uint8_t*>(_sqPtr);
+        _sqHead = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+        _sqTail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+        _sqMask = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+        _sqArray = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+        _sqLocalTail = *_sqTail;
+
+        auto* cq = static_cast<uint8_t*>(_cqPtr);
+        _cqHead = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+        _cqTail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+        _cqMask = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+        _cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        _requests.resize(params.cq_entries);
+        _freeRequests.reserve(params.cq_entries);
+        for(uint32_t i = params.cq_entries; i > 0; --i) { _freeRequests.push_back(i - 1); }
+    }
+
+    ~UringIo() final { release(); }
+
+public :
+    auto is_valid() const noexcept -> bool { return _ring >= 0 && _sqes != MAP_FAILED; }
+
+    auto get_backend() const noexcept -> IoBackend::type override { return IoBackend::IO_URING; }
+
+    auto register_files(const int32_t* fds, const size_t count) noexcept -> bool override
+    {
+        if(!_fixedFiles.empty())
+        {
+            syscall(__NR_io_uring_register, _ring, IORING_UNREGISTER_FILES, nullptr, 0);
+            _fixedFiles.clear();
+        }
+        if(syscall(__NR_io_uring_register, _ring, IORING_REGISTER_FILES, fds, count) < 0)
+        {
+            _ERROR_("io_uring register files error: %s", strerror(errno));
+            return false;
+        }
+        for(size_t i = 0; i < count; ++i) { _fixedFiles[fds[i]] = static_cast<int32_t>(i); }
+        return true;
+    }
+
+    auto register_buffers(const iovec* buffers, const size_t count) noexcept -> bool override
+    {
+        if(!_buffers.empty())
+        {
+            syscall(__NR_io_uring_register, _ring, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+            _buffers.clear();
+        }
+        if(syscall(__NR_io_uring_register, _ring, IORING_REGISTER_BUFFERS, buffers, count) < 0)
+        {
+            _ERROR_("io_uring register buffers error: %s", strerror(errno));
+            return false;
+        }
+        _buffers.assign(buffers, buffers + count);
+        return true;
+    }
+
+    auto read(const int32_t fd, void* buffer, const size_t size, Completion completion) noexcept -> bool override
+    {
+        return prepare_rw(IORING_OP_READ, fd, buffer, size, 0, std::move(completion));
+    }
+
+    auto write(const int32_t fd, const void* buffer, const size_t size, Completion completion) noexcept -> bool override
+    {
+        return prepare_rw(IORING_OP_WRITE, fd, const_cast<void*>(buffer), size, 0, std::move(completion));
+    }
+
+    auto read_fixed(const int32_t fd,
+                    const uint16_t bufferIndex,
+                    const size_t offset,
+                    const size_t size,
+                    Completion completion) noexcept -> bool override
+    {
+        if(bufferIndex >= _buffers.size() || offset + size > _buffers[bufferIndex].iov_len) { return false; }
+        auto* buffer = static_cast<uint8_t*>(_buffers[bufferIndex].iov_base) + offset;
+        return prepare_rw(IORING_OP_READ_FIXED, fd, buffer, size, bufferIndex, std::move(completion));
+    }
+
+    auto write_fixed(const int32_t fd,
+                     const uint16_t bufferIndex,
+                     const size_t offset,
+                     const size_t size,
+                     Completion completion) noexcept -> bool override
+    {
+        if(bufferIndex >= _buffers.size() || offset + size > _buffers[bufferIndex].iov_len) { return false; }
+        auto* buffer = static_cast<uint8_t*>(_buffers[bufferIndex].iov_base) + offset;
+        return prepare_rw(IORING_OP_WRITE_FIXED, fd, buffer, size, bufferIndex, std::move(completion));
+    }
+
+    auto recv_multishot(const int32_t fd,
+                        const size_t bufferSize,
+                        const uint16_t bufferCount,
+                        RecvHandler handler) noexcept -> bool override
+    {
+        if(bufferSize == 0 || bufferCount == 0 || _freeRequests.empty()) { return false; }
+        if(_groups.size() > UINT16_MAX) { return false; }
+
+        uint16_t group = _nextGroup++;
+        while(_groups.find(group) != _groups.end()) { group = _nextGroup++; }
+        BufferGroup& bufferGroup = _groups[group];
+        bufferGroup._memory.resize(bufferSize * bufferCount);
+        bufferGroup._size = bufferSize;
+        bufferGroup._count = bufferCount;
+        if(!provide_buffers(group, 0, bufferCount))
+        {
+            _groups.erase(group);
+            return false;
+        }
+
+        const uint32_t index = acquire();
+        Request& request = _requests[index];
+        request._type = IoRequest::RECV_MULTISHOT;
+        request._fd = fd;
+        request._group = group;
+        request._handler = std::move(handler);
+        if(!prepare_recv(index))
+        {
+            // the queued PROVIDE_BUFFERS hands the memory to the kernel, which must give it back first
+            retire_group(group);
+            free(index);
+            return false;
+        }
+        return true;
+    }
+
+    auto cancel(const int32_t fd) noexcept -> bool override
+    {
+        io_uring_sqe* sqe = get_sqe();
+        if(!sqe) { return false; }
+
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+        auto itor = _fixedFiles.find(fd);
+        if(itor != _fixedFiles.end())
+        {
+            sqe->fd = itor->second;
+            sqe->cancel_flags |= IORING_ASYNC_CANCEL_FD_FIXED;
+        }
+        else { sqe->fd = fd; }
+        sqe->user_data = CANCEL_FD_REQUEST | static_cast<uint32_t>(fd);
+        submit();
+        return true;
+    }
+
+    auto submit() noexcept -> int32_t override
+    {
+        const uint32_t toSubmit = _sqLocalTail - *_sqTail;
+        if(toSubmit == 0) { return 0; }
+
+        __atomic_store_n(_sqTail, _sqLocalTail, __ATOMIC_RELEASE);
+        int32_t rtn = 0;
+        do
+        {
+            rtn = static_cast<int32_t>(syscall(__NR_io_uring_enter, _ring, toSubmit, 0, 0, nullptr, 0));
+        } while(rtn < 0 && errno == EINTR);
+        return rtn < 0 ? -errno : rtn;
+    }
+
+    auto poll(const std::chrono::milliseconds timeout) noexcept -> size_t override
+    {
+        if(!_retiring.empty())
+        {
+            std::vector<uint16_t> retiring;
+            retiring.swap(_retiring);
+            for(const auto group : retiring) { retire_group(group); }
+        }
+        if(!_canceling.empty())
+        {
+            std::vector<std::pair<uint32_t, int32_t>> canceling;
+            canceling.swap(_canceling);
+            for(const auto& [index, fd] : canceling) { cancel_request(index, fd); }
+        }
+        submit();
+        size_t handled = reap();
+        if(handled > 0 || timeout.count() <= 0 || _pending == 0) { return handled; }
+
+        if(_extArg)
+        {
+            __kernel_timespec ts;
+            ts.tv_sec = timeout.count() / 1000;
+            ts.tv_nsec = (timeout.count() % 1000) * 1000000;
+            io_uring_getevents_arg arg;
+            std::memset(&arg, 0, sizeof(arg));
+            arg.ts = reinterpret_cast<uint64_t>(&ts);
+            syscall(__NR_io_uring_enter, _ring, 0, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+        }
+        else
+        {
+            pollfd pfd{_ring, POLLIN, 0};
+            ::poll(&pfd, 1, static_cast<int32_t>(timeout.count()));
+        }
+        return reap();
+    }
+
+    auto get_pending() const noexcept -> size_t override { return _pending; }
+
+private :
+    auto acquire() noexcept -> uint32_t
+    {
+        const uint32_t index = _freeRequests.back();
+        _freeRequests.pop_back();
+        _requests[index]._used = true;
+        ++_pending;
+        return index;
+    }
+
+    auto free(const uint32_t index) noexcept -> void
+    {
+        Request& request = _requests[index];
+        request._used = false;
+        request._completion = nullptr;
+        request._handler = nullptr;
+        _freeRequests.push_back(index);
+        --_pending;
+    }
+
+    auto get_sqe() noexcept -> io_uring_sqe*
+    {
+        if(_sqLocalTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) >= _sqEntries)
+        {
+            submit();
+            if(_sqLocalTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) >= _sqEntries) { return nullptr; }
+        }
+
+        const uint32_t index = _sqLocalTail & _sqMask;
+        io_uring_sqe* sqe = &_sqes[index];
+        std::memset(sqe, 0, sizeof(io_uring_sqe));
+        _sqArray[index] = index;
+        ++_sqLocalTail;
+        return sqe;
+    }
+
+    auto set_file(io_uring_sqe* sqe, const int32_t fd) noexcept -> void
+    {
+        auto itor = _fixedFiles.find(fd);
+        if(itor != _fixedFiles.end())
+        {
+            sqe->fd = itor->second;
+            sqe->flags |= IOSQE_FIXED_FILE;
+        }
+        else { sqe->fd = fd; }
+    }
+
+    auto prepare_rw(const uint8_t opcode,
+                    const int32_t fd,
+                    void* buffer,
+                    const size_t size,
+                    const uint16_t bufferIndex,
+                    Completion completion) noexcept -> bool
+    {
+        if(_freeRequests.empty()) { return false; }
+        io_uring_sqe* sqe = get_sqe();
+        if(!sqe) { return false; }
+
+        const uint32_t index = acquire();
+        Request& request = _requests[index];
+        request._type = (opcode == IORING_OP_READ || opcode == IORING_OP_READ_FIXED) ? IoRequest::READ : IoRequest::WRITE;
+        request._fd = fd;
+        request._completion = std::move(completion);
+
+        sqe->opcode = opcode;
+        set_file(sqe, fd);
+        sqe->addr = reinterpret_cast<uint64_t>(buffer);
+        sqe->len = static_cast<uint32_t>(size);
+        sqe->off = static_cast<uint64_t>(-1); // current position, also valid for sockets and ttys
+        sqe->buf_index = bufferIndex;
+        sqe->user_data = index;
+        return true;
+    }
+
+    auto prepare_recv(const uint32_t index) noexcept -> bool
+    {
+        io_uring_sqe* sqe = get_sqe();
+        if(!sqe) { return false; }
+
+        const Request& request = _requests[index];
+        sqe->opcode = IORING_OP_RECV;
+        set_file(sqe, request._fd);
+        sqe->flags |= IOSQE_BUFFER_SELECT;
+        sqe->buf_group = request._group;
+        sqe->ioprio = IORING_RECV_MULTISHOT;
+        sqe->user_data = index;
+        return true;
+    }
+
+    auto provide_buffers(const uint16_t group, const uint16_t bufferId, const uint16_t count) noexcept -> bool
+    {
+        io_uring_sqe* sqe = get_sqe();
+        if(!sqe) { return false; }
+
+        BufferGroup& bufferGroup = _groups[group];
+        sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+        sqe->fd = count;
+        sqe->addr = reinterpret_cast<uint64_t>(bufferGroup._memory.data() + bufferGroup._size * bufferId);
+        sqe->len = static_cast<uint32_t>(bufferGroup._size);
+        sqe->off = bufferId;
+        sqe->buf_group = group;
+        sqe->user_data = INTERNAL_REQUEST;
+        return true;
+    }
+
+    /**
+     * @brief Asks the kernel to drop the buffers of group, the memory is freed on completion
+     */
+    auto retire_group(const uint16_t group) noexcept -> void
+    {
+        io_uring_sqe* sqe = get_sqe();
+        if(!sqe)
+        {
+            _retiring.push_back(group);
+            return;
+        }
+
+        sqe->opcode = IORING_OP_REMOVE_BUFFERS;
+        sqe->fd = _groups[group]._count;
+        sqe->buf_group = group;
+        sqe->user_data = REMOVE_BUFFERS_REQUEST | group;
+    }
+
+    /**
+     * @brief Cancels one request by its user_data, for kernels that cannot cancel by file descriptor
+     */
+    auto cancel_request(const uint32_t index, const int32_t fd) noexcept -> void
+    {
+        // the request may have completed and its slot been reused meanwhile
+        if(!_requests[index]._used || _requests[index]._fd != fd) { return; }
+        io_uring_sqe* sqe = get_sqe();
+        if(!sqe)
+        {
+            _canceling.emplace_back(index, fd);
+            return;
+        }
+
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->addr = index;
+        sqe->user_data = INTERNAL_REQUEST;
+    }
+
+    auto reap() noexcept -> size_t
+    {
+        size_t handled = 0;
+        uint32_t head = *_cqHead;
+        while(head != __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE))
+        {
+            const io_uring_cqe cqe = _cqes[head & _cqMask];
+            __atomic_store_n(_cqHead, ++head, __ATOMIC_RELEASE);
+
+            // Completions of internal requests (provide buffers, cancel) are simply consumed.
+            if(cqe.user_data == INTERNAL_REQUEST) { continue; }
+            if(cqe.user_data & REMOVE_BUFFERS_REQUEST)
+            {
+                // provides of the group were queued before the removal and run in submission order
+                _groups.erase(static_cast<uint16_t>(cqe.user_data));
+                continue;
+            }
+            if(cqe.user_data & CANCEL_FD_REQUEST)
+            {
+                // IORING_ASYNC_CANCEL_FD needs 5.19, with a fixed file 6.0: cancel each request instead
+                if(cqe.res == -EINVAL)
+                {
+                    const auto fd = static_cast<int32_t>(static_cast<uint32_t>(cqe.user_data));
+                    for(uint32_t index = 0; index < _requests.size(); ++index) { cancel_request(index, fd); }
+                }
+                continue;
+            }
+            complete(static_cast<uint32_t>(cqe.user_data), cqe.res, cqe.flags);
+            ++handled;
+        }
+        return handled;
+    }
+
+    auto complete(const uint32_t index, const int32_t result, const uint32_t flags) noexcept -> void
+    {
+        Request& request = _requests[index];
+        if(!request._used) { return; }
+
+        if(request._type != IoRequest::RECV_MULTISHOT)
+        {
+            Completion completion = std::move(request._completion);
+            free(index);
+            if(completion) { completion(result); }
+            return;
+        }
+
+        const uint16_t group = request._group;
+        if(result > 0 && (flags & IORING_CQE_F_BUFFER))
+        {
+            const uint16_t bufferId = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+            BufferGroup& bufferGroup = _groups[group];
+            request._handler(bufferGroup._memory.data() + bufferGroup._size * bufferId, result);
+            provide_buffers(group, bufferId, 1);
+        }
+
+        if(flags & IORING_CQE_F_MORE) { return; }
+
+        if(result == -ENOBUFS || result > 0)
+        {
+            // Multishot was terminated because the provided buffers ran out. Arm again.
+            if(prepare_recv(index)) { return; }
+        }
+
+        RecvHandler handler = std::move(request._handler);
+        free(index);
+        retire_group(group);
+        if(handler) { handler(nullptr, result > 0 ? -ENOBUFS : result); }
+    }
+
+    auto release() noexcept -> void
+    {
+        if(_sqes != MAP_FAILED) { munmap(_sqes, _sqesSize); _sqes = static_cast<io_uring_sqe*>(MAP_FAILED); }
+        if(_cqPtr != MAP_FAILED && _cqPtr != _sqPtr) { munmap(_cqPtr, _cqSize); }
+        _cqPtr = MAP_FAILED;
+        if(_sqPtr != MAP_FAILED) { munmap(_sqPtr, _sqSize); _sqPtr = MAP_FAILED; }
+        if(_ring >= 0) { ::close(_ring); _ring = -1; }
+    }
+};
+#endif
+
+/**
+ * @brief epoll backend performing requests when their descriptors become ready
+ */
+class EpollIo final : public AsyncIo
+{
+private :
+    struct Operation
+    {
+        IoRequest::type _type = IoRequest::READ;
+        int32_t _fd = -1;
+        uint8_t* _buffer = nullptr;
+        size_t _size = 0;
+        Completion _completion;
+        RecvHandler _handler;
+        std::vector<uint8_t> _recvBuffer;
+    };
+
+    int32_t _epoll = -1;
+    const uint32_t _depth;
+
+    std::deque<Operation> _queued;
+    std::unordered_map<int32_t, std::deque<Operation>> _waiting;
+    std::unordered_map<int32_t, uint32_t> _interests;
+    std::vector<std::pair<Completion, int32_t>> _completed;
+    std::vector<iovec> _buffers;
+    size_t _pending = 0;
+
+public :
+    explicit EpollIo(const uint32_t depth) noexcept
+        : _depth(depth)
+    {
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+    }
+
+    ~EpollIo() final
+    {
+        if(_epoll >= 0) { ::close(_epoll); }
+    }
+
+public :
+    auto is_valid() const noexcept -> bool { return _epoll >= 0; }
+
+    auto get_backend() const noexcept -> IoBackend::type override { return IoBackend::EPOLL; }
+
+    auto register_files(const int32_t*, const size_t) noexcept -> bool override { return true; }
+
+    auto register_buffers(const iovec* buffers, const size_t count) noexcept -> bool override
+    {
+        _buffers.assign(buffers, buffers + count);
+        return true;
+    }
+
+    auto read(const int32_t fd, void* buffer, const size_t size, Completion completion) noexcept -> bool override
+    {
+        return enqueue(IoRequest::READ, fd, static_cast<uint8_t*>(buffer), size, std::move(completion));
+    }
+
+    auto write(const int32_t fd, const void* buffer, const size_t size, Completion completion) noexcept -> bool override
+    {
+        return enqueue(IoRequest::WRITE, fd, static_cast<uint8_t*>(const_cast<void*>(buffer)), size, std::move(completion));
+    }
+
+    auto read_fixed(const int32_t fd,
+                    const uint16_t bufferIndex,
+                    const size_t offset,
+                    const size_t size,
+                    Completion completion) noexcept -> bool override
+    {
+        if(bufferIndex >= _buffers.size() || offset + size > _buffers[bufferIndex].iov_len) { return false; }
+        auto* buffer = static_cast<uint8_t*>(_buffers[bufferIndex].iov_base) + offset;
+        return enqueue(IoRequest::READ, fd, buffer, size, std::move(completion));
+    }
+
+    auto write_fixed(const int32_t fd,
+                     const uint16_t bufferIndex,
+                     const size_t offset,
+                     const size_t size,
+                     Completion completion) noexcept -> bool override
+    {
+        if(bufferIndex >= _buffers.size() || offset + size > _buffers[bufferIndex].iov_len) { return false; }
+        auto* buffer = static_cast<uint8_t*>(_buffers[bufferIndex].iov_base) + offset;
+        return enqueue(IoRequest::WRITE, fd, buffer, size, std::move(completion));
+    }
+
+    auto recv_multishot(const int32_t fd,
+                        const size_t bufferSize,
+                        const uint16_t bufferCount,
+                        RecvHandler handler) noexcept -> bool override
+    {
+        if(bufferSize == 0 || bufferCount == 0 || _pending >= _depth) { return false; }
+
+        Operation operation;
+        operation._type = IoRequest::RECV_MULTISHOT;
+        operation._fd = fd;
+        operation._handler = std::move(handler);
+        operation._recvBuffer.resize(bufferSize);
+        _queued.push_back(std::move(operation));
+        ++_pending;
+        return true;
+    }
+
+    auto cancel(const int32_t fd) noexcept -> bool override
+    {
+        auto complete_canceled = [this](Operation& operation) {
+            if(operation._type == IoRequest::RECV_MULTISHOT)
+            {
+                RecvHandler handler = std::move(operation._handler);
+                _completed.emplace_back([handler](const int32_t result){ handler(nullptr, result); }, -ECANCELED);
+            }
+            else { _completed.emplace_back(std::move(operation._completion), -ECANCELED); }
+        };
+
+        for(auto itor = _queued.begin(); itor != _queued.end();)
+        {
+            if(itor->_fd != fd) { ++itor; continue; }
+            complete_canceled(*itor);
+            itor = _queued.erase(itor);
+        }
+
+        auto waiting = _waiting.find(fd);
+        if(waiting != _waiting.end())
+        {
+            for(auto& operation : waiting->second) { complete_canceled(operation); }
+            _waiting.erase(waiting);
+        }
+        update_interest(fd);
+        return true;
+    }
+
+    auto submit() noexcept -> int32_t override
+    {
+        int32_t submitted = 0;
+        while(!_queued.empty())
+        {
+            Operation operation = std::move(_queued.front());
+            _queued.pop_front();
+            const int32_t fd = operation._fd;
+            _waiting[fd].push_back(std::move(operation));
+            update_interest(fd);
+            ++submitted;
+        }
+        return submitted;
+    }
+
+    auto poll(const std::chrono::milliseconds timeout) noexcept -> size_t override
+    {
+        submit();
+        if(_completed.empty() && !_waiting.empty())
+        {
+            std::array<epoll_event, 64> events;
+            const int32_t count = epoll_wait(_epoll, events.data(), static_cast<int32_t>(events.size()),
+                                             static_cast<int32_t>(timeout.count()));
+            for(int32_t i = 0; i < count; ++i) { perform(events[i].data.fd, events[i].events); }
+        }
+
+        std::vector<std::pair<Completion, int32_t>> completed;
+        completed.swap(_completed);
+        for(auto& [completion, result] : completed)
+        {
+            --_pending;
+            if(completion) { completion(result); }
+        }
+        return completed.size();
+    }
+
+    auto get_pending() const noexcept -> size_t override { return _pending; }
+
+private :
+    auto enqueue(const IoRequest::type type,
+                 const int32_t fd,
+                 uint8_t* buffer,
+                 const size_t size,
+                 Completion completion) noexcept -> bool
+    {
+        if(_pending >= _depth) { return false; }
+
+        Operation operation;
+        operation._type = type;
+        operation._fd = fd;
+        operation._buffer = buffer;
+        operation._size = size;
+        operation._completion = std::move(completion);
+        _queued.push_back(std::move(operation));
+        ++_pending;
+        return true;
+    }
+
+    auto perform(const int32_t fd, const uint32_t events) noexcept -> void
+    {
+        auto waiting = _waiting.find(fd);
+        if(waiting == _waiting.end()) { return; }
+
+        auto& operations = waiting->second;
+        const bool broken = (events & (EPOLLERR | EPOLLHUP)) != 0;
+        for(auto itor = operations.begin(); itor != operations.end();)
+        {
+            const bool readable = (events & EPOLLIN) != 0 || broken;
+            const bool writable = (events & EPOLLOUT) != 0 || broken;
+
+            if(itor->_type == IoRequest::WRITE)
+            {
+                if(!writable) { ++itor; continue; }
+                const ssize_t rtn = ::write(fd, itor->_buffer, itor->_size);
+                if(rtn < 0 && (errno == EAGAIN || errno == EINTR)) { ++itor; continue; }
+                _completed.emplace_back(std::move(itor->_completion), rtn < 0 ? -errno : static_cast<int32_t>(rtn));
+                itor = operations.erase(itor);
+            }
+            else if(itor->_type == IoRequest::READ)
+            {
+                if(!readable) { ++itor; continue; }
+                const ssize_t rtn = ::read(fd, itor->_buffer, itor->_size);
+                if(rtn < 0 && (errno == EAGAIN || errno == EINTR)) { ++itor; continue; }
+                _completed.emplace_back(std::move(itor->_completion), rtn < 0 ? -errno : static_cast<int32_t>(rtn));
+                itor = operations.erase(itor);
+            }
+            else
+            {
+                if(!readable) { ++itor; continue; }
+                if(receive(*itor)) { ++itor; continue; }
+                itor = operations.erase(itor);
+            }
+        }
+
+        if(operations.empty()) { _waiting.erase(waiting); }
+        update_interest(fd);
+    }
+
+    /**
+     * @return bool True if the multishot receive is still active
+     */
+    auto receive(Operation& operation) noexcept -> bool
+    {
+        while(true)
+        {
+            const ssize_t rtn = ::recv(operation._fd, operation._recvBuffer.data(), operation._recvBuffer.size(), MSG_DONTWAIT);
+            if(rtn > 0)
+            {
+                operation._handler(operation._recvBuffer.data(), static_cast<int32_t>(rtn));
+                continue;
+            }
+            if(rtn < 0 && errno == EINTR) { continue; }
+            if(rtn < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) { return true; }
+
+            RecvHandler handler = std::move(operation._handler);
+            _completed.emplace_back([handler](const int32_t result){ handler(nullptr, result); },
+                                    rtn < 0 ? -errno : 0);
+            return false;
+        }
+    }
+
+    auto update_interest(const int32_t fd) noexcept -> void
+    {
+        uint32_t interest = 0;
+        auto waiting = _waiting.find(fd);
+        if(waiting != _waiting.end())
+        {
+            for(const auto& operation : waiting->second)
+            {
+                interest |= operation._type == IoRequest::WRITE ? EPOLLOUT : EPOLLIN;
+            }
+        }
+
+        auto current = _interests.find(fd);
+        if(interest == 0)
+        {
+            if(current == _interests.end()) { return; }
+            epoll_ctl(_epoll, EPOLL_CTL_DEL, fd, nullptr);
+            _interests.erase(current);
+            return;
+        }
+
+        epoll_event event{};
+        event.events = interest;
+        event.data.fd = fd;
+        if(current == _interests.end())
+        {
+            if(epoll_ctl(_epoll, EPOLL_CTL_ADD, fd, &event) < 0)
+            {
+                fail_all(fd, -errno);
+                return;
+            }
+            _interests[fd] = interest;
+        }
+        else if(current->second != interest)
+        {
+            epoll_ctl(_epoll, EPOLL_CTL_MOD, fd, &event);
+            current->second = interest;
+        }
+    }
+
+    auto fail_all(const int32_t fd, const int32_t result) noexcept -> void
+    {
+        auto waiting = _waiting.find(fd);
+        if(waiting == _waiting.end()) { return; }
+        for(auto& operation : waiting->second)
+        {
+            if(operation._type == IoRequest::RECV_MULTISHOT)
+            {
+                RecvHandler handler = std::move(operation._handler);
+                _completed.emplace_back([handler](const int32_t rtn){ handler(nullptr, rtn); }, result);
+            }
+            else { _completed.emplace_back(std::move(operation._completion), result); }
+        }
+        _waiting.erase(waiting);
+    }
+};
+} // namespace detail
+
+auto AsyncIo::__create(IoBackend::type backend /* = IoBackend::AUTO */,
+                       uint32_t depth /* = 256 */) noexcept -> std::shared_ptr<AsyncIo>
+{
+#if defined(COMMON_LIB_HAS_IO_URING)
+    if(backend == IoBackend::AUTO || backend == IoBackend::IO_URING)
+    {
+        auto uring = std::make_shared<detail::UringIo>(depth);
+        if(uring->is_valid()) { return uring; }
+        if(backend == IoBackend::IO_URING)
+        {
+            _ERROR_("io_uring is not available: %s", strerror(errno));
+            return nullptr;
+        }
+    }
+#else
+    if(backend == IoBackend::IO_URING)
+    {
+        _ERROR_("io_uring is not compiled in");
+        return nullptr;
+    }
+#endif
+
+    auto epoll = std::make_shared<detail::EpollIo>(depth);
+    return epoll->is_valid() ? epoll : nullptr;
+}
+} // namespace common
+
+#endif
@@ -0,0 +1,384 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include "common/communication/DatagramSocket.hpp"
+#include "common/Exception.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <unistd.h>
+#include <poll.h>
+#include <arpa/inet.h>
+#include <netinet/udp.h>
+
+namespace common
+{
+namespace
+{
+// Room for SCM_TIMESTAMPNS and UDP_GRO control messages of one datagram
+constexpr size_t CONTROL_SIZE = CMSG_SPACE(sizeof(timespec)) + CMSG_SPACE(sizeof(int32_t));
+
+// sendmmsg()/recvmmsg() handle at most UIO_MAXIOV messages per call
+constexpr size_t MAX_BATCH = 1024;
+
+// a UDP_SEGMENT send carries at most 64 segments and one IPv4 datagram of payload
+constexpr size_t GSO_MAX_SEGMENTS = 64;
+constexpr size_t GSO_MAX_PAYLOAD = 65535 - 20 - 8;
+
+auto throw_error(const char* prefix) -> void
+{
+    const int32_t errNo = errno;
+    std::string what(prefix);
+    what += strerror(errNo);
+    throw CommunicationException(what);
+}
+
+auto to_address(const std::string& address, const int32_t port) -> sockaddr_in
+{
+    sockaddr_in addrIn{};
+    addrIn.sin_family = AF_INET;
+    addrIn.sin_port = htons(port);
+    if(inet_pton(AF_INET, address.c_str(), &addrIn.sin_addr) <= 0)
+    {
+        throw CommunicationException("Invalid address:" + address);
+    }
+    return addrIn;
+}
+} // namespace
+
+DatagramBatch::DatagramBatch(const size_t capacity, const size_t bufferSize)
+    : _capacity(std::max<size_t>(capacity, 1)),
+      _bufferSize(bufferSize),
+      _buffers(_capacity * bufferSize),
+      _iov(_capacity),
+      _headers(_capacity),
+      _addresses(_capacity),
+      _controls(_capacity * CONTROL_SIZE),
+      _timestamps(_capacity),
+      _segmentSizes(_capacity)
+{
+    for(size_t i = 0; i < _capacity; ++i)
+    {
+        _iov[i].iov_base = _buffers.data() + i * _bufferSize;
+        _iov[i].iov_len = _bufferSize;
+    }
+}
+
+namespace detail
+{
+class DatagramSocketDetail final : public DatagramSocket
+{
+private :
+    const SocketType::type _socketType;
+    int32_t _fd = -1;
+    int32_t _port = -1;
+    std::string _address;
+    sockaddr_in _destination{};
+    in_addr _interface{};
+    bool _gso = true;
+
+public :
+    explicit DatagramSocketDetail(const SocketType::type socketType) noexcept
+        : _socketType(socketType)
+    {
+        _interface.s_addr = htonl(INADDR_ANY);
+    }
+
+    ~DatagramSocketDetail() final { close(); }
+
+public :
+    auto prepare(const std::string& address, const int32_t port) -> void override
+    {
+        _address = address;
+        _port = port;
+
+        _fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if(_fd < 0) { throw_error("Socket error:"); }
+
+        int32_t opt = 1;
+        if(::setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)) < 0)
+        {
+            close();
+            throw_error("Socket setsockopt error:");
+        }
+    }
+
+    auto open() -> void override
+    {
+        sockaddr_in addrIn{};
+        try
+        {
+            addrIn = to_address(_socketType == SocketType::MULTICAST ? "0.0.0.0" : _address, _port);
+        }
+        catch(const CommunicationException&)
+        {
+            close();
+            throw;
+        }
+
+        if(::bind(_fd, reinterpret_cast<sockaddr*>(&addrIn), sizeof(addrIn)) < 0)
+        {
+            close();
+            throw_error("Datagram bind error:");
+        }
+
+        socklen_t addrLen = sizeof(addrIn);
+        ::getsockname(_fd, reinterpret_cast<sockaddr*>(&addrIn), &addrLen);
+        _port = ntohs(addrIn.sin_port);
+
+        if(_socketType == SocketType::MULTICAST)
+        {
+            ip_mreq request{};
+            if(inet_pton(AF_INET, _address.c_str(), &request.imr_multiaddr) <= 0)
+            {
+                close();
+                throw CommunicationException("Invalid multicast group:" + _address);
+            }
+            request.imr_interface = _interface;
+            if(::setsockopt(_fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &request, sizeof(request)) < 0)
+            {
+                close();
+                throw_error("Multicast join error:");
+            }
+        }
+    }
+
+    auto close() -> void override
+    {
+        if(_fd >= 0) { ::close(_fd); }
+        _fd = -1;
+    }
+
+    auto get_port() const -> int32_t override { return _port; }
+    auto get_native_handle() const -> int32_t override { return _fd; }
+
+    auto set_destination(const std::string& address, const int32_t port) -> void override
+    {
+        _destination = to_address(address, port);
+    }
+
+    auto set_receive_buffer(const size_t size) -> bool override
+    {
+        const int32_t value = static_cast<int32_t>(size);
+        // SO_RCVBUFFORCE ignores rmem_max but needs CAP_NET_ADMIN
+        if(::setsockopt(_fd, SOL_SOCKET, SO_RCVBUFFORCE, &value, sizeof(value)) == 0) { return true; }
+        return ::setsockopt(_fd, SOL_SOCKET, SO_RCVBUF, &value, sizeof(value)) == 0;
+    }
+
+    auto set_timestamp(const bool enable) -> bool override
+    {
+        int32_t opt = enable ? 1 : 0;
+        return ::setsockopt(_fd, SOL_SOCKET, SO_TIMESTAMPNS, &opt, sizeof(opt)) == 0;
+    }
+
+    auto set_gro(const bool enable) -> bool override
+    {
+        int32_t opt = enable ? 1 : 0;
+        return ::setsockopt(_fd, IPPROTO_UDP, UDP_GRO, &opt, sizeof(opt)) == 0;
+    }
+
+    auto set_multicast_interface(const std::string& address) -> bool override
+    {
+        if(inet_pton(AF_INET, address.c_str(), &_interface) <= 0) { return false; }
+        return ::setsockopt(_fd, IPPROTO_IP, IP_MULTICAST_IF, &_interface, sizeof(_interface)) == 0;
+    }
+
+    auto set_multicast_loop(const bool enable) -> bool override
+    {
+        uint8_t opt = enable ? 1 : 0;
+        return ::setsockopt(_fd, IPPROTO_IP, IP_MULTICAST_LOOP, &opt, sizeof(opt)) == 0;
+    }
+
+    auto set_multicast_ttl(const uint8_t ttl) -> bool override
+    {
+        return ::setsockopt(_fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) == 0;
+    }
+
+    auto recv_batch(DatagramBatch& batch, const uint32_t millisecond) -> size_t override
+    {
+        batch._size = 0;
+        if(millisecond > 0)
+        {
+            pollfd pfd{_fd, POLLIN, 0};
+            if(::poll(&pfd, 1, static_cast<int32_t>(millisecond)) <= 0) { return 0; }
+        }
+
+        const size_t capacity = std::min(batch._capacity, MAX_BATCH);
+        for(size_t i = 0; i < capacity; ++i)
+        {
+            msghdr& header = batch._headers[i].msg_hdr;
+            header.msg_name = &batch._addresses[i];
+            header.msg_namelen = sizeof(sockaddr_in);
+            header.msg_iov = &batch._iov[i];
+            header.msg_iovlen = 1;
+            header.msg_control = batch._controls.data() + i * CONTROL_SIZE;
+            header.msg_controllen = CONTROL_SIZE;
+            header.msg_flags = 0;
+        }
+
+        int32_t received = 0;
+        do
+        {
+            received = ::recvmmsg(_fd, batch._headers.data(), capacity, MSG_DONTWAIT, nullptr);
+        } while(received < 0 && errno == EINTR);
+
+        if(received < 0)
+        {
+            if(errno == EAGAIN || errno == EWOULDBLOCK) { return 0; }
+            throw_error("Datagram recvmmsg error:");
+        }
+
+        for(int32_t i = 0; i < received; ++i)
+        {
+            batch._timestamps[i] = 0;
+            batch._segmentSizes[i] = 0;
+
+            msghdr& header = batch._headers[i].msg_hdr;
+            for(cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg != nullptr; cmsg = CMSG_NXTHDR(&header, cmsg))
+            {
+                if(cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS)
+                {
+                    timespec ts;
+                    std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                    batch._timestamps[i] = static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+                }
+                else if(cmsg->cmsg_level == IPPROTO_UDP && cmsg->cmsg_type == UDP_GRO)
+                {
+                    int32_t segmentSize = 0;
+                    std::memcpy(&segmentSize, CMSG_DATA(cmsg), sizeof(segmentSize));
+                    batch._segmentSizes[i] = static_cast<uint16_t>(segmentSize);
+                }
+            }
+        }
+        batch._size = received;
+        return received;
+    }
+
+    auto send(const void* buffer, const size_t size) -> void override
+    {
+        while(::sendto(_fd, buffer, size, 0, reinterpret_cast<const sockaddr*>(&_destination), sizeof(_destination)) < 0)
+        {
+            if(errno != EINTR) { throw_error("Datagram send error:"); }
+        }
+    }
+
+    auto send_batch(const iovec* datagrams, const size_t count) -> size_t override
+    {
+        std::vector<mmsghdr> headers(std::min(count, MAX_BATCH));
+        size_t sent = 0;
+        while(sent < count)
+        {
+            const size_t chunk = std::min(count - sent, MAX_BATCH);
+            for(size_t i = 0; i < chunk; ++i)
+            {
+                headers[i] = mmsghdr{};
+                headers[i].msg_hdr.msg_name = &_destination;
+                headers[i].msg_hdr.msg_namelen = sizeof(_destination);
+                headers[i].msg_hdr.msg_iov = const_cast<iovec*>(&datagrams[sent + i]);
+                headers[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            const int32_t rtn = ::sendmmsg(_fd, headers.data(), chunk, 0);
+            if(rtn < 0)
+            {
+                if(errno == EINTR) { continue; }
+                throw_error("Datagram sendmmsg error:");
+            }
+            sent += rtn;
+        }
+        return sent;
+    }
+
+    auto send_segmented(const void* buffer, const size_t size, const uint16_t segmentSize) -> void override
+    {
+        if(segmentSize == 0) { throw CommunicationException("Datagram segment size must be positive"); }
+
+        const auto* data = static_cast<const uint8_t*>(buffer);
+        size_t offset = 0;
+
+        // one GSO send carries at most GSO_MAX_SEGMENTS segments and one IP datagram worth of payload
+        const size_t chunkSize = segmentSize * std::min<size_t>(GSO_MAX_SEGMENTS, GSO_MAX_PAYLOAD / segmentSize);
+        while(_gso && chunkSize > 0 && size - offset > segmentSize)
+        {
+            const size_t length = std::min(chunkSize, size - offset);
+            if(!send_gso(data + offset, length, segmentSize)) { break; }
+            offset += length;
+        }
+        if(offset == size) { return; }
+
+        std::vector<iovec> datagrams;
+        datagrams.reserve((size - offset) / segmentSize + 1);
+        for(; offset < size; offset += segmentSize)
+        {
+            datagrams.push_back(iovec{const_cast<uint8_t*>(data + offset), std::min<size_t>(segmentSize, size - offset)});
+        }
+        send_batch(datagrams.data(), datagrams.size());
+    }
+
+private :
+    /**
+     * @return bool false if the rest must be sent without GSO
+     */
+    auto send_gso(const uint8_t* data, const size_t size, const uint16_t segmentSize) -> bool
+    {
+        std::array<uint8_t, CMSG_SPACE(sizeof(uint16_t))> control{};
+        iovec iov{const_cast<uint8_t*>(data), size};
+        msghdr msg{};
+        msg.msg_name = &_destination;
+        msg.msg_namelen = sizeof(_destination);
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control.data();
+        msg.msg_controllen = control.size();
+
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = IPPROTO_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        std::memcpy(CMSG_DATA(cmsg), &segmentSize, sizeof(segmentSize));
+
+        ssize_t rtn = 0;
+        while((rtn = ::sendmsg(_fd, &msg, 0)) < 0 && errno == EINTR) {}
+        if(rtn >= 0) { return true; }
+        if(errno == EMSGSIZE) { return false; } // limits of this path, sendmmsg still works
+        if(errno != EIO && errno != EINVAL && errno != ENOPROTOOPT) { throw_error("Datagram GSO send error:"); }
+        _gso = false; // not supported by the kernel or the device
+        return false;
+    }
+};
+} // namespace detail
+
+auto DatagramSocket::__create(SocketType::type socketType) noexcept -> std::shared_ptr<DatagramSocket>
+{
+    if(socketType != SocketType::UDP && socketType != SocketType::MULTICAST) { return nullptr; }
+    return std::make_shared<detail::DatagramSocketDetail>(socketType);
+}
+} // namespace common
+
+#endif
@@ -34,8 +34,8 @@ auto generate_subId() -> uint32_t
     return nextSubId.fetch_add(1);
 }
 
-EventBus::EventBus(uint32_t threadCount /* = EVENT_THREADS */)
-    : _executor(TaskExecutor::create(threadCount)) {}
+EventBus::EventBus(uint32_t threadCount /* = EVENT_THREADS */, std::pmr::memory_resource* resource /* = PoolResource::get() */)
+    : _resource(resource), _executor(TaskExecutor::create(threadCount, resource)) {}
 
 EventBus::~EventBus() { finalize(); }
 
@@ -44,28 +44,20 @@ auto EventBus::finalize() -> void { _executor->stop(); }
 auto EventBus::subscribe(const std::string& topic, Handler handler) -> SubID
 {
     const SubID subId = generate_subId();
-    auto subscriber = std::make_shared<HandlerInfo>(subId, handler);
+    const std::pmr::polymorphic_allocator<HandlerInfo> allocator(_resource);
+    auto subscriber = std::allocate_shared<HandlerInfo>(allocator, subId, std::move(handler));
 
-    {
-        std::lock_guard<std::mutex> lock(_subscriptionLock);
-        _subscriptions[subId] = subscriber;
-    }
+    _subscriptions.insert_or_assign(subId, std::weak_ptr<HandlerInfo>(subscriber));
 
-    // Copy-on-Write pattern
-    {
-        std::unique_lock<std::shared_mutex> lock(_topicLock);
-        
-        auto& topicData = _topics[topic];
-        if(!topicData)
-        {
-            topicData = std::make_shared<TopicData>();
-        }
-
-        auto newData = std::make_shared<TopicData>(*topicData);
+    // Copy-on-Write pattern, only the shard of the topic is locked
+    _topics.upsert(topic, [&](std::shared_ptr<TopicData>& topicData) {
+        // the vector takes the allocator by uses-allocator construction
+        auto newData = topicData ? std::allocate_shared<TopicData>(allocator, *topicData)
+                                 : std::allocate_shared<TopicData>(allocator);
         newData->push_back(subscriber);
 
-        _topics[topic] = newData; // atomical swap
-    }
+        topicData = std::move(newData); // publishers keep their snapshot
+    });
 
     return subId;
 }
@@ -73,15 +65,9 @@ auto EventBus::subscribe(const std::string& topic, Handler handler) -> SubID
 auto EventBus::unsubscribe(SubID subId) -> void
 {
     std::shared_ptr<HandlerInfo> handlerInfo;
-
+    if(auto subscription = _subscriptions.extract(subId))
     {
-        std::lock_guard<std::mutex> lock(_subscriptionLock);
-        auto itor = _subscriptions.find(subId);
-        if(itor != _subscriptions.end())
-        {
-            handlerInfo = itor->second.lock();
-            _subscriptions.erase(itor);
-        }
+        handlerInfo = subscription->lock();
     }
 
     if(!handlerInfo) { return; }
@@ -96,42 +82,37 @@ auto EventBus::unsubscribe(SubID subId) -> void
 
 auto EventBus::cleanup_unsubscribers() -> void
 {
-    _executor->load<void>([this]() {
-        std::unique_lock<std::shared_mutex> lock(_topicLock);
-
-        for(auto & [topic, topicData] : _topics) 
-        {
-            auto newTopicData = std::make_shared<TopicData>();
+    _executor->post([this]() {
+        _topics.for_each([this](const Topic&, std::shared_ptr<TopicData>& topicData) {
+            auto newTopicData = std::allocate_shared<TopicData>(std::pmr::polymorphic_allocator<TopicData>(_resource));
             std::copy_if(topicData->begin(), topicData->end(), 
                          std::back_inserter(*newTopicData),
                          [](const auto& handlerInfo) {
                             return handlerInfo->_active.load();
             });
-            _topics[topic] = newTopicData;
-        }
+            topicData = std::move(newTopicData);
+        });
     });
 }
 
 auto EventBus::publish(const std::string& topic, const Payload& payload) -> void
 {
     std::shared_ptr<TopicData> topicDataSnapshot;
-    {
-        std::shared_lock<std::shared_mutex> lock(_topicLock);
-        auto itor = _topics.find(topic);
-        if(itor != _topics.end())
-        {
-            topicDataSnapshot = itor->second;
-        }
-    }
+    _topics.visit(topic, [&topicDataSnapshot](const std::shared_ptr<TopicData>& topicData) {
+        topicDataSnapshot = topicData;
+    });
 
     if(!topicDataSnapshot) { return; }
 
+    // one copy of the payload shared by every handler
+    std::shared_ptr<const Payload> shared;
     for(const auto& handler : (*topicDataSnapshot))
     {
         if(!handler->_active.load()) { continue; }
-        _executor->load<void>([payload, handler](){
+        if(!shared) { shared = std::allocate_shared<Payload>(std::pmr::polymorphic_allocator<Payload>(_resource), payload); }
+        _executor->post([shared, handler](){
             if(!handler->_active.load()) { return; }
-            handler->_handler(payload);
+            handler->_handler(*shared);
         });
     }
 }
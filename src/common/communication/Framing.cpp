@@ -0,0 +1,323 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include "common/communication/Framing.hpp"
+#include "common/Exception.hpp"
+#include "common/logging/Logger.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+namespace common
+{
+auto LengthPrefixCodec::__create(uint8_t headerSize /* = 4 */) noexcept -> std::shared_ptr<LengthPrefixCodec>
+{
+    if(headerSize != 1 && headerSize != 2 && headerSize != 4 && headerSize != 8)
+    {
+        _ERROR_("Invalid length prefix size : %d", headerSize);
+        return nullptr;
+    }
+    return std::make_shared<LengthPrefixCodec>(headerSize);
+}
+
+auto LengthPrefixCodec::decode(const uint8_t* data,
+                               const size_t size,
+                               const size_t maxFrameSize,
+                               Frame& frame) const -> size_t
+{
+    if(size < _headerSize) { return 0; }
+
+    uint64_t length = 0;
+    for(uint8_t i = 0; i < _headerSize; ++i) { length = (length << 8) | data[i]; }
+    if(length > maxFrameSize - _headerSize)
+    {
+        throw CommunicationException("Frame too large : " + std::to_string(length));
+    }
+
+    if(size - _headerSize < length) { return 0; }
+    frame = Frame(data + _headerSize, length);
+    return _headerSize + length;
+}
+
+auto LengthPrefixCodec::encode_header(const size_t size, uint8_t* header) const noexcept -> size_t
+{
+    for(uint8_t i = 0; i < _headerSize; ++i)
+    {
+        header[i] = static_cast<uint8_t>(static_cast<uint64_t>(size) >> (8 * (_headerSize - 1 - i)));
+    }
+    return _headerSize;
+}
+
+auto DelimiterCodec::__create(std::string delimiter /* = "\n" */) noexcept -> std::shared_ptr<DelimiterCodec>
+{
+    if(delimiter.empty())
+    {
+        _ERROR_("Delimiter is empty");
+        return nullptr;
+    }
+    return std::make_shared<DelimiterCodec>(delimiter);
+}
+
+auto DelimiterCodec::decode(const uint8_t* data,
+                            const size_t size,
+                            const size_t maxFrameSize,
+                            Frame& frame) const -> size_t
+{
+    const size_t delimiterSize = _delimiter.size();
+    const uint8_t first = static_cast<uint8_t>(_delimiter[0]);
+
+    const uint8_t* cursor = data;
+    const uint8_t* end = data + size;
+    while(cursor < end)
+    {
+        const auto* found = static_cast<const uint8_t*>(std::memchr(cursor, first, end - cursor));
+        if(found == nullptr || static_cast<size_t>(end - found) < delimiterSize) { break; }
+
+        if(std::memcmp(found, _delimiter.data(), delimiterSize) == 0)
+        {
+            frame = Frame(data, found - data);
+            return (found - data) + delimiterSize;
+        }
+        cursor = found + 1;
+    }
+
+    if(size >= maxFrameSize)
+    {
+        throw CommunicationException("Delimiter not found in " + std::to_string(size) + " bytes");
+    }
+    return 0;
+}
+
+namespace detail
+{
+class BufferPoolDetail final : public BufferPool
+                             , public std::enable_shared_from_this<BufferPoolDetail>
+{
+private :
+    const size_t _blockSize;
+    const size_t _capacity;
+
+    mutable std::mutex _mutex;
+    std::vector<uint8_t*> _blocks;
+
+public :
+    BufferPoolDetail(const size_t blockSize, const size_t capacity) noexcept
+        : _blockSize(blockSize), _capacity(capacity) {}
+
+    ~BufferPoolDetail() final
+    {
+        for(auto* block : _blocks) { delete[] block; }
+    }
+
+public :
+    auto acquire() -> std::shared_ptr<uint8_t> override
+    {
+        uint8_t* block = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(!_blocks.empty())
+            {
+                block = _blocks.back();
+                _blocks.pop_back();
+            }
+        }
+        if(block == nullptr) { block = new uint8_t[_blockSize]; }
+
+        std::weak_ptr<BufferPoolDetail> weak = weak_from_this();
+        return std::shared_ptr<uint8_t>(block, [weak](uint8_t* block){
+            auto pool = weak.lock();
+            if(pool == nullptr || !pool->release(block)) { delete[] block; }
+        });
+    }
+
+    auto get_block_size() const noexcept -> size_t override { return _blockSize; }
+
+    auto get_available() const noexcept -> size_t override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _blocks.size();
+    }
+
+private :
+    auto release(uint8_t* block) noexcept -> bool
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(_blocks.size() >= _capacity) { return false; }
+        _blocks.push_back(block);
+        return true;
+    }
+};
+
+class FramedStreamDetail final : public FramedStream
+{
+private :
+    // Payloads from this size are sent from the caller's memory instead of being copied.
+    static constexpr size_t COPY_THRESHOLD = 4 * 1024;
+
+    std::shared_ptr<Socket> _socket;
+    std::shared_ptr<FrameCodec> _codec;
+    const size_t _blockSize;
+
+    std::shared_ptr<uint8_t> _rxBlock;
+    size_t _rxHead = 0;
+    size_t _rxTail = 0;
+
+    std::shared_ptr<uint8_t> _txBlock;
+    size_t _txSize = 0;
+
+public :
+    FramedStreamDetail(std::shared_ptr<Socket> socket,
+                       std::shared_ptr<FrameCodec> codec,
+                       const std::shared_ptr<BufferPool>& pool)
+        : _socket(std::move(socket)),
+          _codec(std::move(codec)),
+          _blockSize(pool->get_block_size()),
+          _rxBlock(pool->acquire()),
+          _txBlock(pool->acquire())
+    {
+        _socket->set_nodelay(true);
+    }
+
+    ~FramedStreamDetail() final
+    {
+        try { flush(); }
+        catch(const CommunicationException& e) { _ERROR_("Failed to flush : %s", e.what()); }
+    }
+
+public :
+    auto read(const Handler& handler) -> size_t override
+    {
+        uint8_t* buffer = _rxBlock.get();
+        size_t count = 0;
+        while(true)
+        {
+            Frame frame;
+            size_t consumed = 0;
+            while((consumed = _codec->decode(buffer + _rxHead, _rxTail - _rxHead, _blockSize, frame)) > 0)
+            {
+                _rxHead += consumed;
+                handler(frame);
+                ++count;
+            }
+
+            if(_rxHead == _rxTail) { _rxHead = _rxTail = 0; }
+            if(count > 0) { return count; }
+
+            if(_rxTail == _blockSize)
+            {
+                // Move the partial frame to the front to make room for the rest of it.
+                std::memmove(buffer, buffer + _rxHead, _rxTail - _rxHead);
+                _rxTail -= _rxHead;
+                _rxHead = 0;
+            }
+            // Socket::read passes on -1 of ::read as size_t
+            const auto readSize = static_cast<ssize_t>(_socket->read(buffer + _rxTail, _blockSize - _rxTail));
+            if(readSize < 0)
+            {
+                const int32_t errNo = errno;
+                if(errNo == EINTR) { continue; }
+                if(errNo == EAGAIN || errNo == EWOULDBLOCK) { return 0; }
+                throw CommunicationException(std::string("FramedStream read error:") + strerror(errNo));
+            }
+            if(readSize == 0) { throw CommunicationException("FramedStream closed by peer"); }
+            _rxTail += static_cast<size_t>(readSize);
+        }
+    }
+
+    auto write(const void* data, const size_t size) -> void override
+    {
+        std::array<uint8_t, FrameCodec::MAX_HEADER_SIZE> header;
+        const size_t headerSize = _codec->encode_header(size, header.data());
+        const Frame trailer = _codec->get_trailer();
+        const size_t frameSize = headerSize + size + trailer.size();
+
+        if(size >= COPY_THRESHOLD || frameSize > _blockSize)
+        {
+            std::array<iovec, 4> iov{iovec{_txBlock.get(), _txSize},
+                                     iovec{header.data(), headerSize},
+                                     iovec{const_cast<void*>(data), size},
+                                     iovec{const_cast<uint8_t*>(trailer.data()), trailer.size()}};
+            _socket->sendv(iov.data(), iov.size());
+            _txSize = 0;
+            return;
+        }
+
+        if(_txSize + frameSize > _blockSize) { flush(); }
+
+        uint8_t* cursor = _txBlock.get() + _txSize;
+        std::memcpy(cursor, header.data(), headerSize);
+        std::memcpy(cursor + headerSize, data, size);
+        std::memcpy(cursor + headerSize + size, trailer.data(), trailer.size());
+        _txSize += frameSize;
+    }
+
+    auto flush() -> void override
+    {
+        if(_txSize == 0) { return; }
+
+        iovec iov{_txBlock.get(), _txSize};
+        _socket->sendv(&iov, 1);
+        _txSize = 0;
+    }
+
+    auto get_buffered() const noexcept -> size_t override { return _txSize; }
+};
+} // namespace detail
+
+auto BufferPool::__create(size_t blockSize /* = 64 * 1024 */,
+                          size_t capacity /* = 16 */) noexcept -> std::shared_ptr<BufferPool>
+{
+    if(blockSize == 0) { return nullptr; }
+    return std::make_shared<detail::BufferPoolDetail>(blockSize, capacity);
+}
+
+auto FramedStream::__create(std::shared_ptr<Socket> socket,
+                            std::shared_ptr<FrameCodec> codec,
+                            std::shared_ptr<BufferPool> pool /* = nullptr */) noexcept -> std::shared_ptr<FramedStream>
+{
+    if(socket == nullptr || codec == nullptr) { return nullptr; }
+    if(pool == nullptr) { pool = BufferPool::create(); }
+    if(pool == nullptr || pool->get_block_size() <= FrameCodec::MAX_HEADER_SIZE) { return nullptr; }
+
+    try
+    {
+        return std::make_shared<detail::FramedStreamDetail>(std::move(socket), std::move(codec), pool);
+    }
+    catch(const std::bad_alloc&)
+    {
+        _ERROR_("Failed to allocate frame buffers");
+        return nullptr;
+    }
+}
+} // namespace common
+
+#endif
@@ -0,0 +1,615 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include "common/communication/Reactor.hpp"
+#include "common/thread/Thread.hpp"
+#include "common/Exception.hpp"
+#include "common/logging/Logger.hpp"
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+namespace common
+{
+namespace detail
+{
+static constexpr int32_t MAX_REACTOR_EVENTS = 256;
+
+inline auto to_epoll_events(const uint32_t events) noexcept -> uint32_t
+{
+    uint32_t epollEvents = EPOLLET | EPOLLONESHOT | EPOLLRDHUP;
+    if((events & ReactorEvent::READ) == ReactorEvent::READ) { epollEvents |= EPOLLIN; }
+    if((events & ReactorEvent::WRITE) == ReactorEvent::WRITE) { epollEvents |= EPOLLOUT; }
+    return epollEvents;
+}
+
+inline auto to_reactor_events(const uint32_t epollEvents) noexcept -> uint32_t
+{
+    uint32_t events = 0;
+    if(epollEvents & EPOLLIN) { events |= ReactorEvent::READ; }
+    if(epollEvents & EPOLLOUT) { events |= ReactorEvent::WRITE; }
+    if(epollEvents & (EPOLLHUP | EPOLLRDHUP)) { events |= ReactorEvent::HANGUP; }
+    if(epollEvents & EPOLLERR) { events |= ReactorEvent::ERROR; }
+    return events;
+}
+
+class ReactorDetail final : public Reactor
+                          , public std::enable_shared_from_this<ReactorDetail>
+{
+private :
+    struct Registration
+    {
+        const int32_t _fd;
+        const Handler _handler;
+        std::mutex _lock;
+        uint32_t _events;
+        bool _dispatched = false;
+        bool _active = true;
+
+        Registration(const int32_t fd, const uint32_t events, Handler handler)
+            : _fd(fd), _handler(std::move(handler)), _events(events) {}
+    };
+
+    int32_t _epoll = -1;
+    int32_t _wakeup = -1;
+    std::shared_ptr<TaskExecutor> _executor;
+    std::shared_ptr<Thread> _thread;
+    std::atomic<bool> _running{false};
+
+    std::shared_mutex _lock;
+    std::unordered_map<int32_t, std::shared_ptr<Registration>> _registrations;
+
+public :
+    explicit ReactorDetail(std::shared_ptr<TaskExecutor> executor)
+        : _executor(std::move(executor))
+    {
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        _wakeup = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if(_epoll < 0 || _wakeup < 0)
+        {
+            _ERROR_("Reactor error: %s", strerror(errno));
+            release();
+            return;
+        }
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = _wakeup;
+        epoll_ctl(_epoll, EPOLL_CTL_ADD, _wakeup, &event);
+    }
+
+    ~ReactorDetail() final
+    {
+        stop();
+        if(_thread) { _thread->join(); }
+        release();
+    }
+
+public :
+    auto is_valid() const noexcept -> bool { return _epoll >= 0 && _wakeup >= 0; }
+
+    auto run() -> std::future<void> override
+    {
+        if(_running.exchange(true)) { throw AlreadyRunningException(); }
+
+        _thread = Thread::create();
+        _thread->set_name("Reactor");
+        return _thread->start([this](){ loop(); });
+    }
+
+    auto stop() noexcept -> void override
+    {
+        _running.store(false);
+        if(_wakeup >= 0)
+        {
+            const uint64_t value = 1;
+            [[maybe_unused]] const auto rtn = ::write(_wakeup, &value, sizeof(value));
+        }
+    }
+
+    auto add(const int32_t fd, const uint32_t events, Handler handler) noexcept -> bool override
+    {
+        auto registration = std::make_shared<Registration>(fd, events, std::move(handler));
+
+        std::unique_lock<std::shared_mutex> lock(_lock);
+        if(_registrations.find(fd) != _registrations.end()) { return false; }
+
+        epoll_event event{};
+        event.events = to_epoll_events(events);
+        event.data.fd = fd;
+        if(epoll_ctl(_epoll, EPOLL_CTL_ADD, fd, &event) < 0)
+        {
+            _ERROR_("Reactor add error(%d): %s", fd, strerror(errno));
+            return false;
+        }
+
+        _registrations.emplace(fd, std::move(registration));
+        return true;
+    }
+
+    auto modify(const int32_t fd, const uint32_t events) noexcept -> bool override
+    {
+        auto registration = find(fd);
+        if(!registration) { return false; }
+
+        std::lock_guard<std::mutex> lock(registration->_lock);
+        registration->_events = events;
+        if(registration->_dispatched) { return true; } // re-armed with new events after the handler
+        return arm(*registration);
+    }
+
+    auto remove(const int32_t fd) noexcept -> void override
+    {
+        std::shared_ptr<Registration> registration;
+        {
+            std::unique_lock<std::shared_mutex> lock(_lock);
+            auto itor = _registrations.find(fd);
+            if(itor == _registrations.end()) { return; }
+            registration = std::move(itor->second);
+            _registrations.erase(itor);
+        }
+
+        std::lock_guard<std::mutex> lock(registration->_lock);
+        registration->_active = false;
+        epoll_ctl(_epoll, EPOLL_CTL_DEL, fd, nullptr);
+    }
+
+private :
+    auto loop() -> void
+    {
+        std::array<epoll_event, MAX_REACTOR_EVENTS> events;
+        while(_running.load())
+        {
+            const int32_t count = epoll_wait(_epoll, events.data(), MAX_REACTOR_EVENTS, -1);
+            if(count < 0)
+            {
+                if(errno == EINTR) { continue; }
+                _ERROR_("Reactor epoll_wait error: %s", strerror(errno));
+                break;
+            }
+
+            for(int32_t i = 0; i < count; ++i)
+            {
+                if(events[i].data.fd == _wakeup)
+                {
+                    uint64_t value = 0;
+                    [[maybe_unused]] const auto rtn = ::read(_wakeup, &value, sizeof(value));
+                    continue;
+                }
+                dispatch(events[i].data.fd, to_reactor_events(events[i].events));
+            }
+        }
+    }
+
+    auto dispatch(const int32_t fd, const uint32_t events) -> void
+    {
+        auto registration = find(fd);
+        if(!registration) { return; }
+
+        {
+            std::lock_guard<std::mutex> lock(registration->_lock);
+            if(!registration->_active) { return; }
+            registration->_dispatched = true;
+        }
+
+        if(!_executor)
+        {
+            handle(registration, events);
+            rearm(registration);
+            return;
+        }
+
+        std::weak_ptr<ReactorDetail> weak = weak_from_this();
+        _executor->load<void>([weak, registration, events](){
+            ReactorDetail::handle(registration, events);
+            if(auto self = weak.lock()) { self->rearm(registration); }
+        });
+    }
+
+    static auto handle(const std::shared_ptr<Registration>& registration, const uint32_t events) noexcept -> void
+    {
+        try
+        {
+            registration->_handler(events);
+        }
+        catch(const std::exception& e)
+        {
+            _ERROR_("Reactor handler error(%d): %s", registration->_fd, e.what());
+        }
+    }
+
+    auto rearm(const std::shared_ptr<Registration>& registration) noexcept -> void
+    {
+        std::lock_guard<std::mutex> lock(registration->_lock);
+        registration->_dispatched = false;
+        if(registration->_active) { arm(*registration); }
+    }
+
+    auto arm(const Registration& registration) noexcept -> bool
+    {
+        epoll_event event{};
+        event.events = to_epoll_events(registration._events);
+        event.data.fd = registration._fd;
+        return epoll_ctl(_epoll, EPOLL_CTL_MOD, registration._fd, &event) == 0;
+    }
+
+    auto find(const int32_t fd) -> std::shared_ptr<Registration>
+    {
+        std::shared_lock<std::shared_mutex> lock(_lock);
+        auto itor = _registrations.find(fd);
+        return itor != _registrations.end() ? itor->second : nullptr;
+    }
+
+    auto release() noexcept -> void
+    {
+        if(_wakeup >= 0) { ::close(_wakeup); _wakeup = -1; }
+        if(_epoll >= 0) { ::close(_epoll); _epoll = -1; }
+    }
+};
+
+class ConnectionDetail final : public Connection
+{
+public :
+    using CloseHandler = std::function<void(ConnectionDetail&)>;
+
+private :
+    const int32_t _fd;
+    std::atomic<bool> _open{true};
+    std::atomic<bool> _closed{false};
+    std::weak_ptr<Reactor> _reactor;
+    CloseHandler _onClose;
+
+    std::mutex _sendLock;
+    std::vector<uint8_t> _pending;
+
+public :
+    /**
+     * @param onClose Called once after the fd is closed, whoever closed it
+     */
+    ConnectionDetail(const int32_t fd, std::weak_ptr<Reactor> reactor, CloseHandler onClose = nullptr)
+        : _fd(fd), _reactor(std::move(reactor)), _onClose(std::move(onClose)) {}
+
+    ~ConnectionDetail() final { close(); }
+
+public :
+    auto get_fd() const noexcept -> int32_t override { return _fd; }
+    auto is_open() const noexcept -> bool override { return _open.load(); }
+
+    auto read(void* buffer, const size_t size) noexcept -> size_t override
+    {
+        while(_open.load())
+        {
+            const ssize_t readSize = ::read(_fd, buffer, size);
+            if(readSize > 0) { return static_cast<size_t>(readSize); }
+            if(readSize < 0 && errno == EINTR) { continue; }
+            if(readSize < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) { return 0; }
+
+            _open.store(false); // closed by peer or broken
+            break;
+        }
+        return 0;
+    }
+
+    auto send(const void* buffer, const size_t size) noexcept -> bool override
+    {
+        std::lock_guard<std::mutex> lock(_sendLock);
+        if(!_open.load()) { return false; }
+
+        const auto* data = static_cast<const uint8_t*>(buffer);
+        if(!_pending.empty())
+        {
+            _pending.insert(_pending.end(), data, data + size);
+            return true;
+        }
+
+        const size_t sentSize = write_some(data, size);
+        if(!_open.load()) { return false; }
+        if(sentSize < size)
+        {
+            _pending.assign(data + sentSize, data + size);
+            if(auto reactor = _reactor.lock())
+            {
+                reactor->modify(_fd, ReactorEvent::READ | ReactorEvent::WRITE);
+            }
+        }
+        return true;
+    }
+
+    auto close() noexcept -> void override
+    {
+        if(_closed.exchange(true)) { return; }
+
+        {
+            // a send() or flush() in progress finishes before the fd number can be reused
+            std::lock_guard<std::mutex> lock(_sendLock);
+            _open.store(false);
+            _pending.clear();
+            if(auto reactor = _reactor.lock()) { reactor->remove(_fd); }
+            ::close(_fd);
+        }
+
+        if(_onClose)
+        {
+            try { _onClose(*this); }
+            catch(const std::exception& e) { _ERROR_("Connection close handler error(%d): %s", _fd, e.what()); }
+        }
+    }
+
+    /**
+     * @brief Writes pending data. Called when the socket becomes writable.
+     */
+    auto flush() noexcept -> void
+    {
+        std::lock_guard<std::mutex> lock(_sendLock);
+        if(_pending.empty() || !_open.load()) { return; }
+
+        const size_t sentSize = write_some(_pending.data(), _pending.size());
+        _pending.erase(_pending.begin(), _pending.begin() + sentSize);
+        if(_pending.empty())
+        {
+            if(auto reactor = _reactor.lock()) { reactor->modify(_fd, ReactorEvent::READ); }
+        }
+    }
+
+private :
+    auto write_some(const uint8_t* data, const size_t size) noexcept -> size_t
+    {
+        size_t sentSize = 0;
+        while(sentSize < size)
+        {
+            const ssize_t rtn = ::send(_fd, data + sentSize, size - sentSize, MSG_NOSIGNAL);
+            if(rtn > 0) { sentSize += static_cast<size_t>(rtn); continue; }
+            if(rtn < 0 && errno == EINTR) { continue; }
+            if(rtn < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) { break; }
+
+            _open.store(false);
+            break;
+        }
+        return sentSize;
+    }
+};
+
+class StreamServerDetail final : public StreamServer
+                               , public std::enable_shared_from_this<StreamServerDetail>
+{
+private :
+    std::shared_ptr<Reactor> _reactor;
+    int32_t _fd = -1;
+    int32_t _port = -1;
+    std::string _address;
+
+    ConnectionHandler _onConnect;
+    ConnectionHandler _onReadable;
+    ConnectionHandler _onDisconnect;
+
+    mutable std::mutex _connectionLock;
+    std::unordered_map<int32_t, std::shared_ptr<ConnectionDetail>> _connections; // by fd, only while open
+
+public :
+    explicit StreamServerDetail(std::shared_ptr<Reactor> reactor)
+        : _reactor(std::move(reactor)) {}
+
+    ~StreamServerDetail() final { close(); }
+
+public :
+    auto on_connect(ConnectionHandler handler) -> void override { _onConnect = std::move(handler); }
+    auto on_readable(ConnectionHandler handler) -> void override { _onReadable = std::move(handler); }
+    auto on_disconnect(ConnectionHandler handler) -> void override { _onDisconnect = std::move(handler); }
+
+    auto prepare(const std::string& address, const int32_t port) -> void override
+    {
+        _address = address;
+        _port = port;
+    }
+
+    auto open() -> void override
+    {
+        _fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if(_fd < 0) { throw_error("StreamServer socket error:"); }
+
+        int32_t opt = 1;
+        ::setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+        sockaddr_in addrIn{};
+        addrIn.sin_family = AF_INET;
+        addrIn.sin_port = htons(static_cast<uint16_t>(_port));
+        if(_address.empty()) { addrIn.sin_addr.s_addr = INADDR_ANY; }
+        else if(inet_pton(AF_INET, _address.c_str(), &addrIn.sin_addr) <= 0)
+        {
+            throw_error("StreamServer inet_pton error:");
+        }
+
+        if(::bind(_fd, reinterpret_cast<sockaddr*>(&addrIn), sizeof(addrIn)) < 0)
+        {
+            throw_error("StreamServer bind error:");
+        }
+
+        if(::listen(_fd, SOMAXCONN) < 0)
+        {
+            throw_error("StreamServer listen error:");
+        }
+
+        socklen_t addrLen = sizeof(addrIn);
+        if(::getsockname(_fd, reinterpret_cast<sockaddr*>(&addrIn), &addrLen) == 0)
+        {
+            _port = ntohs(addrIn.sin_port);
+        }
+
+        std::weak_ptr<StreamServerDetail> weak = weak_from_this();
+        if(!_reactor->add(_fd, ReactorEvent::READ, [weak](const uint32_t){
+            if(auto self = weak.lock()) { self->accept_all(); }
+        }))
+        {
+            throw_error("StreamServer reactor error:");
+        }
+    }
+
+    auto close() noexcept -> void override
+    {
+        if(_fd >= 0)
+        {
+            _reactor->remove(_fd);
+            ::close(_fd);
+            _fd = -1;
+        }
+
+        std::unordered_map<int32_t, std::shared_ptr<ConnectionDetail>> connections;
+        {
+            std::lock_guard<std::mutex> lock(_connectionLock);
+            connections.swap(_connections);
+        }
+        for(auto& [fd, connection] : connections) { connection->close(); }
+    }
+
+    auto get_port() const noexcept -> int32_t override { return _port; }
+
+    auto get_connection_count() const noexcept -> size_t override
+    {
+        std::lock_guard<std::mutex> lock(_connectionLock);
+        return _connections.size();
+    }
+
+private :
+    auto accept_all() -> void
+    {
+        while(true)
+        {
+            const int32_t fd = ::accept4(_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if(fd < 0)
+            {
+                if(errno == EINTR || errno == ECONNABORTED) { continue; }
+                if(errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    _ERROR_("StreamServer accept error: %s", strerror(errno));
+                }
+                break;
+            }
+
+            int32_t opt = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+
+            std::weak_ptr<StreamServerDetail> weak = weak_from_this();
+            auto connection = std::make_shared<ConnectionDetail>(fd, _reactor, [weak](ConnectionDetail& closed){
+                if(auto self = weak.lock()) { self->release(closed); }
+            });
+            {
+                std::lock_guard<std::mutex> lock(_connectionLock);
+                _connections[fd] = connection;
+            }
+            if(_onConnect) { _onConnect(connection); }
+
+            if(!_reactor->add(fd, ReactorEvent::READ, [weak, connection](const uint32_t events){
+                if(auto self = weak.lock()) { self->handle(connection, events); }
+            }))
+            {
+                disconnect(connection);
+            }
+        }
+    }
+
+    auto handle(const std::shared_ptr<ConnectionDetail>& connection, const uint32_t events) -> void
+    {
+        if((events & ReactorEvent::WRITE) == ReactorEvent::WRITE) { connection->flush(); }
+        if((events & ReactorEvent::READ) == ReactorEvent::READ)
+        {
+            if(_onReadable) { _onReadable(connection); }
+            else
+            {
+                std::array<uint8_t, 4096> discard;
+                while(connection->read(discard.data(), discard.size()) > 0) {}
+            }
+        }
+        if((events & (ReactorEvent::HANGUP | ReactorEvent::ERROR)) != 0 || !connection->is_open())
+        {
+            disconnect(connection);
+        }
+    }
+
+    auto disconnect(const std::shared_ptr<ConnectionDetail>& connection) -> void
+    {
+        connection->close(); // ends in release()
+    }
+
+    /**
+     * @brief Forgets a closed connection and reports it, whether the server or the user closed it
+     */
+    auto release(ConnectionDetail& closed) -> void
+    {
+        std::shared_ptr<ConnectionDetail> connection;
+        {
+            // the fd may already belong to a newer connection
+            std::lock_guard<std::mutex> lock(_connectionLock);
+            auto itor = _connections.find(closed.get_fd());
+            if(itor == _connections.end() || itor->second.get() != &closed) { return; }
+            connection = std::move(itor->second);
+            _connections.erase(itor);
+        }
+        if(_onDisconnect) { _onDisconnect(connection); }
+    }
+
+    [[noreturn]] auto throw_error(const char* prefix) -> void
+    {
+        const int32_t errNo = errno;
+        std::string what(prefix);
+        what += strerror(errNo);
+        if(_fd >= 0)
+        {
+            ::close(_fd);
+            _fd = -1;
+        }
+        throw CommunicationException(what);
+    }
+};
+} // namespace detail
+
+auto Reactor::__create(std::shared_ptr<TaskExecutor> executor /* = nullptr */) noexcept -> std::shared_ptr<Reactor>
+{
+    auto reactor = std::make_shared<detail::ReactorDetail>(std::move(executor));
+    return reactor->is_valid() ? reactor : nullptr;
+}
+
+auto StreamServer::__create(std::shared_ptr<Reactor> reactor) noexcept -> std::shared_ptr<StreamServer>
+{
+    return std::make_shared<detail::StreamServerDetail>(std::move(reactor));
+}
+} // namespace common
+
+#endif
@@ -27,6 +27,11 @@ SOFTWARE.
 
 #include <array>
 
+#if defined(LINUX)
+#include <linux/serial.h>
+#include <sys/ioctl.h>
+#endif
+
 namespace common
 {
 auto Serial::__create() noexcept -> std::shared_ptr<Serial>
@@ -36,6 +41,12 @@ auto Serial::__create() noexcept -> std::shared_ptr<Serial>
 
 namespace detail
 {
+#if defined(LINUX)
+// SerialTermios2.cpp
+auto set_termios2_speed(int32_t fd, uint32_t baudrate) -> bool;
+auto get_termios2_speed(int32_t fd) -> uint32_t;
+#endif
+
 #if defined(WINDOWS)
 auto SerialHandler::Wrapper_CreateFile(LPCSTR lpFileName,
                                        DWORD dwDesiredAccess,
@@ -114,11 +125,38 @@ auto SerialHandler::Wrapper_Write(int32_t fd, const char* buffer, size_t size) -
 {
     return ::write(fd, buffer, size) > 0 ? true : false;
 }
+
+auto SerialHandler::Wrapper_SetCustomBaudrate(int32_t fd, uint32_t baudrate) -> bool
+{
+    return set_termios2_speed(fd, baudrate);
+}
+
+auto SerialHandler::Wrapper_GetBaudrate(int32_t fd) -> uint32_t
+{
+    return get_termios2_speed(fd);
+}
+
+auto SerialHandler::Wrapper_SetLowLatency(int32_t fd, bool enable) -> bool
+{
+    struct serial_struct serial;
+    if(::ioctl(fd, TIOCGSERIAL, &serial) < 0) { return false; }
+    if(enable) { serial.flags |= ASYNC_LOW_LATENCY; }
+    else { serial.flags &= ~ASYNC_LOW_LATENCY; }
+    return ::ioctl(fd, TIOCSSERIAL, &serial) == 0;
+}
 #endif
 
 auto DetailSerial::open(const std::string& port,
                         const Baudrate baudrate,
                         const uint8_t mode) noexcept -> bool
+{
+    return open(port, baudrate, mode, SerialOptions());
+}
+
+auto DetailSerial::open(const std::string& port,
+                        const Baudrate baudrate,
+                        const uint8_t mode,
+                        const SerialOptions& options) noexcept -> bool
 {
 #if defined(WINDOWS)
     if(_isOpen)
@@ -152,6 +190,11 @@ auto DetailSerial::open(const std::string& port,
     dcbSerialParams.ByteSize = 8;
     dcbSerialParams.StopBits = ONESTOPBIT;
     dcbSerialParams.Parity = NOPARITY;
+    dcbSerialParams.fOutxCtsFlow = (options._flowControl == FlowControl::HARDWARE);
+    dcbSerialParams.fRtsControl = (options._flowControl == FlowControl::HARDWARE) ? RTS_CONTROL_HANDSHAKE 
+                                                                                  : RTS_CONTROL_ENABLE;
+    dcbSerialParams.fOutX = (options._flowControl == FlowControl::SOFTWARE);
+    dcbSerialParams.fInX = (options._flowControl == FlowControl::SOFTWARE);
 
     if (!_handler->Wrapper_SetCommState(_handle, &dcbSerialParams)) 
     {
@@ -192,17 +235,45 @@ auto DetailSerial::open(const std::string& port,
     _fd = _handler->Wrapper_Open(port.c_str(), modeValue | O_NOCTTY | O_NDELAY);
     if(_fd == -1) { return _isOpen; }
 
-    struct termios options;
-    tcgetattr(_fd, &options);
-    cfsetispeed(&options, baudrate.to_speed());
-    cfsetospeed(&options, baudrate.to_speed());
-    options.c_cflag |= (CLOCAL | CREAD);
-    options.c_cflag &= ~PARENB;
-    options.c_cflag &= ~CSTOPB;
-    options.c_cflag &= ~CSIZE;
-    options.c_cflag |= CS8;
+    struct termios termiosOptions;
+    tcgetattr(_fd, &termiosOptions);
+    if(options._raw) { cfmakeraw(&termiosOptions); }
+    cfsetispeed(&termiosOptions, baudrate.to_speed());
+    cfsetospeed(&termiosOptions, baudrate.to_speed());
+    termiosOptions.c_cflag |= (CLOCAL | CREAD);
+    termiosOptions.c_cflag &= ~PARENB;
+    termiosOptions.c_cflag &= ~CSTOPB;
+    termiosOptions.c_cflag &= ~CSIZE;
+    termiosOptions.c_cflag |= CS8;
+
+    termiosOptions.c_cflag &= ~CRTSCTS;
+    termiosOptions.c_iflag &= ~(IXON | IXOFF | IXANY);
+    if(options._flowControl == FlowControl::HARDWARE) { termiosOptions.c_cflag |= CRTSCTS; }
+    else if(options._flowControl == FlowControl::SOFTWARE) { termiosOptions.c_iflag |= (IXON | IXOFF); }
+
+    if(options._vmin >= 0) { termiosOptions.c_cc[VMIN] = static_cast<cc_t>(options._vmin); }
+    if(options._vtime >= 0) { termiosOptions.c_cc[VTIME] = static_cast<cc_t>(options._vtime); }
 
-    tcsetattr(_fd, TCSANOW, &options);
+    tcsetattr(_fd, TCSANOW, &termiosOptions);
+
+    if(baudrate.is_custom() && !_handler->Wrapper_SetCustomBaudrate(_fd, baudrate.uint32_t()))
+    {
+        _ERROR_("Failed to set custom baudrate %u : %s", baudrate.uint32_t(), port.c_str());
+        _handler->Wrapper_Close(_fd);
+        _fd = -1;
+        return _isOpen;
+    }
+
+    // VMIN / VTIME are ignored by a non-blocking read()
+    if(options._vmin >= 0 || options._vtime >= 0)
+    {
+        ::fcntl(_fd, F_SETFL, ::fcntl(_fd, F_GETFL) & ~O_NONBLOCK);
+    }
+
+    if(options._lowLatency && !_handler->Wrapper_SetLowLatency(_fd, true))
+    {
+        _INFO_("Low latency is not supported : %s", port.c_str());
+    }
 
     _isOpen = true;
     return _isOpen;
@@ -217,6 +288,7 @@ auto DetailSerial::close() noexcept -> void
         _handler->Wrapper_CloseHandle(_handle); 
 #elif defined(LINUX)
         _handler->Wrapper_Close(_fd); 
+        _pending.clear();
 #endif
         _isOpen = false;
     }
@@ -247,7 +319,7 @@ auto DetailSerial::read(char* buffer, size_t size) noexcept -> bool
 auto DetailSerial::readline(EscapeSequence::type escapeSequence) noexcept -> std::string
 {
     static std::array<std::string, EscapeSequence::MAX> EndOfLine{ 
-        std::string("\0"),
+        std::string(1, '\0'),
         std::string("\n"),
         std::string("\r\n"),
     };
@@ -268,7 +340,6 @@ auto DetailSerial::readline(EscapeSequence::type escapeSequence) noexcept -> std
             if(endIdx < end.length() && ch == end[endIdx])
             {
                 ++endIdx;
-                line += ch;
                 if(endIdx == end.length()) { break; }
             }
             else
@@ -286,39 +357,25 @@ auto DetailSerial::readline(EscapeSequence::type escapeSequence) noexcept -> std
         }
     }
 #elif defined(LINUX)
-    char buffer[256];
-    size_t endIdx = 0;
-
+    // Bytes after the terminator stay in _pending for the next call.
+    std::array<char, 256> buffer;
+    size_t searchFrom = 0;
     while (true) 
     {
-        const int32_t readSize = _handler->Wrapper_Read(_fd, buffer, sizeof(buffer) - 1);
-        if (readSize > 0) 
+        const size_t pos = _pending.find(end, searchFrom);
+        if (pos != std::string::npos)
         {
-            for (int32_t i = 0; i < readSize; ++i) 
-            {
-                char ch = buffer[i];
-                if (endIdx < end.length() && ch == end[endIdx]) 
-                {
-                    ++endIdx;
-                    line += ch;
-                    if (endIdx == end.length()) { return line; }
-                } 
-                else 
-                {
-                    if (endIdx > 0) 
-                    {
-                        for (size_t j = 0; j < endIdx; ++j) { line += end[j]; }
-                        endIdx = 0;
-
-                        if (ch == end[0]) { endIdx = 1; } 
-                        else { line += ch; }
-                    } 
-                    else { line += ch; }
-                }
-            }
-        } 
-        else { break; }
+            line.assign(_pending, 0, pos);
+            _pending.erase(0, pos + end.length());
+            return line;
+        }
+        searchFrom = _pending.length() >= end.length() ? _pending.length() - end.length() + 1 : 0;
+
+        const ssize_t readSize = _handler->Wrapper_Read(_fd, buffer.data(), buffer.size());
+        if (readSize <= 0) { break; }
+        _pending.append(buffer.data(), readSize);
     }
+    line.swap(_pending);
 #endif
     return line;
 }
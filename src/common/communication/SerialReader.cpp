@@ -0,0 +1,690 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include "common/communication/SerialReader.hpp"
+#include "common/container/ByteRing.hpp"
+#include "common/thread/Thread.hpp"
+#include "common/Exception.hpp"
+#include "common/logging/Logger.hpp"
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+namespace common
+{
+namespace detail
+{
+/**
+ * @brief Finds the first complete delimiter in [begin, end)
+ */
+static auto find_delimiter(const uint8_t* begin, const uint8_t* end, const std::string& delimiter) noexcept -> const uint8_t*
+{
+    const size_t delimiterSize = delimiter.size();
+    const uint8_t first = static_cast<uint8_t>(delimiter[0]);
+    while(begin < end)
+    {
+        const auto* found = static_cast<const uint8_t*>(std::memchr(begin, first, end - begin));
+        if(found == nullptr || static_cast<size_t>(end - found) < delimiterSize) { return nullptr; }
+        if(delimiterSize == 1 || std::memcmp(found + 1, delimiter.data() + 1, delimiterSize - 1) == 0) { return found; }
+        begin = found + 1;
+    }
+    return nullptr;
+}
+
+class DelimiterParserDetail final : public DelimiterParser
+{
+private :
+    const std::string _delimiter;
+    const size_t _maxFrameSize;
+    std::vector<uint8_t> _pending;
+    bool _discarding = false;
+    size_t _errors = 0;
+
+public :
+    DelimiterParserDetail(const std::string& delimiter, const size_t maxFrameSize)
+        : _delimiter(delimiter), _maxFrameSize(maxFrameSize)
+    {
+        _pending.reserve(maxFrameSize);
+    }
+
+public :
+    auto feed(const uint8_t* data, const size_t size, const Handler& handler) -> void override
+    {
+        const uint8_t* cursor = data;
+        const uint8_t* end = data + size;
+        const size_t delimiterSize = _delimiter.size();
+
+        if(!_pending.empty() || _discarding)
+        {
+            // A delimiter split between the previous chunk and this one
+            for(size_t split = std::min(delimiterSize - 1, _pending.size()); split > 0; --split)
+            {
+                if(size < delimiterSize - split) { continue; }
+                if(std::memcmp(_pending.data() + _pending.size() - split, _delimiter.data(), split) != 0) { continue; }
+                if(std::memcmp(data, _delimiter.data() + split, delimiterSize - split) != 0) { continue; }
+
+                _pending.resize(_pending.size() - split);
+                complete_pending(handler);
+                cursor = data + (delimiterSize - split);
+                break;
+            }
+
+            if(!_pending.empty() || _discarding)
+            {
+                const uint8_t* found = find_delimiter(cursor, end, _delimiter);
+                append(cursor, found ? found : end);
+                if(found == nullptr) { return; }
+                complete_pending(handler);
+                cursor = found + delimiterSize;
+            }
+        }
+
+        // Frames entirely in this chunk are handed out without being copied.
+        while(cursor < end)
+        {
+            const uint8_t* found = find_delimiter(cursor, end, _delimiter);
+            if(found == nullptr)
+            {
+                append(cursor, end);
+                return;
+            }
+
+            if(static_cast<size_t>(found - cursor) <= _maxFrameSize) { handler(Frame(cursor, found - cursor)); }
+            else { ++_errors; }
+            cursor = found + delimiterSize;
+        }
+    }
+
+    auto reset() noexcept -> void override
+    {
+        _pending.clear();
+        _discarding = false;
+    }
+
+    auto get_errors() const noexcept -> size_t override { return _errors; }
+
+private :
+    auto append(const uint8_t* begin, const uint8_t* end) -> void
+    {
+        if(_discarding) { return; }
+        if(_pending.size() + (end - begin) > _maxFrameSize + _delimiter.size() - 1)
+        {
+            ++_errors;
+            _pending.clear();
+            _discarding = true;
+            return;
+        }
+        _pending.insert(_pending.end(), begin, end);
+    }
+
+    auto complete_pending(const Handler& handler) -> void
+    {
+        if(!_discarding)
+        {
+            if(_pending.size() <= _maxFrameSize) { handler(Frame(_pending.data(), _pending.size())); }
+            else { ++_errors; }
+        }
+        _pending.clear();
+        _discarding = false;
+    }
+};
+
+class LengthPrefixParserDetail final : public LengthPrefixParser
+{
+private :
+    const uint8_t _headerSize;
+    const size_t _maxFrameSize;
+
+    std::array<uint8_t, 4> _header{};
+    uint8_t _headerFill = 0;
+    size_t _length = 0;
+    size_t _skip = 0;
+    std::vector<uint8_t> _pending;
+    size_t _errors = 0;
+
+public :
+    LengthPrefixParserDetail(const uint8_t headerSize, const size_t maxFrameSize)
+        : _headerSize(headerSize), _maxFrameSize(maxFrameSize)
+    {
+        _pending.reserve(maxFrameSize);
+    }
+
+public :
+    auto feed(const uint8_t* data, const size_t size, const Handler& handler) -> void override
+    {
+        const uint8_t* cursor = data;
+        const uint8_t* end = data + size;
+        while(cursor < end)
+        {
+            if(_headerFill < _headerSize)
+            {
+                const size_t chunk = std::min<size_t>(_headerSize - _headerFill, end - cursor);
+                std::memcpy(_header.data() + _headerFill, cursor, chunk);
+                _headerFill += static_cast<uint8_t>(chunk);
+                cursor += chunk;
+                if(_headerFill < _headerSize) { return; }
+
+                _length = 0;
+                for(uint8_t i = 0; i < _headerSize; ++i) { _length = (_length << 8) | _header[i]; }
+                if(_length > _maxFrameSize)
+                {
+                    ++_errors;
+                    _skip = _length;
+                }
+                else if(_length == 0)
+                {
+                    handler(Frame());
+                    _headerFill = 0;
+                }
+                continue;
+            }
+
+            if(_skip > 0)
+            {
+                const size_t chunk = std::min<size_t>(_skip, end - cursor);
+                cursor += chunk;
+                _skip -= chunk;
+                if(_skip == 0) { _headerFill = 0; }
+                continue;
+            }
+
+            if(_pending.empty() && static_cast<size_t>(end - cursor) >= _length)
+            {
+                handler(Frame(cursor, _length));
+                cursor += _length;
+                _headerFill = 0;
+                continue;
+            }
+
+            const size_t chunk = std::min<size_t>(_length - _pending.size(), end - cursor);
+            _pending.insert(_pending.end(), cursor, cursor + chunk);
+            cursor += chunk;
+            if(_pending.size() == _length)
+            {
+                handler(Frame(_pending.data(), _pending.size()));
+                _pending.clear();
+                _headerFill = 0;
+            }
+        }
+    }
+
+    auto reset() noexcept -> void override
+    {
+        _headerFill = 0;
+        _skip = 0;
+        _pending.clear();
+    }
+
+    auto get_errors() const noexcept -> size_t override { return _errors; }
+};
+
+class SlipParserDetail final : public SlipParser
+{
+private :
+    const size_t _maxFrameSize;
+    std::vector<uint8_t> _frame;
+    bool _escaped = false;
+    bool _overflow = false;
+    size_t _errors = 0;
+
+public :
+    explicit SlipParserDetail(const size_t maxFrameSize)
+        : _maxFrameSize(maxFrameSize)
+    {
+        _frame.reserve(maxFrameSize);
+    }
+
+public :
+    auto feed(const uint8_t* data, const size_t size, const Handler& handler) -> void override
+    {
+        const uint8_t* cursor = data;
+        const uint8_t* end = data + size;
+        while(cursor < end)
+        {
+            if(_escaped)
+            {
+                _escaped = false;
+                const uint8_t byte = *cursor++;
+                if(byte == ESC_END) { push(&END, &END + 1); }
+                else if(byte == ESC_ESC) { push(&ESC, &ESC + 1); }
+                else { _overflow = true; } // protocol violation, drop the frame
+                continue;
+            }
+
+            // Copy the run of plain bytes at once
+            const uint8_t* run = cursor;
+            while(run < end && *run != END && *run != ESC) { ++run; }
+            push(cursor, run);
+            cursor = run;
+            if(cursor == end) { break; }
+
+            if(*cursor++ == ESC)
+            {
+                _escaped = true;
+                continue;
+            }
+
+            if(_overflow) { ++_errors; }
+            else if(!_frame.empty()) { handler(Frame(_frame.data(), _frame.size())); }
+            _frame.clear();
+            _overflow = false;
+        }
+    }
+
+    auto reset() noexcept -> void override
+    {
+        _frame.clear();
+        _escaped = false;
+        _overflow = false;
+    }
+
+    auto get_errors() const noexcept -> size_t override { return _errors; }
+
+private :
+    auto push(const uint8_t* begin, const uint8_t* end) -> void
+    {
+        if(_overflow || begin == end) { return; }
+        if(_frame.size() + (end - begin) > _maxFrameSize)
+        {
+            _overflow = true;
+            return;
+        }
+        _frame.insert(_frame.end(), begin, end);
+    }
+};
+
+class CobsParserDetail final : public CobsParser
+{
+private :
+    const size_t _maxFrameSize;
+    std::vector<uint8_t> _pending;
+    std::vector<uint8_t> _decoded;
+    bool _overflow = false;
+    size_t _errors = 0;
+
+public :
+    explicit CobsParserDetail(const size_t maxFrameSize)
+        : _maxFrameSize(maxFrameSize)
+    {
+        // Encoded size is at most 1 byte per 254 bytes larger than the frame
+        _pending.reserve(maxFrameSize + maxFrameSize / 254 + 1);
+        _decoded.reserve(maxFrameSize);
+    }
+
+public :
+    auto feed(const uint8_t* data, const size_t size, const Handler& handler) -> void override
+    {
+        const uint8_t* cursor = data;
+        const uint8_t* end = data + size;
+        while(cursor < end)
+        {
+            const auto* found = static_cast<const uint8_t*>(std::memchr(cursor, 0, end - cursor));
+            if(found == nullptr)
+            {
+                append(cursor, end);
+                return;
+            }
+
+            if(_pending.empty() && !_overflow) { complete(cursor, found - cursor, handler); }
+            else
+            {
+                append(cursor, found);
+                if(!_overflow) { complete(_pending.data(), _pending.size(), handler); }
+                else { ++_errors; }
+            }
+            _pending.clear();
+            _overflow = false;
+            cursor = found + 1;
+        }
+    }
+
+    auto reset() noexcept -> void override
+    {
+        _pending.clear();
+        _overflow = false;
+    }
+
+    auto get_errors() const noexcept -> size_t override { return _errors; }
+
+private :
+    auto append(const uint8_t* begin, const uint8_t* end) -> void
+    {
+        if(_overflow) { return; }
+        if(_pending.size() + (end - begin) > _pending.capacity())
+        {
+            _overflow = true;
+            return;
+        }
+        _pending.insert(_pending.end(), begin, end);
+    }
+
+    auto complete(const uint8_t* encoded, const size_t size, const Handler& handler) -> void
+    {
+        if(size == 0) { return; }
+
+        _decoded.clear();
+        size_t index = 0;
+        while(index < size)
+        {
+            const uint8_t code = encoded[index++];
+            if(code == 0 || index + code - 1 > size || _decoded.size() + code > _maxFrameSize + 1)
+            {
+                ++_errors;
+                return;
+            }
+            _decoded.insert(_decoded.end(), encoded + index, encoded + index + code - 1);
+            index += code - 1;
+            if(code < 0xFF && index < size) { _decoded.push_back(0); }
+        }
+        if(_decoded.size() > _maxFrameSize)
+        {
+            ++_errors;
+            return;
+        }
+        handler(Frame(_decoded.data(), _decoded.size()));
+    }
+};
+
+class SerialReaderDetail final : public SerialReader
+{
+private :
+    std::shared_ptr<Serial> _serial;
+    std::shared_ptr<SerialParser> _parser;
+    ByteRing _ring;
+    const int32_t _fd;
+    int32_t _flags = -1;    /* of the port before the reader made it non-blocking, restored on release */
+
+    SerialParser::Handler _handler;
+    std::shared_ptr<EventBus> _bus;
+    std::string _topic;
+
+    int32_t _epoll = -1;
+    int32_t _stopEvent = -1;
+    int32_t _dataEvent = -1;
+    std::atomic<bool> _running{false};
+    std::atomic<size_t> _dropped{0};
+
+    std::shared_ptr<Thread> _reader;
+    std::shared_ptr<Thread> _dispatcher;
+
+public :
+    SerialReaderDetail(std::shared_ptr<Serial> serial, std::shared_ptr<SerialParser> parser, const size_t ringSize)
+        : _serial(std::move(serial)),
+          _parser(std::move(parser)),
+          _ring(ringSize),
+          _fd(_serial->get_native_handle())
+    {
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        _stopEvent = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        _dataEvent = eventfd(0, EFD_CLOEXEC);
+        if(_epoll < 0 || _stopEvent < 0 || _dataEvent < 0)
+        {
+            _ERROR_("SerialReader error: %s", strerror(errno));
+            release();
+            return;
+        }
+
+        _flags = ::fcntl(_fd, F_GETFL);
+        if(_flags >= 0 && (_flags & O_NONBLOCK) == 0) { ::fcntl(_fd, F_SETFL, _flags | O_NONBLOCK); }
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = _stopEvent;
+        epoll_ctl(_epoll, EPOLL_CTL_ADD, _stopEvent, &event);
+        event.data.fd = _fd;
+        if(epoll_ctl(_epoll, EPOLL_CTL_ADD, _fd, &event) < 0)
+        {
+            _ERROR_("SerialReader add error(%d): %s", _fd, strerror(errno));
+            release();
+        }
+    }
+
+    ~SerialReaderDetail() final
+    {
+        stop();
+        _reader.reset();
+        _dispatcher.reset();
+        release();
+    }
+
+public :
+    auto is_valid() const noexcept -> bool { return _epoll >= 0; }
+
+    auto on_frame(SerialParser::Handler handler) -> void override { _handler = std::move(handler); }
+
+    auto publish_to(std::shared_ptr<EventBus> bus, const std::string& topic) -> void override
+    {
+        _bus = std::move(bus);
+        _topic = topic;
+    }
+
+    auto run() -> std::future<void> override
+    {
+        if(_running.exchange(true)) { throw AlreadyRunningException(); }
+
+        _dispatcher = Thread::create();
+        _dispatcher->set_name("SerialDispatch");
+        std::shared_future<void> dispatched = _dispatcher->start([this](){ dispatch_loop(); }).share();
+
+        _reader = Thread::create();
+        _reader->set_name("SerialReader");
+        return _reader->start([this, dispatched](){
+            read_loop();
+            notify(_dataEvent);
+            dispatched.wait();
+        });
+    }
+
+    auto stop() noexcept -> void override
+    {
+        _running.store(false);
+        notify(_stopEvent);
+        notify(_dataEvent);
+    }
+
+    auto get_dropped() const noexcept -> size_t override { return _dropped.load(); }
+
+private :
+    static auto notify(const int32_t fd) noexcept -> void
+    {
+        if(fd < 0) { return; }
+        const uint64_t value = 1;
+        [[maybe_unused]] const auto rtn = ::write(fd, &value, sizeof(value));
+    }
+
+    auto read_loop() -> void
+    {
+        std::array<epoll_event, 2> events;
+        while(_running.load())
+        {
+            const int32_t count = epoll_wait(_epoll, events.data(), static_cast<int32_t>(events.size()), -1);
+            for(int32_t i = 0; i < count; ++i)
+            {
+                if(events[i].data.fd == _stopEvent) { return; }
+                if(!drain_port())
+                {
+                    _ERROR_("Serial port(%d) is closed", _fd);
+                    epoll_ctl(_epoll, EPOLL_CTL_DEL, _fd, nullptr);
+                }
+            }
+        }
+    }
+
+    /**
+     * @return bool False if the port is hung up
+     */
+    auto drain_port() -> bool
+    {
+        bool received = false;
+        bool alive = true;
+        while(true)
+        {
+            auto [span, available] = _ring.write_span();
+            if(available == 0)
+            {
+                // The parser is behind. Keep draining the port so that the driver does not overrun.
+                std::array<uint8_t, 4096> discard;
+                const ssize_t readSize = ::read(_fd, discard.data(), discard.size());
+                if(readSize > 0)
+                {
+                    _dropped.fetch_add(readSize);
+                    continue;
+                }
+                alive = readSize < 0 && (errno == EAGAIN || errno == EINTR);
+                break;
+            }
+
+            const ssize_t readSize = ::read(_fd, span, available);
+            if(readSize > 0)
+            {
+                _ring.commit(readSize);
+                received = true;
+                continue;
+            }
+            if(readSize < 0 && errno == EINTR) { continue; }
+            alive = readSize < 0 && errno == EAGAIN;
+            break;
+        }
+
+        if(received) { notify(_dataEvent); }
+        return alive;
+    }
+
+    auto dispatch_loop() -> void
+    {
+        const SerialParser::Handler deliver = [this](const Frame& frame){
+            if(_handler) { _handler(frame); }
+            if(_bus) { _bus->publish(_topic, EventBus::Payload(frame.begin(), frame.end())); }
+        };
+
+        while(true)
+        {
+            uint64_t value = 0;
+            if(::read(_dataEvent, &value, sizeof(value)) < 0 && errno != EINTR) { break; }
+
+            while(true)
+            {
+                auto [span, size] = _ring.read_span();
+                if(size == 0) { break; }
+                _parser->feed(span, size, deliver);
+                _ring.consume(size);
+            }
+
+            if(!_running.load()) { break; }
+        }
+    }
+
+    auto release() noexcept -> void
+    {
+        // the port belongs to the caller, unless it was closed meanwhile and the fd may be someone else's
+        if(_flags >= 0 && _serial->get_native_handle() == _fd) { ::fcntl(_fd, F_SETFL, _flags); }
+        _flags = -1;
+        if(_epoll >= 0) { ::close(_epoll); }
+        if(_stopEvent >= 0) { ::close(_stopEvent); }
+        if(_dataEvent >= 0) { ::close(_dataEvent); }
+        _epoll = _stopEvent = _dataEvent = -1;
+    }
+};
+} // namespace detail
+
+auto DelimiterParser::__create(std::string delimiter /* = "\n" */,
+                               size_t maxFrameSize /* = 4096 */) noexcept -> std::shared_ptr<DelimiterParser>
+{
+    if(delimiter.empty()) { return nullptr; }
+    return std::make_shared<detail::DelimiterParserDetail>(delimiter, maxFrameSize);
+}
+
+auto LengthPrefixParser::__create(uint8_t headerSize /* = 2 */,
+                                  size_t maxFrameSize /* = 4096 */) noexcept -> std::shared_ptr<LengthPrefixParser>
+{
+    if(headerSize != 1 && headerSize != 2 && headerSize != 4) { return nullptr; }
+    return std::make_shared<detail::LengthPrefixParserDetail>(headerSize, maxFrameSize);
+}
+
+auto SlipParser::__create(size_t maxFrameSize /* = 4096 */) noexcept -> std::shared_ptr<SlipParser>
+{
+    return std::make_shared<detail::SlipParserDetail>(maxFrameSize);
+}
+
+auto SlipParser::encode(const uint8_t* data, const size_t size, std::vector<uint8_t>& out) -> void
+{
+    out.push_back(END); // flushes line noise received before the frame
+    for(size_t i = 0; i < size; ++i)
+    {
+        if(data[i] == END) { out.push_back(ESC); out.push_back(ESC_END); }
+        else if(data[i] == ESC) { out.push_back(ESC); out.push_back(ESC_ESC); }
+        else { out.push_back(data[i]); }
+    }
+    out.push_back(END);
+}
+
+auto CobsParser::__create(size_t maxFrameSize /* = 4096 */) noexcept -> std::shared_ptr<CobsParser>
+{
+    return std::make_shared<detail::CobsParserDetail>(maxFrameSize);
+}
+
+auto CobsParser::encode(const uint8_t* data, const size_t size, std::vector<uint8_t>& out) -> void
+{
+    size_t codeIndex = out.size();
+    uint8_t code = 1;
+    out.push_back(0);
+    for(size_t i = 0; i < size; ++i)
+    {
+        if(data[i] != 0)
+        {
+            out.push_back(data[i]);
+            ++code;
+        }
+        if(data[i] == 0 || code == 0xFF)
+        {
+            out[codeIndex] = code;
+            codeIndex = out.size();
+            code = 1;
+            out.push_back(0);
+        }
+    }
+    out[codeIndex] = code;
+    out.push_back(0);
+}
+
+auto SerialReader::__create(std::shared_ptr<Serial> serial,
+                            std::shared_ptr<SerialParser> parser,
+                            size_t ringSize /* = 64 * 1024 */) noexcept -> std::shared_ptr<SerialReader>
+{
+    if(serial == nullptr || parser == nullptr || serial->get_native_handle() < 0) { return nullptr; }
+
+    auto reader = std::make_shared<detail::SerialReaderDetail>(std::move(serial), std::move(parser), ringSize);
+    return reader->is_valid() ? reader : nullptr;
+}
+} // namespace common
+
+#endif
@@ -0,0 +1,60 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "CommonHeader.hpp"
+
+#if defined(LINUX)
+
+// termios2 is only declared in <asm/termbits.h>, which clashes with <termios.h>.
+// Serial.cpp reaches these through SerialHandler.
+#include <asm/ioctls.h>
+#include <asm/termbits.h>
+#include <sys/ioctl.h>
+
+#include <cstdint>
+
+namespace common::detail
+{
+auto set_termios2_speed(int32_t fd, uint32_t baudrate) -> bool
+{
+    struct termios2 options;
+    if(::ioctl(fd, TCGETS2, &options) < 0) { return false; }
+    options.c_cflag &= ~CBAUD;
+    options.c_cflag |= BOTHER;
+    options.c_cflag &= ~(CBAUD << IBSHIFT);
+    options.c_cflag |= (BOTHER << IBSHIFT);
+    options.c_ispeed = baudrate;
+    options.c_ospeed = baudrate;
+    return ::ioctl(fd, TCSETS2, &options) == 0;
+}
+
+auto get_termios2_speed(int32_t fd) -> uint32_t
+{
+    struct termios2 options;
+    if(::ioctl(fd, TCGETS2, &options) < 0) { return 0; }
+    return options.c_ospeed;
+}
+} // namespace common::detail
+
+#endif
@@ -25,7 +25,11 @@ SOFTWARE.
 #include "common/communication/Socket.hpp"
 #include "common/Exception.hpp"
 
+#include <algorithm>
+#include <array>
+#include <map>
 #include <string>
+#include <vector>
 
 #if defined(WIN32)
 #include <winsock2.h>
@@ -35,15 +39,40 @@ SOFTWARE.
 #include <sys/socket.h>
 #include <sys/select.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <cerrno>
 #include <cstring>
+#include <climits>
+#include <cstddef>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/sendfile.h>
+#include <sys/un.h>
+#include <linux/errqueue.h>
 #endif
 
 namespace common
 {
 namespace detail
 {
+#if defined(LINUX)
+static auto to_unix_address(const std::string& path, socklen_t& length) -> sockaddr_un
+{
+    sockaddr_un addrUn{};
+    addrUn.sun_family = AF_UNIX;
+    if(path.empty() || path.size() >= sizeof(addrUn.sun_path))
+    {
+        throw CommunicationException("Invalid unix socket path:" + path);
+    }
+
+    path.copy(addrUn.sun_path, path.size());
+    if(path[0] == '@') { addrUn.sun_path[0] = '\0'; } // abstract namespace
+    length = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + path.size() + (path[0] == '@' ? 0 : 1));
+    return addrUn;
+}
+#endif
+
 class DetailSocket : public Socket
 {
 private :
@@ -51,6 +80,23 @@ private :
     int32_t _conn = -1; // if server, client's fd. otherwise server's fd
     int32_t _port = -1;
     std::string _address;
+    const int32_t _domain;
+    const int32_t _type;
+
+#if defined(LINUX)
+    struct ZeroCopyPending
+    {
+        uint32_t _remaining = 0;
+        bool _copied = false;
+        ZeroCopyCompletion _completion;
+    };
+
+    int32_t _zerocopy = -1; // -1 : not tried yet, 0 : not supported, 1 : enabled
+    uint32_t _zerocopyId = 0;
+    std::map<uint32_t, std::shared_ptr<ZeroCopyPending>> _zerocopyPending;
+    size_t _zerocopyCount = 0;
+    int32_t _pipe[2] = {-1, -1};
+#endif
 
 protected :
     auto get_fd() const -> int32_t { return _fd; }
@@ -61,6 +107,11 @@ protected :
     auto set_port(int32_t port) -> void { _port = port; }
     auto get_address() const -> const std::string& { return _address; }
     auto set_address(const std::string& address) -> void { _address = address;}
+    auto get_domain() const -> int32_t { return _domain; }
+
+public :
+    DetailSocket(const int32_t domain = AF_INET, const int32_t type = SOCK_STREAM)
+        : _domain(domain), _type(type) {}
 
 public :
     auto prepare(const std::string& address, const int32_t port) -> void override
@@ -76,24 +127,42 @@ public :
         }
     #endif
 
-        set_fd(socket(AF_INET, SOCK_STREAM, 0));
-        if(get_fd() == 0)
+        set_fd(socket(_domain, _type, 0));
+        if(get_fd() < 0)
         {
             const int32_t errNo = errno;
             std::string what("Socket error:");
             what += strerror(errNo);
             close();
-            throw CommunicationException();
+            throw CommunicationException(what);
         }
     }
 
+#if defined(LINUX)
+    /**
+     * @brief Takes a connected descriptor (e.g. from socketpair())
+     */
+    auto attach(const int32_t fd) -> void
+    {
+        set_fd(fd);
+        set_conn(fd);
+    }
+#endif
+
+    auto get_native_handle() const -> int32_t override { return get_conn(); }
+
     auto close() -> void override
     {
     #if defined(WIN32)
         closesocket(get_fd());
         WSACleanup();
     #elif defined(LINUX)
-        ::close(get_fd());
+        if(get_conn() >= 0 && get_conn() != get_fd()) { ::close(get_conn()); }
+        if(get_fd() >= 0) { ::close(get_fd()); }
+        set_conn(-1);
+        set_fd(-1);
+        if(_pipe[0] >= 0) { ::close(_pipe[0]); ::close(_pipe[1]); }
+        _pipe[0] = _pipe[1] = -1;
     #endif
     }
 
@@ -178,6 +247,339 @@ public :
     {
         send(reinterpret_cast<void*>(const_cast<char*>(buffer)), size);
     }
+
+#if defined(LINUX)
+    auto sendv(const iovec* iov, const size_t count) -> size_t override
+    {
+        std::vector<iovec> remains(iov, iov + count);
+        iovec* begin = remains.data();
+        iovec* end = remains.data() + remains.size();
+
+        size_t total = 0;
+        while(begin != end)
+        {
+            msghdr msg{};
+            msg.msg_iov = begin;
+            msg.msg_iovlen = std::min<size_t>(end - begin, IOV_MAX);
+
+            const ssize_t sent = ::sendmsg(get_conn(), &msg, MSG_NOSIGNAL);
+            if(sent < 0)
+            {
+                if(errno == EINTR) { continue; }
+                const int32_t errNo = errno;
+                std::string what("Socket sendmsg error:");
+                what += strerror(errNo);
+                throw CommunicationException(what);
+            }
+            total += sent;
+
+            // Skip fully sent buffers and advance into a partially sent one.
+            size_t left = sent;
+            while(begin != end && left >= begin->iov_len)
+            {
+                left -= begin->iov_len;
+                ++begin;
+            }
+            if(begin != end)
+            {
+                begin->iov_base = static_cast<uint8_t*>(begin->iov_base) + left;
+                begin->iov_len -= left;
+            }
+        }
+        return total;
+    }
+
+    auto recvv(const iovec* iov, const size_t count) -> size_t override
+    {
+        ssize_t readSize = 0;
+        do
+        {
+            readSize = ::readv(get_conn(), iov, std::min<size_t>(count, IOV_MAX));
+        } while(readSize < 0 && errno == EINTR);
+
+        if(readSize <= 0)
+        {
+            const int32_t errNo = readSize == 0 ? ECONNRESET : errno;
+            std::string what("Socket readv error:");
+            what += strerror(errNo);
+            throw CommunicationException(what);
+        }
+        return readSize;
+    }
+
+    auto send_zerocopy(const void* buffer, const size_t size, ZeroCopyCompletion completion) -> void override
+    {
+        if(size < ZEROCOPY_THRESHOLD || !enable_zerocopy())
+        {
+            send(const_cast<void*>(buffer), size);
+            if(completion) { completion(true); }
+            return;
+        }
+
+        auto pending = std::make_shared<ZeroCopyPending>();
+        pending->_completion = std::move(completion);
+
+        const uint8_t* data = static_cast<const uint8_t*>(buffer);
+        size_t left = size;
+        while(left > 0)
+        {
+            const ssize_t sent = ::send(get_conn(), data, left, MSG_ZEROCOPY | MSG_NOSIGNAL);
+            if(sent < 0)
+            {
+                if(errno == EINTR) { continue; }
+                if(errno == ENOBUFS)
+                {
+                    // Out of optmem for pinned pages. Send the rest by copy.
+                    send(const_cast<uint8_t*>(data), left);
+                    pending->_copied = true;
+                    break;
+                }
+                const int32_t errNo = errno;
+                std::string what("Socket zerocopy send error:");
+                what += strerror(errNo);
+                throw CommunicationException(what);
+            }
+
+            // Every successful MSG_ZEROCOPY call is notified with its own sequence number.
+            _zerocopyPending[_zerocopyId++] = pending;
+            ++pending->_remaining;
+            data += sent;
+            left -= sent;
+        }
+
+        if(pending->_remaining == 0)
+        {
+            if(pending->_completion) { pending->_completion(true); }
+            return;
+        }
+        ++_zerocopyCount;
+    }
+
+    auto poll_zerocopy(const uint32_t millisecond /* = 0 */) -> size_t override
+    {
+        if(_zerocopyPending.empty()) { return 0; }
+
+        if(millisecond > 0)
+        {
+            pollfd pfd{get_conn(), 0, 0}; // POLLERR is always reported
+            ::poll(&pfd, 1, static_cast<int32_t>(millisecond));
+        }
+
+        size_t completed = 0;
+        while(true)
+        {
+            std::array<uint8_t, CMSG_SPACE(sizeof(sock_extended_err))> control;
+            msghdr msg{};
+            msg.msg_control = control.data();
+            msg.msg_controllen = control.size();
+
+            if(::recvmsg(get_conn(), &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+            {
+                if(errno == EINTR) { continue; }
+                break;
+            }
+
+            for(cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+            {
+                if(!((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                     (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR))) { continue; }
+
+                const auto* error = reinterpret_cast<const sock_extended_err*>(CMSG_DATA(cmsg));
+                if(error->ee_errno != 0 || error->ee_origin != SO_EE_ORIGIN_ZEROCOPY) { continue; }
+
+                // [ee_info, ee_data] is the range of completed sequence numbers.
+                const bool copied = (error->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+                for(uint32_t id = error->ee_info; ; ++id)
+                {
+                    completed += complete_zerocopy(id, copied);
+                    if(id == error->ee_data) { break; }
+                }
+            }
+        }
+        return completed;
+    }
+
+    auto get_zerocopy_pending() const -> size_t override { return _zerocopyCount; }
+
+    auto sendfile(const int32_t fd, const size_t offset, const size_t size) -> size_t override
+    {
+        off_t position = static_cast<off_t>(offset);
+        size_t total = 0;
+        while(total < size)
+        {
+            const ssize_t sent = ::sendfile(get_conn(), fd, &position, size - total);
+            if(sent < 0)
+            {
+                if(errno == EINTR) { continue; }
+                const int32_t errNo = errno;
+                std::string what("Socket sendfile error:");
+                what += strerror(errNo);
+                throw CommunicationException(what);
+            }
+            if(sent == 0) { break; } // end of file
+            total += sent;
+        }
+        return total;
+    }
+
+    auto splice(const int32_t fd, const size_t size) -> size_t override
+    {
+        if(_pipe[0] < 0 && ::pipe2(_pipe, O_CLOEXEC) < 0)
+        {
+            const int32_t errNo = errno;
+            std::string what("Socket pipe error:");
+            what += strerror(errNo);
+            throw CommunicationException(what);
+        }
+
+        size_t total = 0;
+        while(total < size)
+        {
+            const ssize_t filled = ::splice(fd, nullptr, _pipe[1], nullptr, size - total, SPLICE_F_MOVE | SPLICE_F_MORE);
+            if(filled < 0 && errno == EINTR) { continue; }
+            if(filled <= 0)
+            {
+                if(filled == 0) { break; } // end of input
+                const int32_t errNo = errno;
+                std::string what("Socket splice error:");
+                what += strerror(errNo);
+                throw CommunicationException(what);
+            }
+
+            ssize_t drained = 0;
+            while(drained < filled)
+            {
+                const ssize_t sent = ::splice(_pipe[0], nullptr, get_conn(), nullptr, filled - drained, SPLICE_F_MOVE | SPLICE_F_MORE);
+                if(sent < 0 && errno == EINTR) { continue; }
+                if(sent <= 0)
+                {
+                    const int32_t errNo = sent == 0 ? EPIPE : errno;
+                    ::close(_pipe[0]);
+                    ::close(_pipe[1]);
+                    _pipe[0] = _pipe[1] = -1; // the pipe may still hold data
+                    std::string what("Socket splice error:");
+                    what += strerror(errNo);
+                    throw CommunicationException(what);
+                }
+                drained += sent;
+            }
+            total += filled;
+        }
+        return total;
+    }
+
+    auto set_nodelay(const bool enable) -> bool override
+    {
+        if(_domain != AF_INET) { return false; }
+        int32_t opt = enable ? 1 : 0;
+        return ::setsockopt(get_conn(), IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt)) == 0;
+    }
+
+    auto send_fds(const void* buffer, const size_t size, const int32_t* fds, const size_t count) -> size_t override
+    {
+        if(size == 0 || count > MAX_FDS)
+        {
+            throw CommunicationException("send_fds needs 1 or more bytes and at most MAX_FDS descriptors");
+        }
+
+        std::vector<uint8_t> control(CMSG_SPACE(sizeof(int32_t) * count));
+        iovec iov{const_cast<void*>(buffer), size};
+        msghdr msg{};
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        if(count > 0)
+        {
+            msg.msg_control = control.data();
+            msg.msg_controllen = control.size();
+
+            cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+            cmsg->cmsg_level = SOL_SOCKET;
+            cmsg->cmsg_type = SCM_RIGHTS;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(int32_t) * count);
+            std::memcpy(CMSG_DATA(cmsg), fds, sizeof(int32_t) * count);
+        }
+
+        ssize_t sent = 0;
+        while((sent = ::sendmsg(get_conn(), &msg, MSG_NOSIGNAL)) < 0)
+        {
+            if(errno == EINTR) { continue; }
+            const int32_t errNo = errno;
+            std::string what("Socket send_fds error:");
+            what += strerror(errNo);
+            throw CommunicationException(what);
+        }
+        return sent;
+    }
+
+    auto recv_fds(void* buffer, const size_t size, int32_t* fds, size_t& count) -> size_t override
+    {
+        const size_t capacity = std::min(count, MAX_FDS);
+        count = 0;
+
+        std::vector<uint8_t> control(CMSG_SPACE(sizeof(int32_t) * std::max<size_t>(capacity, 1)));
+        iovec iov{buffer, size};
+        msghdr msg{};
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control.data();
+        msg.msg_controllen = control.size();
+
+        ssize_t readSize = 0;
+        while((readSize = ::recvmsg(get_conn(), &msg, MSG_CMSG_CLOEXEC)) < 0 && errno == EINTR) {}
+        if(readSize <= 0)
+        {
+            const int32_t errNo = readSize == 0 ? ECONNRESET : errno;
+            std::string what("Socket recv_fds error:");
+            what += strerror(errNo);
+            throw CommunicationException(what);
+        }
+
+        for(cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if(cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) { continue; }
+
+            const size_t received = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int32_t);
+            const auto* data = reinterpret_cast<const int32_t*>(CMSG_DATA(cmsg));
+            for(size_t i = 0; i < received; ++i)
+            {
+                if(count < capacity) { std::memcpy(&fds[count++], &data[i], sizeof(int32_t)); }
+                else
+                {
+                    int32_t fd = -1;
+                    std::memcpy(&fd, &data[i], sizeof(int32_t));
+                    ::close(fd);
+                }
+            }
+        }
+        return readSize;
+    }
+
+private :
+    auto enable_zerocopy() -> bool
+    {
+        if(_zerocopy < 0)
+        {
+            int32_t opt = 1;
+            _zerocopy = ::setsockopt(get_conn(), SOL_SOCKET, SO_ZEROCOPY, &opt, sizeof(opt)) == 0 ? 1 : 0;
+        }
+        return _zerocopy == 1;
+    }
+
+    auto complete_zerocopy(const uint32_t id, const bool copied) -> size_t
+    {
+        auto itor = _zerocopyPending.find(id);
+        if(itor == _zerocopyPending.end()) { return 0; }
+
+        auto pending = itor->second;
+        _zerocopyPending.erase(itor);
+        pending->_copied |= copied;
+        if(--pending->_remaining > 0) { return 0; }
+
+        --_zerocopyCount;
+        if(pending->_completion) { pending->_completion(pending->_copied); }
+        return 1;
+    }
+#endif
 };
 
 class Server final : public DetailSocket
@@ -285,16 +687,152 @@ public :
         }
     }
 };
+
+#if defined(LINUX)
+class UnixServer final : public DetailSocket
+{
+public :
+    explicit UnixServer(const int32_t type)
+        : DetailSocket(AF_UNIX, type) {}
+    ~UnixServer() final = default;
+
+public :
+    auto open() -> void override
+    {
+        socklen_t addrLen = 0;
+        sockaddr_un addrUn;
+        try { addrUn = to_unix_address(get_address(), addrLen); }
+        catch(const CommunicationException&)
+        {
+            close();
+            throw;
+        }
+        if(get_address()[0] != '@') { ::unlink(get_address().c_str()); } // left by a previous run
+
+        if(::bind(get_fd(), reinterpret_cast<sockaddr*>(&addrUn), addrLen) < 0)
+        {
+            const int32_t errNo = errno;
+            std::string what("Server bind error: ");
+            what += strerror(errNo);
+            close();
+            throw CommunicationException(what);
+        }
+
+        if(::listen(get_fd(), SOMAXCONN) < 0)
+        {
+            const int32_t errNo = errno;
+            std::string what("Server listen error: ");
+            what += strerror(errNo);
+            close();
+            throw CommunicationException(what);
+        }
+
+        set_conn(::accept4(get_fd(), nullptr, nullptr, SOCK_CLOEXEC));
+        if(get_conn() < 0)
+        {
+            const int32_t errNo = errno;
+            std::string what("Server accept error: ");
+            what += strerror(errNo);
+            close();
+            throw CommunicationException(what);
+        }
+    }
+
+    auto close() -> void override
+    {
+        const bool bound = get_fd() >= 0;
+        DetailSocket::close();
+        if(bound && !get_address().empty() && get_address()[0] != '@') { ::unlink(get_address().c_str()); }
+    }
+};
+
+class UnixClient final : public DetailSocket
+{
+public :
+    explicit UnixClient(const int32_t type)
+        : DetailSocket(AF_UNIX, type) {}
+    ~UnixClient() final = default;
+
+public :
+    auto open() -> void override
+    {
+        socklen_t addrLen = 0;
+        sockaddr_un addrUn;
+        try { addrUn = to_unix_address(get_address(), addrLen); }
+        catch(const CommunicationException&)
+        {
+            close();
+            throw;
+        }
+
+        if(::connect(get_fd(), reinterpret_cast<sockaddr*>(&addrUn), addrLen) < 0)
+        {
+            const int32_t errNo = errno;
+            std::string what("Client connect error:");
+            what += strerror(errNo);
+            close();
+            throw CommunicationException(what);
+        }
+        set_conn(get_fd());
+    }
+};
+#endif
 } // namespace detail
 
 auto Socket::__create(SocketType::type socketType) -> std::shared_ptr<Socket>
 {
-    return socketType == SocketType::SERVER ? std::shared_ptr<Socket>(new detail::Server(), 
-                                              [](detail::Server* obj){
-        obj->close();
-    }) : std::shared_ptr<Socket>(new detail::Client(), 
-                                 [](detail::Client* obj){
-        obj->close();
-    });
+    switch(socketType)
+    {
+        case SocketType::SERVER :
+            return std::shared_ptr<Socket>(new detail::Server(), [](detail::Server* obj){
+                obj->close();
+                delete obj;
+            });
+        case SocketType::CLIENT :
+            return std::shared_ptr<Socket>(new detail::Client(), [](detail::Client* obj){
+                obj->close();
+                delete obj;
+            });
+#if defined(LINUX)
+        case SocketType::UNIX_SERVER :
+        case SocketType::UNIX_SEQPACKET_SERVER :
+            return std::shared_ptr<Socket>(new detail::UnixServer(socketType == SocketType::UNIX_SERVER ? SOCK_STREAM : SOCK_SEQPACKET),
+                                           [](detail::UnixServer* obj){
+                obj->close();
+                delete obj;
+            });
+        case SocketType::UNIX_CLIENT :
+        case SocketType::UNIX_SEQPACKET_CLIENT :
+            return std::shared_ptr<Socket>(new detail::UnixClient(socketType == SocketType::UNIX_CLIENT ? SOCK_STREAM : SOCK_SEQPACKET),
+                                           [](detail::UnixClient* obj){
+                obj->close();
+                delete obj;
+            });
+#endif
+        default :
+            return nullptr; // datagram types are created by DatagramSocket
+    }
 };
+
+#if defined(LINUX)
+auto Socket::create_pair(SocketType::type socketType /* = SocketType::UNIX_CLIENT */) noexcept
+    -> std::pair<std::shared_ptr<Socket>, std::shared_ptr<Socket>>
+{
+    if(socketType != SocketType::UNIX_CLIENT && socketType != SocketType::UNIX_SEQPACKET_CLIENT) { return {}; }
+
+    const int32_t type = socketType == SocketType::UNIX_CLIENT ? SOCK_STREAM : SOCK_SEQPACKET;
+    int32_t fds[2] = {-1, -1};
+    if(::socketpair(AF_UNIX, type | SOCK_CLOEXEC, 0, fds) < 0) { return {}; }
+
+    auto make = [type](const int32_t fd){
+        auto* socket = new detail::UnixClient(type);
+        socket->attach(fd);
+        return std::shared_ptr<Socket>(socket, [](detail::UnixClient* obj){
+            obj->close();
+            delete obj;
+        });
+    };
+    return {make(fds[0]), make(fds[1])};
+}
+#endif
 } // namespace common
@@ -0,0 +1,95 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/container/Arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace common
+{
+Arena::Arena(size_t chunkSize /* = 64 * 1024 */, std::pmr::memory_resource* upstream /* = std::pmr::new_delete_resource() */) noexcept
+    : _upstream(upstream), _chunkSize(chunkSize) {}
+
+Arena::~Arena() { release(); }
+
+auto Arena::reset() noexcept -> void
+{
+    _current = 0;
+    _offset = 0;
+    _used = 0;
+}
+
+auto Arena::release() noexcept -> void
+{
+    for(const auto& chunk : _chunks) { _upstream->deallocate(chunk._data, chunk._size); }
+    _chunks.clear();
+    reset();
+}
+
+auto Arena::get_used() const noexcept -> size_t
+{
+    return _used + _offset;
+}
+
+auto Arena::get_capacity() const noexcept -> size_t
+{
+    size_t capacity = 0;
+    for(const auto& chunk : _chunks) { capacity += chunk._size; }
+    return capacity;
+}
+
+auto Arena::do_allocate(size_t bytes, size_t alignment) -> void*
+{
+    while(_current < _chunks.size())
+    {
+        const Chunk& chunk = _chunks[_current];
+        const uintptr_t address = reinterpret_cast<uintptr_t>(chunk._data) + _offset;
+        const size_t padding = (alignment - address % alignment) % alignment;
+        if(_offset + padding + bytes <= chunk._size)
+        {
+            _offset += padding + bytes;
+            return chunk._data + _offset - bytes;
+        }
+
+        // the rest of this chunk is skipped, later chunks kept by reset() may fit
+        _used += chunk._size;
+        _offset = 0;
+        ++_current;
+    }
+
+    // the new chunk goes last so that reset() reuses it in order, upstream memory is max_align_t aligned
+    const size_t size = std::max(_chunkSize, bytes + alignment);
+    _chunks.push_back({static_cast<char*>(_upstream->allocate(size)), size});
+    _current = _chunks.size() - 1;
+    return do_allocate(bytes, alignment);
+}
+
+auto Arena::do_deallocate(void*, size_t, size_t) -> void {}
+
+auto Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool
+{
+    return this == &other;
+}
+} // namespace common
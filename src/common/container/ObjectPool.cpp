@@ -0,0 +1,226 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/container/ObjectPool.hpp"
+
+#include <mutex>
+
+namespace common
+{
+namespace
+{
+constexpr size_t CLASS_SIZES[] = {16, 32, 48, 64, 80, 96, 112, 128, 192, 256, 384, 512, 768, 1024};
+constexpr size_t CLASS_COUNT = sizeof(CLASS_SIZES) / sizeof(CLASS_SIZES[0]);
+constexpr size_t CHUNK_SIZE = 64 * 1024;
+constexpr uint32_t BATCH = 32;          /* blocks moved between a thread cache and a central list at once */
+constexpr uint32_t CACHE = 2 * BATCH;   /* blocks a thread keeps before giving a batch back */
+
+struct Block
+{
+    Block* _next;
+};
+
+struct Central
+{
+    std::mutex _lock;
+    Block* _free = nullptr;
+    char* _chunk = nullptr;     /* uncarved tail of the newest chunk */
+    size_t _left = 0;
+};
+
+struct Cache
+{
+    Block* _free = nullptr;
+    uint32_t _count = 0;
+};
+
+// Trivially destructible so that the fast path needs no initialization guard, the Flusher registered
+// on the first refill returns the blocks at thread exit.
+struct ThreadCache
+{
+    Cache _caches[CLASS_COUNT];
+    bool _registered = false;
+    bool _destroyed = false;    /* blocks freed by later thread_local destructors go to the central lists */
+};
+
+struct Flusher
+{
+    ~Flusher();
+};
+
+thread_local ThreadCache __cache;
+
+auto get_class(size_t size) noexcept -> size_t
+{
+    if(size <= 128) { return size == 0 ? 0 : (size - 1) >> 4; }
+    size_t index = 8;
+    while(CLASS_SIZES[index] < size) { ++index; }
+    return index;
+}
+
+// Never destroyed, blocks may be returned by thread_local and static destructors.
+auto get_central(size_t index) noexcept -> Central&
+{
+    static Central* centrals = new Central[CLASS_COUNT];
+    return centrals[index];
+}
+
+auto register_flusher(ThreadCache& local) -> void
+{
+    static thread_local Flusher flusher;
+    local._registered = true;
+}
+
+// Moves up to BATCH blocks into cache, carving a new chunk when the central list is empty.
+auto refill(size_t index, Cache& cache) -> void
+{
+
+    Central& central = get_central(index);
+    const size_t blockSize = CLASS_SIZES[index];
+    std::lock_guard<std::mutex> lock(central._lock);
+    while(cache._count < BATCH)
+    {
+        Block* block = central._free;
+        if(block)
+        {
+            central._free = block->_next;
+        }
+        else
+        {
+            if(central._left < blockSize)
+            {
+                central._chunk = static_cast<char*>(::operator new(CHUNK_SIZE));
+                central._left = CHUNK_SIZE;
+            }
+            block = reinterpret_cast<Block*>(central._chunk);
+            central._chunk += blockSize;
+            central._left -= blockSize;
+        }
+        block->_next = cache._free;
+        cache._free = block;
+        ++cache._count;
+    }
+}
+
+// Gives count blocks from the front of cache back to the central list.
+auto release(size_t index, Cache& cache, uint32_t count) noexcept -> void
+{
+    if(count == 0) { return; }
+    Block* first = cache._free;
+    Block* last = first;
+    for(uint32_t i = 1; i < count; ++i) { last = last->_next; }
+    cache._free = last->_next;
+    cache._count -= count;
+
+    Central& central = get_central(index);
+    std::lock_guard<std::mutex> lock(central._lock);
+    last->_next = central._free;
+    central._free = first;
+}
+
+Flusher::~Flusher()
+{
+    ThreadCache& local = __cache;
+    for(size_t i = 0; i < CLASS_COUNT; ++i) { release(i, local._caches[i], local._caches[i]._count); }
+    local._destroyed = true;
+}
+} // namespace
+
+namespace detail
+{
+auto pool_allocate(size_t size) -> void*
+{
+    const size_t index = get_class(size);
+    ThreadCache& local = __cache;
+    if(local._destroyed)
+    {
+        Cache cache;
+        refill(index, cache);
+        Block* block = cache._free;
+        cache._free = block->_next;
+        --cache._count;
+        release(index, cache, cache._count);
+        return block;
+    }
+
+    Cache& cache = local._caches[index];
+    if(cache._count == 0)
+    {
+        if(!local._registered) { register_flusher(local); }
+        refill(index, cache);
+    }
+    Block* block = cache._free;
+    cache._free = block->_next;
+    --cache._count;
+    return block;
+}
+
+auto pool_deallocate(void* pointer, size_t size) noexcept -> void
+{
+    if(!pointer) { return; }
+    const size_t index = get_class(size);
+    Block* block = static_cast<Block*>(pointer);
+    ThreadCache& local = __cache;
+    if(local._destroyed)
+    {
+        Cache cache{block, 1};
+        block->_next = nullptr;
+        release(index, cache, 1);
+        return;
+    }
+
+    if(!local._registered) { register_flusher(local); }
+    Cache& cache = local._caches[index];
+    block->_next = cache._free;
+    cache._free = block;
+    if(++cache._count > CACHE) { release(index, cache, BATCH); }
+}
+} // namespace detail
+
+PoolResource::PoolResource(std::pmr::memory_resource* upstream /* = std::pmr::new_delete_resource() */) noexcept
+    : _upstream(upstream) {}
+
+auto PoolResource::get() noexcept -> PoolResource*
+{
+    static PoolResource* resource = new PoolResource();
+    return resource;
+}
+
+auto PoolResource::do_allocate(size_t bytes, size_t alignment) -> void*
+{
+    if(bytes <= detail::POOL_MAX_BLOCK && alignment <= detail::POOL_ALIGNMENT) { return detail::pool_allocate(bytes); }
+    return _upstream->allocate(bytes, alignment);
+}
+
+auto PoolResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) -> void
+{
+    if(bytes <= detail::POOL_MAX_BLOCK && alignment <= detail::POOL_ALIGNMENT) { detail::pool_deallocate(pointer, bytes); }
+    else { _upstream->deallocate(pointer, bytes, alignment); }
+}
+
+auto PoolResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool
+{
+    return this == &other;
+}
+} // namespace common
@@ -0,0 +1,561 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/logging/BinaryLog.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(LINUX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace common
+{
+namespace detail
+{
+namespace
+{
+constexpr char MAGIC[8] = {'C', 'L', 'B', 'I', 'N', 'L', 'O', 'G'};
+constexpr uint32_t VERSION = 1;
+
+constexpr auto align(size_t size) noexcept -> size_t
+{
+    return (size + 7) & ~size_t(7);
+}
+
+struct LogValue
+{
+    char _type;
+    union
+    {
+        int64_t _signed;
+        uint64_t _unsigned;
+        double _double;
+        long double _longDouble;
+        const void* _pointer;
+        const char* _string;
+    };
+};
+
+template <typename T>
+auto read_value(const uint8_t*& in, const uint8_t* end, T& value) noexcept -> bool
+{
+    if(static_cast<size_t>(end - in) < sizeof(T)) { return false; }
+    std::memcpy(&value, in, sizeof(T));
+    in += sizeof(T);
+    return true;
+}
+
+// Reads the arguments back with the types they were captured with.
+auto decode_values(const char* signature, const uint8_t* in, const uint8_t* end, std::vector<LogValue>& values) noexcept -> bool
+{
+    values.clear();
+    for(const char* type = signature; *type != '\0'; ++type)
+    {
+        LogValue value;
+        value._type = *type;
+        bool ok = true;
+        switch(*type)
+        {
+            case 'c' : { int8_t v; ok = read_value(in, end, v); value._signed = v; break; }
+            case 'h' : { int16_t v; ok = read_value(in, end, v); value._signed = v; break; }
+            case 'i' : { int32_t v; ok = read_value(in, end, v); value._signed = v; break; }
+            case 'l' : { int64_t v; ok = read_value(in, end, v); value._signed = v; break; }
+            case 'C' : { uint8_t v; ok = read_value(in, end, v); value._unsigned = v; break; }
+            case 'H' : { uint16_t v; ok = read_value(in, end, v); value._unsigned = v; break; }
+            case 'I' : { uint32_t v; ok = read_value(in, end, v); value._unsigned = v; break; }
+            case 'L' : { uint64_t v; ok = read_value(in, end, v); value._unsigned = v; break; }
+            case 'f' : { float v; ok = read_value(in, end, v); value._double = v; break; }
+            case 'd' : { double v; ok = read_value(in, end, v); value._double = v; break; }
+            case 'D' : { long double v; ok = read_value(in, end, v); value._longDouble = v; break; }
+            case 'p' : { const void* v; ok = read_value(in, end, v); value._pointer = v; break; }
+            case 's' :
+            {
+                const void* terminator = std::memchr(in, '\0', end - in);
+                if(terminator == nullptr) { return false; }
+                value._string = reinterpret_cast<const char*>(in);
+                in = static_cast<const uint8_t*>(terminator) + 1;
+                break;
+            }
+            default : return false;
+        }
+        if(!ok) { return false; }
+        values.push_back(value);
+    }
+    return true;
+}
+
+template <typename T>
+auto append_formatted(std::string& out, const std::string& spec, T value) noexcept -> void
+{
+    std::array<char, 256> buffer;
+    const int32_t length = std::snprintf(buffer.data(), buffer.size(), spec.c_str(), value);
+    if(length < 0) { return; }
+    if(static_cast<size_t>(length) < buffer.size())
+    {
+        out.append(buffer.data(), length);
+        return;
+    }
+    std::string large(length + 1, '\0');
+    std::snprintf(large.data(), large.size(), spec.c_str(), value);
+    out.append(large.data(), length);
+}
+
+auto append_value(std::string& out, const std::string& spec, const LogValue& value) noexcept -> void
+{
+    // Passed with the promoted type of the original argument, which the compiler checked against the spec.
+    switch(value._type)
+    {
+        case 'c' : case 'h' : case 'i' : append_formatted(out, spec, static_cast<int32_t>(value._signed)); break;
+        case 'C' : case 'H' : case 'I' : append_formatted(out, spec, static_cast<uint32_t>(value._unsigned)); break;
+        case 'l' : append_formatted(out, spec, value._signed); break;
+        case 'L' : append_formatted(out, spec, value._unsigned); break;
+        case 'f' : case 'd' : append_formatted(out, spec, value._double); break;
+        case 'D' : append_formatted(out, spec, value._longDouble); break;
+        case 'p' : append_formatted(out, spec, value._pointer); break;
+        case 's' : append_formatted(out, spec, value._string); break;
+        default : break;
+    }
+}
+
+// printf with the argument list known only at run time, one conversion at a time.
+auto format_values(const char* format, const std::vector<LogValue>& values) noexcept -> std::string
+{
+    static constexpr const char* CONVERSIONS = "diouxXeEfFgGaAcspn%";
+    std::string out;
+    size_t next = 0;
+    for(const char* c = format; *c != '\0'; ++c)
+    {
+        if(*c != '%')
+        {
+            out.push_back(*c);
+            continue;
+        }
+
+        std::string spec("%");
+        const char* p = c + 1;
+        for(; *p != '\0' && std::strchr(CONVERSIONS, *p) == nullptr; ++p)
+        {
+            if(*p == '*' && next < values.size())
+            {
+                spec += std::to_string(values[next++]._signed);
+                continue;
+            }
+            spec.push_back(*p);
+        }
+        if(*p == '\0') { break; }
+        c = p;
+        if(*p == '%') { out.push_back('%'); continue; }
+        if(*p == 'n' || next >= values.size()) { continue; }
+        spec.push_back(*p);
+        append_value(out, spec, values[next++]);
+    }
+    return out;
+}
+
+// Site ids are shared by every BinarySink of the process.
+std::atomic<uint32_t> __nextSiteId{1};
+} // namespace
+
+#if defined(LINUX)
+struct BinaryLogSegment
+{
+    std::string _path;
+    int32_t _fd = -1;
+    uint8_t* _data = nullptr;
+    size_t _size = 0;
+    std::atomic<uint64_t> _offset{0};
+    std::atomic<uint32_t> _writers{0};
+    std::atomic<bool> _retired{false};
+};
+#endif
+} // namespace detail
+
+#if defined(LINUX)
+struct BinarySink::Detail
+{
+    static constexpr uint32_t MAX_SITES = 16384;
+
+    std::string _path;
+    BinaryLogOptions _options;
+    detail::BinaryLogHeader _header;
+
+    std::mutex _lock;
+    uint32_t _index = 0;
+    std::vector<std::unique_ptr<detail::BinaryLogSegment>> _segments;
+    std::atomic<detail::BinaryLogSegment*> _current{nullptr};
+    std::unique_ptr<std::atomic<detail::LogSite*>[]> _sites{new std::atomic<detail::LogSite*>[MAX_SITES]};
+    std::atomic<uint64_t> _dropped{0};
+
+    Detail(const std::string& path, const BinaryLogOptions& options) : _path(path), _options(options)
+    {
+        for(uint32_t i = 0; i < MAX_SITES; ++i) { _sites[i].store(nullptr, std::memory_order_relaxed); }
+        calibrate();
+    }
+
+    ~Detail()
+    {
+        for(auto& segment : _segments) { close(*segment); }
+    }
+
+    auto calibrate() noexcept -> void
+    {
+        using namespace std::chrono;
+        const auto steadyBegin = steady_clock::now();
+        const uint64_t clockBegin = BinarySink::read_clock();
+        std::this_thread::sleep_for(milliseconds(10));
+        const auto steadyEnd = steady_clock::now();
+        const uint64_t clockEnd = BinarySink::read_clock();
+
+        std::memcpy(_header._magic, detail::MAGIC, sizeof(detail::MAGIC));
+        _header._version = detail::VERSION;
+        _header._headerSize = static_cast<uint32_t>(detail::align(sizeof(detail::BinaryLogHeader)));
+        _header._clockBase = clockEnd;
+        _header._realtimeBase = static_cast<uint64_t>(duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count());
+        _header._ticksPerNs = static_cast<double>(clockEnd - clockBegin) /
+                              static_cast<double>(duration_cast<nanoseconds>(steadyEnd - steadyBegin).count());
+    }
+
+    auto get_path(uint32_t index) const -> std::string
+    {
+        return index == 0 ? _path : _path + "." + std::to_string(index);
+    }
+
+    auto open_segment() noexcept -> std::unique_ptr<detail::BinaryLogSegment>
+    {
+        auto segment = std::make_unique<detail::BinaryLogSegment>();
+        segment->_path = get_path(_index);
+        segment->_size = _options._segmentSize;
+        segment->_fd = ::open(segment->_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if(segment->_fd < 0) { return nullptr; }
+
+        // preallocated so that page faults on the mapping never have to allocate blocks
+        if(::posix_fallocate(segment->_fd, 0, segment->_size) != 0 && ::ftruncate(segment->_fd, segment->_size) < 0)
+        {
+            ::close(segment->_fd);
+            return nullptr;
+        }
+        void* data = ::mmap(nullptr, segment->_size, PROT_READ | PROT_WRITE, MAP_SHARED, segment->_fd, 0);
+        if(data == MAP_FAILED)
+        {
+            ::close(segment->_fd);
+            return nullptr;
+        }
+        segment->_data = static_cast<uint8_t*>(data);
+        std::memcpy(segment->_data, &_header, sizeof(_header));
+        segment->_offset.store(_header._headerSize);
+
+        if(_index >= _options._maxFiles) { ::unlink(get_path(_index - _options._maxFiles).c_str()); }
+        ++_index;
+        return segment;
+    }
+
+    auto close(detail::BinaryLogSegment& segment) noexcept -> void
+    {
+        if(segment._data == nullptr) { return; }
+        while(segment._writers.load() != 0) { std::this_thread::yield(); }
+        const size_t used = std::min<size_t>(segment._offset.load(), segment._size);
+        ::munmap(segment._data, segment._size);
+        segment._data = nullptr;
+        if(::ftruncate(segment._fd, used) < 0) {} // the zero filled tail reads as the end of the log
+        ::close(segment._fd);
+    }
+
+    // Reserves in the given segment only, returns nullptr if it is full or retired.
+    auto reserve_in(detail::BinaryLogSegment& segment, size_t size) noexcept -> uint8_t*
+    {
+        segment._writers.fetch_add(1);
+        if(segment._retired.load())
+        {
+            segment._writers.fetch_sub(1);
+            return nullptr;
+        }
+        const uint64_t offset = segment._offset.fetch_add(size, std::memory_order_relaxed);
+        if(offset + size > segment._size)
+        {
+            segment._writers.fetch_sub(1);
+            return nullptr;
+        }
+        return segment._data + offset;
+    }
+
+    static auto publish(detail::BinaryLogSegment& segment, uint8_t* data, size_t size, uint32_t type) noexcept -> void
+    {
+        auto* record = reinterpret_cast<detail::BinaryLogRecord*>(data);
+        record->_type = type;
+        __atomic_store_n(&record->_size, static_cast<uint32_t>(size), __ATOMIC_RELEASE);
+        segment._writers.fetch_sub(1, std::memory_order_release);
+    }
+
+    auto write_site(detail::BinaryLogSegment& segment, const detail::LogSite& site, const char* signature) noexcept -> bool
+    {
+        const size_t fileLength = std::strlen(site._file) + 1;
+        const size_t formatLength = std::strlen(site._format) + 1;
+        const size_t argc = std::strlen(signature);
+        const size_t size = detail::align(sizeof(detail::BinaryLogSite) + argc + 1 + fileLength + formatLength);
+        uint8_t* data = reserve_in(segment, size);
+        if(data == nullptr) { return false; }
+
+        auto* record = reinterpret_cast<detail::BinaryLogSite*>(data);
+        record->_id = site._id.load();
+        record->_level = site._level;
+        record->_argc = static_cast<uint8_t>(argc);
+        record->_line = site._line;
+        uint8_t* out = data + sizeof(detail::BinaryLogSite);
+        std::memcpy(out, signature, argc + 1);
+        std::memcpy(out + argc + 1, site._file, fileLength);
+        std::memcpy(out + argc + 1 + fileLength, site._format, formatLength);
+        publish(segment, data, size, detail::BinaryLogRecord::DICTIONARY);
+        return true;
+    }
+
+    // Caller holds _lock.
+    auto rotate(detail::BinaryLogSegment* full) noexcept -> bool
+    {
+        if(_current.load() != full) { return true; }
+        auto segment = open_segment();
+        if(segment == nullptr) { return false; }
+
+        // every file describes the sites it may contain
+        for(uint32_t id = 1; id < MAX_SITES; ++id)
+        {
+            detail::LogSite* site = _sites[id].load();
+            if(site != nullptr) { write_site(*segment, *site, _signatures[id].c_str()); }
+        }
+
+        full->_retired.store(true);
+        _current.store(segment.get());
+        _segments.push_back(std::move(segment));
+        close(*full);
+        return true;
+    }
+
+    std::vector<std::string> _signatures = std::vector<std::string>(MAX_SITES);
+};
+
+BinarySink::BinarySink(std::unique_ptr<Detail> detail) noexcept
+    : _detail(std::move(detail)) {}
+
+BinarySink::~BinarySink() = default;
+
+auto BinarySink::__create(const std::string& path, const BinaryLogOptions& options) noexcept -> std::shared_ptr<BinarySink>
+{
+    if(options._segmentSize < 4096 || options._maxFiles == 0) { return nullptr; }
+    auto detail = std::make_unique<Detail>(path, options);
+    auto segment = detail->open_segment();
+    if(segment == nullptr) { return nullptr; }
+    detail->_current.store(segment.get());
+    detail->_segments.push_back(std::move(segment));
+    return std::make_shared<BinarySink>(std::move(detail));
+}
+
+auto BinarySink::is_known(uint32_t id) const noexcept -> bool
+{
+    return id != 0 && id < Detail::MAX_SITES && _detail->_sites[id].load(std::memory_order_acquire) != nullptr;
+}
+
+auto BinarySink::add_site(detail::LogSite& site, const char* signature, size_t argc) noexcept -> bool
+{
+    std::lock_guard<std::mutex> lock(_detail->_lock);
+    uint32_t id = site._id.load();
+    if(id == 0)
+    {
+        const uint32_t assigned = detail::__nextSiteId.fetch_add(1);
+        site._id.compare_exchange_strong(id, assigned);
+        id = site._id.load();
+    }
+    if(id >= Detail::MAX_SITES || argc > UINT8_MAX)
+    {
+        _detail->_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if(_detail->_sites[id].load() != nullptr) { return true; }
+
+    while(!_detail->write_site(*_detail->_current.load(), site, signature))
+    {
+        if(!_detail->rotate(_detail->_current.load())) { return false; }
+    }
+    _detail->_signatures[id] = signature;
+    _detail->_sites[id].store(&site, std::memory_order_release);
+    return true;
+}
+
+auto BinarySink::reserve(size_t size) noexcept -> detail::BinaryLogSlot
+{
+    size = detail::align(size);
+    if(size + _detail->_header._headerSize > _detail->_options._segmentSize)
+    {
+        _detail->_dropped.fetch_add(1, std::memory_order_relaxed);
+        return {nullptr, nullptr, 0};
+    }
+    while(true)
+    {
+        detail::BinaryLogSegment* segment = _detail->_current.load(std::memory_order_acquire);
+        uint8_t* data = _detail->reserve_in(*segment, size);
+        if(data != nullptr)
+        {
+            return {data, segment, size};
+        }
+
+        std::lock_guard<std::mutex> lock(_detail->_lock);
+        if(!_detail->rotate(segment))
+        {
+            _detail->_dropped.fetch_add(1, std::memory_order_relaxed);
+            return {nullptr, nullptr, 0};
+        }
+    }
+}
+
+auto BinarySink::publish(const detail::BinaryLogSlot& slot, uint32_t type) noexcept -> void
+{
+    Detail::publish(*slot._segment, slot._data, slot._size, type);
+}
+
+auto BinarySink::write(const LogRecord& record) noexcept -> void
+{
+    const char* file = record._file != nullptr ? record._file : "";
+    const size_t fileLength = std::strlen(file) + 1;
+    const detail::BinaryLogSlot slot = reserve(sizeof(detail::BinaryLogText) + fileLength + record._size + 1);
+    if(slot._data == nullptr) { return; }
+
+    const auto& header = _detail->_header;
+    auto* text = reinterpret_cast<detail::BinaryLogText*>(slot._data);
+    text->_level = record._level;
+    text->_line = record._line;
+    text->_thread = record._thread;
+    text->_clock = header._clockBase + static_cast<uint64_t>(
+                       static_cast<double>(static_cast<int64_t>(record._timestamp - header._realtimeBase)) * header._ticksPerNs);
+    uint8_t* out = slot._data + sizeof(detail::BinaryLogText);
+    std::memcpy(out, file, fileLength);
+    std::memcpy(out + fileLength, record._message, record._size);
+    out[fileLength + record._size] = '\0';
+    publish(slot, detail::BinaryLogRecord::TEXT);
+}
+
+auto BinarySink::flush() noexcept -> void
+{
+}
+
+auto BinarySink::get_dropped() const noexcept -> uint64_t
+{
+    return _detail->_dropped.load();
+}
+#endif
+
+auto BinaryLogReader::__create(const std::string& path) noexcept -> std::shared_ptr<BinaryLogReader>
+{
+    std::ifstream file(path, std::ios::binary);
+    if(!file) { return nullptr; }
+    std::ostringstream content;
+    content << file.rdbuf();
+    std::string data = content.str();
+
+    detail::BinaryLogHeader header;
+    if(data.size() < sizeof(header)) { return nullptr; }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if(std::memcmp(header._magic, detail::MAGIC, sizeof(detail::MAGIC)) != 0 || header._version != detail::VERSION)
+    {
+        return nullptr;
+    }
+    return std::make_shared<BinaryLogReader>(std::move(data));
+}
+
+auto BinaryLogReader::read(const std::function<void(const LogRecord&)>& handler) const noexcept -> size_t
+{
+    struct Site
+    {
+        LogLevel _level;
+        int32_t _line;
+        const char* _signature;
+        const char* _file;
+        const char* _format;
+    };
+
+    detail::BinaryLogHeader header;
+    std::memcpy(&header, _data.data(), sizeof(header));
+    auto to_realtime = [&header](uint64_t clock){
+        const double elapsed = static_cast<double>(static_cast<int64_t>(clock - header._clockBase)) / header._ticksPerNs;
+        return header._realtimeBase + static_cast<int64_t>(elapsed);
+    };
+
+    const auto* begin = reinterpret_cast<const uint8_t*>(_data.data());
+    const auto* end = begin + _data.size();
+    std::unordered_map<uint32_t, Site> sites;
+    std::vector<detail::LogValue> values;
+    size_t count = 0;
+    for(const uint8_t* at = begin + header._headerSize; static_cast<size_t>(end - at) >= sizeof(detail::BinaryLogRecord);)
+    {
+        detail::BinaryLogRecord record;
+        std::memcpy(&record, at, sizeof(record));
+        if(record._size < sizeof(record) || record._size > static_cast<size_t>(end - at)) { break; }
+        const uint8_t* next = at + record._size;
+
+        if(record._type == detail::BinaryLogRecord::DICTIONARY && record._size >= sizeof(detail::BinaryLogSite))
+        {
+            detail::BinaryLogSite site;
+            std::memcpy(&site, at, sizeof(site));
+            const char* signature = reinterpret_cast<const char*>(at + sizeof(site));
+            const char* file = signature + site._argc + 1;
+            const char* format = file + std::strlen(file) + 1;
+            sites[site._id] = Site{site._level, site._line, signature, file, format};
+        }
+        else if(record._type == detail::BinaryLogRecord::EVENT && record._size >= sizeof(detail::BinaryLogEvent))
+        {
+            detail::BinaryLogEvent event;
+            std::memcpy(&event, at, sizeof(event));
+            const auto site = sites.find(event._id);
+            if(site != sites.end() && detail::decode_values(site->second._signature, at + sizeof(event), next, values))
+            {
+                const std::string message = detail::format_values(site->second._format, values);
+                handler(LogRecord{site->second._level, to_realtime(event._clock), event._thread,
+                                  site->second._file, site->second._line, message.data(), message.size()});
+                ++count;
+            }
+        }
+        else if(record._type == detail::BinaryLogRecord::TEXT && record._size >= sizeof(detail::BinaryLogText))
+        {
+            detail::BinaryLogText text;
+            std::memcpy(&text, at, sizeof(text));
+            const char* file = reinterpret_cast<const char*>(at + sizeof(text));
+            const char* message = file + std::strlen(file) + 1;
+            handler(LogRecord{text._level, to_realtime(text._clock), text._thread,
+                              *file != '\0' ? file : nullptr, text._line, message, std::strlen(message)});
+            ++count;
+        }
+        at = next;
+    }
+    return count;
+}
+} // namespace common
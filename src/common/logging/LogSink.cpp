@@ -0,0 +1,114 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/logging/LogSink.hpp"
+
+#include <algorithm>
+#include <array>
+#include <ctime>
+
+namespace common
+{
+namespace
+{
+constexpr std::array<const char*, 3> LEVEL_NAMES{ "[DEBUG] ", "[INFO] ", "[ERROR] " };
+} // namespace
+
+auto LogSink::append_line(std::string& out, const LogRecord& record, bool withTime) noexcept -> void
+{
+    if(withTime)
+    {
+        const std::time_t seconds = static_cast<std::time_t>(record._timestamp / 1000000000ULL);
+        std::tm local;
+#if defined(WINDOWS)
+        localtime_s(&local, &seconds);
+#else
+        localtime_r(&seconds, &local);
+#endif
+        std::array<char, 64> prefix;
+        const size_t length = std::strftime(prefix.data(), prefix.size(), "%Y-%m-%d %H:%M:%S", &local);
+        const int32_t tail = std::snprintf(prefix.data() + length, prefix.size() - length, ".%06u %u ",
+                                           static_cast<uint32_t>(record._timestamp % 1000000000ULL / 1000),
+                                           record._thread);
+        out.append(prefix.data(), length + std::max(tail, 0));
+    }
+    out.append(LEVEL_NAMES[static_cast<size_t>(record._level)]);
+    out.append(record._message, record._size);
+    if(record._file != nullptr)
+    {
+        std::array<char, 16> line;
+        const int32_t length = std::snprintf(line.data(), line.size(), ":%d)", record._line);
+        out.append(" (").append(record._file).append(line.data(), std::max(length, 0));
+    }
+    out.push_back('\n');
+}
+
+auto ConsoleSink::__create() noexcept -> std::shared_ptr<ConsoleSink>
+{
+    return std::make_shared<ConsoleSink>();
+}
+
+auto ConsoleSink::write(const LogRecord& record) noexcept -> void
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    append_line(_buffer, record, false);
+}
+
+auto ConsoleSink::flush() noexcept -> void
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    if(_buffer.empty()) { return; }
+    std::fwrite(_buffer.data(), 1, _buffer.size(), stdout);
+    std::fflush(stdout);
+    _buffer.clear();
+}
+
+auto FileSink::__create(const std::string& path) noexcept -> std::shared_ptr<FileSink>
+{
+    std::FILE* file = std::fopen(path.c_str(), "ab");
+    if(file == nullptr) { return nullptr; }
+    return std::make_shared<FileSink>(file);
+}
+
+FileSink::~FileSink()
+{
+    flush();
+    std::fclose(_file);
+}
+
+auto FileSink::write(const LogRecord& record) noexcept -> void
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    append_line(_buffer, record, true);
+}
+
+auto FileSink::flush() noexcept -> void
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    if(_buffer.empty()) { return; }
+    std::fwrite(_buffer.data(), 1, _buffer.size(), _file);
+    std::fflush(_file);
+    _buffer.clear();
+}
+} // namespace common
@@ -23,23 +23,404 @@ SOFTWARE.
 **********************************************************************/
 
 #include "common/logging/Logger.hpp"
+#include "common/container/ByteRing.hpp"
+#include "common/thread/Thread.hpp"
 
-#include <iostream>
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(WINDOWS)
+#include <windows.h>
+#elif defined(LINUX)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace common
 {
-auto Logger::debug(const std::string& log) -> void
+namespace detail
+{
+std::atomic<bool> AsyncLogger::_enabled{false};
+
+namespace
+{
+constexpr size_t RECORD_ALIGN = 8;
+constexpr size_t FORMAT_BUFFER_SIZE = 4096;
+constexpr uint32_t PADDING = 0x80000000U;
+
+struct ThreadRing
+{
+    ByteRing _ring;
+    std::atomic<bool> _closed{false};
+    std::atomic<bool> _writing{false};  /* between reserve() and commit(), stop() waits for it */
+    uint32_t _thread;
+    size_t _reserved = 0;
+
+    ThreadRing(size_t size, uint32_t thread) : _ring(size), _thread(thread) {}
+};
+
+class AsyncBackend
+{
+private :
+    std::mutex _lock;
+    std::mutex _drainLock;                  /* rings have a single consumer: the backend, stop() or flush() */
+    std::condition_variable _condition;
+    std::vector<std::shared_ptr<ThreadRing>> _rings;
+    std::shared_ptr<Thread> _thread;
+    std::future<void> _future;
+    AsyncLogOptions _options;
+    bool _running = false;
+    uint64_t _passes = 0;
+
+public :
+    std::atomic<uint64_t> _dropped{0};
+    std::atomic<uint64_t> _generation{0}; // bumped on every start, stale thread rings are replaced
+
+public :
+    auto start(const AsyncLogOptions& options) noexcept -> bool
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if(_running) { return false; }
+        _options = options;
+        _running = true;
+        _generation.fetch_add(1);
+        _thread = Thread::create();
+        _thread->set_name("async-logger");
+        _future = _thread->start([this](){ run(); });
+        AsyncLogger::_enabled.store(true);
+        return true;
+    }
+
+    auto stop() noexcept -> void
+    {
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            if(!_running) { return; }
+            AsyncLogger::_enabled.store(false);
+            _running = false;
+        }
+        _condition.notify_all();
+        _future.wait();
+        _thread.reset();
+
+        // A writer that saw _enabled before it was cleared may still be copying its record.
+        // Rings created from now on see it cleared, see AsyncLogger::reserve().
+        std::vector<std::shared_ptr<ThreadRing>> rings;
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            rings = _rings;
+        }
+        for(const auto& ring : rings)
+        {
+            while(ring->_writing.load(std::memory_order_seq_cst)) { std::this_thread::yield(); }
+        }
+        drain(); // records reserved while stopping
+    }
+
+    /**
+     * @brief Waits until the records committed so far are written, also drains leftovers after stop()
+     */
+    auto flush() noexcept -> void
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        if(!_running)
+        {
+            const bool pending = std::any_of(_rings.begin(), _rings.end(), [](const std::shared_ptr<ThreadRing>& ring){
+                return !ring->_ring.empty();
+            });
+            lock.unlock();
+            if(pending) { drain(); }
+            return;
+        }
+        const uint64_t target = _passes + 2; // the pass in progress may have missed the latest records
+        _condition.notify_all();
+        _condition.wait(lock, [this, target](){ return _passes >= target || !_running; });
+    }
+
+    auto create_ring(uint32_t thread) noexcept -> std::shared_ptr<ThreadRing>
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        auto ring = std::make_shared<ThreadRing>(_options._ringSize, thread);
+        _rings.push_back(ring);
+        return ring;
+    }
+
+private :
+    auto run() noexcept -> void
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        while(_running)
+        {
+            lock.unlock();
+            const size_t processed = drain();
+            lock.lock();
+            ++_passes;
+            _condition.notify_all();
+            if(processed == 0 && _running) { _condition.wait_for(lock, _options._interval); }
+        }
+    }
+
+    // Formats every committed record, then flushes each sink once.
+    auto drain() noexcept -> size_t
+    {
+        std::lock_guard<std::mutex> drainLock(_drainLock);
+        std::vector<std::shared_ptr<ThreadRing>> rings;
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            rings = _rings;
+        }
+
+        std::vector<LogSink*> sinks;
+        size_t processed = 0;
+        for(const auto& ring : rings)
+        {
+            while(true)
+            {
+                auto [data, available] = ring->_ring.read_span();
+                if(available == 0) { break; }
+                size_t offset = 0;
+                while(offset < available)
+                {
+                    const auto* record = reinterpret_cast<const AsyncLogRecord*>(data + offset);
+                    if((record->_size & PADDING) != 0)
+                    {
+                        offset += record->_size & ~PADDING;
+                        continue;
+                    }
+                    offset += record->_size;
+
+                    const auto* args = reinterpret_cast<const uint8_t*>(record + 1);
+                    auto [message, capacity] = get_format_buffer(0);
+                    int32_t length = record->_formatter(record->_format, args, message, capacity);
+                    if(length >= static_cast<int32_t>(capacity))
+                    {
+                        std::tie(message, capacity) = get_format_buffer(static_cast<size_t>(length) + 1);
+                        record->_formatter(record->_format, args, message, capacity);
+                        length = std::min(length, static_cast<int32_t>(capacity) - 1);
+                    }
+
+                    LogRecord out{record->_level, record->_timestamp, ring->_thread, record->_file, record->_line,
+                                  message, static_cast<size_t>(std::max(length, 0))};
+                    record->_sink->write(out);
+                    if(std::find(sinks.begin(), sinks.end(), record->_sink) == sinks.end()) { sinks.push_back(record->_sink); }
+                    ++processed;
+                }
+                ring->_ring.consume(available);
+            }
+        }
+        for(auto* sink : sinks) { sink->flush(); }
+
+        std::lock_guard<std::mutex> lock(_lock);
+        _rings.erase(std::remove_if(_rings.begin(), _rings.end(), [](const std::shared_ptr<ThreadRing>& ring){
+            return ring->_closed.load() && ring->_ring.empty();
+        }), _rings.end());
+        return processed;
+    }
+};
+
+// Never destroyed: thread_local rings and sinks of static loggers may still refer to it at exit.
+auto get_backend() noexcept -> AsyncBackend&
+{
+    static auto* backend = new AsyncBackend();
+    return *backend;
+}
+
+struct ThreadRingHolder
+{
+    std::shared_ptr<ThreadRing> _ring;
+    uint64_t _generation = 0;
+
+    ~ThreadRingHolder() { if(_ring) { _ring->_closed.store(true); } }
+};
+
+thread_local ThreadRingHolder __threadRing;
+} // namespace
+
+auto AsyncLogger::reserve(size_t size) noexcept -> uint8_t*
+{
+    auto& backend = get_backend();
+    const uint64_t generation = backend._generation.load(std::memory_order_relaxed);
+    if(__threadRing._generation != generation || !__threadRing._ring)
+    {
+        if(__threadRing._ring) { __threadRing._ring->_closed.store(true); }
+        __threadRing._ring = backend.create_ring(get_thread_id());
+        __threadRing._generation = generation;
+    }
+
+    ThreadRing& ring = *__threadRing._ring;
+
+    // Pairs with stop(): either it waits for this record or this sees async mode off and gives up.
+    ring._writing.store(true, std::memory_order_seq_cst);
+    if(!_enabled.load(std::memory_order_seq_cst))
+    {
+        ring._writing.store(false, std::memory_order_release);
+        return nullptr;
+    }
+
+    size = (size + RECORD_ALIGN - 1) & ~(RECORD_ALIGN - 1);
+    auto [span, available] = ring._ring.write_span();
+    if(available < size)
+    {
+        // Records never wrap: pad up to the end of the ring and continue from the start.
+        const size_t free = ring._ring.capacity() - ring._ring.size();
+        if(available == 0 || free < available + size)
+        {
+            ring._writing.store(false, std::memory_order_release);
+            backend._dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        *reinterpret_cast<uint32_t*>(span) = static_cast<uint32_t>(available) | PADDING;
+        ring._ring.commit(available);
+        std::tie(span, available) = ring._ring.write_span();
+    }
+    *reinterpret_cast<uint32_t*>(span) = static_cast<uint32_t>(size);
+    ring._reserved = size;
+    return span;
+}
+
+auto AsyncLogger::commit() noexcept -> void
+{
+    ThreadRing& ring = *__threadRing._ring;
+    ring._ring.commit(ring._reserved);
+    ring._writing.store(false, std::memory_order_release);
+}
+
+auto get_thread_id() noexcept -> uint32_t
+{
+#if defined(WINDOWS)
+    return static_cast<uint32_t>(GetCurrentThreadId());
+#elif defined(LINUX)
+    static thread_local const uint32_t id = static_cast<uint32_t>(::syscall(SYS_gettid));
+    return id;
+#endif
+}
+
+namespace
+{
+std::atomic<LogSink*> __defaultSink{nullptr};
+#if defined(LINUX)
+std::atomic<BinarySink*> __defaultBinarySink{nullptr};   /* __defaultSink if it takes raw arguments */
+#endif
+
+// Never destroyed, like the backend.
+auto get_default_sinks() noexcept -> std::pair<std::mutex, std::vector<std::shared_ptr<LogSink>>>&
+{
+    static auto* sinks = new std::pair<std::mutex, std::vector<std::shared_ptr<LogSink>>>();
+    return *sinks;
+}
+} // namespace
+
+auto get_format_buffer(size_t size) noexcept -> std::pair<char*, size_t>
+{
+    thread_local std::unique_ptr<char[]> buffer;
+    thread_local size_t capacity = 0;
+    size = std::max(size, FORMAT_BUFFER_SIZE);
+    if(capacity < size)
+    {
+        // keeps the smaller buffer if it cannot grow, the message is then truncated
+        std::unique_ptr<char[]> larger(new (std::nothrow) char[size]);
+        if(larger)
+        {
+            buffer = std::move(larger);
+            capacity = size;
+        }
+    }
+    return {buffer.get(), capacity};
+}
+
+auto get_default_sink() noexcept -> LogSink*
+{
+    LogSink* sink = __defaultSink.load(std::memory_order_acquire);
+    if(sink != nullptr) { return sink; }
+    static auto* console = new std::shared_ptr<ConsoleSink>(ConsoleSink::create());
+    return console->get();
+}
+
+#if defined(LINUX)
+auto get_default_binary_sink() noexcept -> BinarySink*
+{
+    return __defaultBinarySink.load(std::memory_order_acquire);
+}
+#endif
+} // namespace detail
+
+std::atomic<LogLevel> Logger::_level{LogLevel::DEBUG};
+
+Logger::Logger(std::shared_ptr<LogSink> sink)
+    : _sink(std::move(sink))
+{
+#if defined(LINUX)
+    _binary = dynamic_cast<BinarySink*>(_sink.get());
+#endif
+}
+
+Logger::~Logger()
+{
+    // pending records refer to the sink by raw pointer, also the ones left in the rings by stop_async()
+    if(_sink) { detail::get_backend().flush(); }
+}
+
+auto Logger::write(LogLevel level, const char* file, int32_t line, const char* message, size_t size) noexcept -> void
+{
+    LogSink* sink = _sink ? _sink.get() : detail::get_default_sink();
+    const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::system_clock::now().time_since_epoch()).count();
+    sink->write(LogRecord{level, static_cast<uint64_t>(timestamp), detail::get_thread_id(), file, line,
+                          message, size});
+    sink->flush();
+}
+
+auto Logger::set_sink(std::shared_ptr<LogSink> sink) noexcept -> void
+{
+    flush();
+    _sink = std::move(sink);
+#if defined(LINUX)
+    _binary = dynamic_cast<BinarySink*>(_sink.get());
+#endif
+}
+
+auto Logger::flush() noexcept -> void
+{
+    if(detail::AsyncLogger::_enabled.load()) { detail::get_backend().flush(); }
+    else if(_sink)
+    {
+        detail::get_backend().flush();
+        _sink->flush();
+    }
+}
+
+auto Logger::set_default_sink(std::shared_ptr<LogSink> sink) noexcept -> void
+{
+    auto& [lock, sinks] = detail::get_default_sinks();
+    std::lock_guard<std::mutex> guard(lock);
+    if(LogSink* previous = detail::__defaultSink.load()) { previous->flush(); }
+    detail::__defaultSink.store(sink.get(), std::memory_order_release);
+#if defined(LINUX)
+    detail::__defaultBinarySink.store(dynamic_cast<BinarySink*>(sink.get()), std::memory_order_release);
+#endif
+    if(sink) { sinks.push_back(std::move(sink)); }
+}
+
+auto Logger::start_async(const AsyncLogOptions& options) noexcept -> bool
 {
-    std::cout << "[DEBUG] " << log << std::endl;
+    static std::once_flag registered;
+    std::call_once(registered, [](){ std::atexit([](){ Logger::stop_async(); }); });
+    return detail::get_backend().start(options);
 }
 
-auto Logger::error(const std::string& log) -> void
+auto Logger::stop_async() noexcept -> void
 {
-    std::cout << "[ERROR] " << log << std::endl;
+    detail::get_backend().stop();
 }
 
-auto Logger::info(const std::string& log) -> void
+auto Logger::get_dropped() noexcept -> uint64_t
 {
-    std::cout << "[INFO] " << log << std::endl;
+    return detail::get_backend()._dropped.load();
 }
-} // namespace common
\ No newline at end of file
+} // namespace common
@@ -0,0 +1,254 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/logging/RotatingFileSink.hpp"
+
+#if defined(LINUX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+namespace common
+{
+namespace
+{
+thread_local std::string __line;    /* formatted outside the lock, keeps its capacity */
+} // namespace
+
+struct RotatingFileSink::Detail
+{
+    std::string _path;
+    RotatingFileOptions _options;
+
+    std::mutex _lock;
+    int32_t _fd = -1;
+    char* _data = nullptr;
+    size_t _offset = 0;
+    uint64_t _openedAt = 0;     /* system clock of the first line, ns */
+    size_t _pending = 0;        /* bytes written since the last fdatasync */
+    std::chrono::steady_clock::time_point _pendingSince;
+    std::atomic<uint64_t> _dropped{0};
+    std::atomic<bool> _syncing{false};  /* a flush() is in fdatasync, others do not pile up behind it */
+
+    Detail(const std::string& path, const RotatingFileOptions& options) : _path(path), _options(options) {}
+
+    ~Detail()
+    {
+        close();
+    }
+
+    auto get_path(uint32_t index) const -> std::string
+    {
+        return index == 0 ? _path : _path + "." + std::to_string(index);
+    }
+
+    auto open() noexcept -> bool
+    {
+        _fd = ::open(_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if(_fd < 0) { return false; }
+
+        // preallocated so that page faults on the mapping never have to allocate blocks
+        if(::posix_fallocate(_fd, 0, _options._segmentSize) != 0 && ::ftruncate(_fd, _options._segmentSize) < 0)
+        {
+            ::close(_fd);
+            _fd = -1;
+            return false;
+        }
+        void* data = ::mmap(nullptr, _options._segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+        if(data == MAP_FAILED)
+        {
+            ::close(_fd);
+            _fd = -1;
+            return false;
+        }
+        _data = static_cast<char*>(data);
+        _offset = 0;
+        _openedAt = 0;
+        return true;
+    }
+
+    auto close() noexcept -> void
+    {
+        if(_fd < 0) { return; }
+        ::munmap(_data, _options._segmentSize);
+        _data = nullptr;
+        if(::ftruncate(_fd, _offset) < 0) {} // readers stop at the first NUL of the preallocated tail anyway
+        if(_pending != 0) { ::fdatasync(_fd); }
+        _pending = 0;
+        ::close(_fd);
+        _fd = -1;
+    }
+
+    // Renames path.N-2 to path.N-1 ... path to path.1, the oldest file is replaced.
+    auto shift() noexcept -> void
+    {
+        if(_options._maxFiles <= 1)
+        {
+            ::unlink(_path.c_str());
+            return;
+        }
+        for(uint32_t index = _options._maxFiles - 1; index > 0; --index)
+        {
+            ::rename(get_path(index - 1).c_str(), get_path(index).c_str());
+        }
+    }
+
+    auto rotate() noexcept -> bool
+    {
+        if(_fd >= 0)
+        {
+            close();
+            shift();
+        }
+        return open();
+    }
+
+    auto sync() noexcept -> void
+    {
+        if(_fd < 0 || _pending == 0) { return; }
+        ::fdatasync(_fd);
+        _pending = 0;
+    }
+
+    // Hands the pending bytes to the caller, who syncs the returned duplicate after releasing _lock.
+    // The duplicate keeps the file open even if a rotation closes _fd meanwhile.
+    auto take_pending() noexcept -> int32_t
+    {
+        if(_fd < 0 || _pending == 0) { return -1; }
+        const int32_t fd = ::fcntl(_fd, F_DUPFD_CLOEXEC, 0);
+        if(fd < 0)
+        {
+            sync();
+            return -1;
+        }
+        _pending = 0;
+        return fd;
+    }
+
+    static auto sync_and_close(int32_t fd) noexcept -> void
+    {
+        if(fd < 0) { return; }
+        ::fdatasync(fd);
+        ::close(fd);
+    }
+};
+
+RotatingFileSink::RotatingFileSink(std::unique_ptr<Detail> detail) noexcept
+    : _detail(std::move(detail))
+{
+}
+
+RotatingFileSink::~RotatingFileSink() = default;
+
+auto RotatingFileSink::__create(const std::string& path, const RotatingFileOptions& options) noexcept -> std::shared_ptr<RotatingFileSink>
+{
+    if(options._segmentSize == 0) { return nullptr; }
+    auto detail = std::make_unique<Detail>(path, options);
+
+    struct stat status;
+    if(::stat(path.c_str(), &status) == 0 && status.st_size > 0) { detail->shift(); }
+    if(!detail->open()) { return nullptr; }
+    return std::make_shared<RotatingFileSink>(std::move(detail));
+}
+
+auto RotatingFileSink::write(const LogRecord& record) noexcept -> void
+{
+    __line.clear();
+    append_line(__line, record, true);
+
+    std::lock_guard<std::mutex> lock(_detail->_lock);
+    Detail& detail = *_detail;
+    if(__line.size() > detail._options._segmentSize)
+    {
+        detail._dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const uint64_t interval = static_cast<uint64_t>(std::chrono::nanoseconds(detail._options._interval).count());
+    const bool expired = interval != 0 && detail._offset != 0 && record._timestamp - detail._openedAt >= interval;
+    if(detail._fd < 0 || expired || detail._offset + __line.size() > detail._options._segmentSize)
+    {
+        if(!detail.rotate())
+        {
+            detail._dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    if(detail._offset == 0) { detail._openedAt = record._timestamp; }
+    std::memcpy(detail._data + detail._offset, __line.data(), __line.size());
+    detail._offset += __line.size();
+    if(detail._pending == 0) { detail._pendingSince = std::chrono::steady_clock::now(); }
+    detail._pending += __line.size();
+}
+
+auto RotatingFileSink::flush() noexcept -> void
+{
+    Detail& detail = *_detail;
+    int32_t fd = -1;
+    {
+        std::lock_guard<std::mutex> lock(detail._lock);
+        if(detail._pending == 0) { return; }
+        if(detail._pending < detail._options._syncBytes &&
+           std::chrono::steady_clock::now() - detail._pendingSince < detail._options._syncInterval)
+        {
+            return;
+        }
+        if(detail._syncing.exchange(true, std::memory_order_acquire)) { return; }
+        fd = detail.take_pending();
+    }
+
+    // writers keep appending to the mapping while the disk flush runs
+    Detail::sync_and_close(fd);
+    detail._syncing.store(false, std::memory_order_release);
+}
+
+auto RotatingFileSink::sync() noexcept -> void
+{
+    int32_t fd = -1;
+    {
+        std::lock_guard<std::mutex> lock(_detail->_lock);
+        fd = _detail->take_pending();
+    }
+    Detail::sync_and_close(fd);
+}
+
+auto RotatingFileSink::rotate() noexcept -> bool
+{
+    std::lock_guard<std::mutex> lock(_detail->_lock);
+    return _detail->rotate();
+}
+
+auto RotatingFileSink::get_dropped() const noexcept -> uint64_t
+{
+    return _detail->_dropped.load();
+}
+} // namespace common
+#endif
@@ -0,0 +1,165 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+#include "math/matrix.hpp"
+#include "matrix_kernel.hpp"
+
+#include <atomic>
+
+#if defined(_MSC_VER) && defined(MATRIX_KERNEL_X86)
+#include <intrin.h>
+#endif
+
+namespace common::math::kernel
+{
+namespace
+{
+constexpr Kernels<float> SCALAR_FLOAT_KERNELS = make_kernels<Scalar<float>>();
+constexpr Kernels<double> SCALAR_DOUBLE_KERNELS = make_kernels<Scalar<double>>();
+#if defined(MATRIX_KERNEL_X86)
+constexpr Kernels<float> SSE2_FLOAT_KERNELS = make_kernels<Sse2Float>();
+constexpr Kernels<double> SSE2_DOUBLE_KERNELS = make_kernels<Sse2Double>();
+#endif
+
+auto detect_isa() noexcept -> Isa
+{
+#if defined(MATRIX_KERNEL_X86)
+#if defined(COMMON_LIB_HAS_AVX2)
+#if defined(_MSC_VER)
+    int32_t info[4];
+    __cpuid(info, 1);
+    const bool fma = (info[2] & (1 << 12)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    __cpuidex(info, 7, 0);
+    const bool avx2 = (info[1] & (1 << 5)) != 0;
+    // the OS must save the ymm registers on context switches
+    if (fma && avx2 && osxsave && (_xgetbv(0) & 0x6) == 0x6) return Isa::AVX2;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return Isa::AVX2;
+#endif
+#endif
+    return Isa::SSE2;
+#else
+    return Isa::SCALAR;
+#endif
+}
+
+auto get_current() noexcept -> std::atomic<Isa>&
+{
+    static std::atomic<Isa> current(get_supported_isa());
+    return current;
+}
+
+template <typename T>
+auto get_kernels() noexcept -> const Kernels<T>&
+{
+    constexpr bool isFloat = std::is_same_v<T, float>;
+    switch (get_current().load(std::memory_order_relaxed))
+    {
+#if defined(COMMON_LIB_HAS_AVX2)
+    case Isa::AVX2 :
+        if constexpr (isFloat) return AVX2_FLOAT_KERNELS;
+        else return AVX2_DOUBLE_KERNELS;
+#endif
+#if defined(MATRIX_KERNEL_X86)
+    case Isa::SSE2 :
+        if constexpr (isFloat) return SSE2_FLOAT_KERNELS;
+        else return SSE2_DOUBLE_KERNELS;
+#endif
+    default :
+        if constexpr (isFloat) return SCALAR_FLOAT_KERNELS;
+        else return SCALAR_DOUBLE_KERNELS;
+    }
+}
+} // namespace
+
+auto get_supported_isa() noexcept -> Isa
+{
+    static const Isa supported = detect_isa();
+    return supported;
+}
+
+auto get_isa() noexcept -> Isa
+{
+    return get_current().load(std::memory_order_relaxed);
+}
+
+auto set_isa(Isa isa) noexcept -> Isa
+{
+    const Isa supported = get_supported_isa();
+    if (static_cast<uint8_t>(isa) > static_cast<uint8_t>(supported)) isa = supported;
+    get_current().store(isa, std::memory_order_relaxed);
+    return isa;
+}
+
+auto multiply(const float* lhs, const float* rhs, float* out, int32_t rows, int32_t inner, int32_t cols) -> void
+{
+    get_kernels<float>()._multiply(lhs, rhs, out, rows, inner, cols);
+}
+
+auto multiply(const double* lhs, const double* rhs, double* out, int32_t rows, int32_t inner, int32_t cols) -> void
+{
+    get_kernels<double>()._multiply(lhs, rhs, out, rows, inner, cols);
+}
+
+auto add(const float* lhs, const float* rhs, float* out, size_t count) -> void
+{
+    get_kernels<float>()._add(lhs, rhs, out, count);
+}
+
+auto add(const double* lhs, const double* rhs, double* out, size_t count) -> void
+{
+    get_kernels<double>()._add(lhs, rhs, out, count);
+}
+
+auto subtract(const float* lhs, const float* rhs, float* out, size_t count) -> void
+{
+    get_kernels<float>()._subtract(lhs, rhs, out, count);
+}
+
+auto subtract(const double* lhs, const double* rhs, double* out, size_t count) -> void
+{
+    get_kernels<double>()._subtract(lhs, rhs, out, count);
+}
+
+auto scale(const float* in, float scalar, float* out, size_t count) -> void
+{
+    get_kernels<float>()._scale(in, scalar, out, count);
+}
+
+auto scale(const double* in, double scalar, double* out, size_t count) -> void
+{
+    get_kernels<double>()._scale(in, scalar, out, count);
+}
+
+auto transpose(const float* in, float* out, int32_t rows, int32_t cols) -> void
+{
+    get_kernels<float>()._transpose(in, out, rows, cols);
+}
+
+auto transpose(const double* in, double* out, int32_t rows, int32_t cols) -> void
+{
+    get_kernels<double>()._transpose(in, out, rows, cols);
+}
+} // namespace common::math::kernel
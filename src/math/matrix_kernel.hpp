@@ -0,0 +1,333 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#define MATRIX_KERNEL_X86
+#endif
+
+namespace common::math::kernel
+{
+template <typename T>
+struct Kernels
+{
+    void (*_multiply)(const T* lhs, const T* rhs, T* out, int32_t rows, int32_t inner, int32_t cols);
+    void (*_add)(const T* lhs, const T* rhs, T* out, size_t count);
+    void (*_subtract)(const T* lhs, const T* rhs, T* out, size_t count);
+    void (*_scale)(const T* in, T scalar, T* out, size_t count);
+    void (*_transpose)(const T* in, T* out, int32_t rows, int32_t cols);
+};
+
+#if defined(COMMON_LIB_HAS_AVX2)
+// defined in matrix_avx2.cpp, which is the only file compiled for AVX2
+extern const Kernels<float> AVX2_FLOAT_KERNELS;
+extern const Kernels<double> AVX2_DOUBLE_KERNELS;
+#endif
+
+// Everything below is compiled once per instruction set. It stays in an anonymous namespace and calls no
+// inline library code, so no function built for AVX2 can be merged into the baseline by the linker.
+namespace
+{
+constexpr int32_t KC = 256;     // rows of rhs per block, kept in cache across every row of lhs
+constexpr int32_t NC = 128;     // columns of rhs per block
+constexpr int32_t MR = 4;       // rows of out accumulated in registers
+constexpr int32_t NR = 3;       // vectors of columns of out accumulated in registers, MR x NR of 16 registers
+constexpr int32_t TILE = 32;    // transpose tile
+
+inline auto minimum(int32_t lhs, int32_t rhs) -> int32_t { return lhs < rhs ? lhs : rhs; }
+
+// Vector traits: WIDTH elements per Vector, BLOCK x BLOCK elements per transpose_block
+template <typename T>
+struct Scalar
+{
+    using Value = T;
+    using Vector = T;
+    static constexpr int32_t WIDTH = 1;
+    static constexpr int32_t BLOCK = 1;
+
+    static auto load(const T* src) -> Vector { return *src; }
+    static auto store(T* dst, Vector value) -> void { *dst = value; }
+    static auto broadcast(T value) -> Vector { return value; }
+    static auto add(Vector lhs, Vector rhs) -> Vector { return lhs + rhs; }
+    static auto sub(Vector lhs, Vector rhs) -> Vector { return lhs - rhs; }
+    static auto mul(Vector lhs, Vector rhs) -> Vector { return lhs * rhs; }
+    static auto fmadd(Vector lhs, Vector rhs, Vector acc) -> Vector { return lhs * rhs + acc; }
+    static auto transpose_block(const T* in, int32_t, T* out, int32_t) -> void { *out = *in; }
+};
+
+#if defined(MATRIX_KERNEL_X86)
+struct Sse2Float
+{
+    using Value = float;
+    using Vector = __m128;
+    static constexpr int32_t WIDTH = 4;
+    static constexpr int32_t BLOCK = 4;
+
+    static auto load(const float* src) -> Vector { return _mm_loadu_ps(src); }
+    static auto store(float* dst, Vector value) -> void { _mm_storeu_ps(dst, value); }
+    static auto broadcast(float value) -> Vector { return _mm_set1_ps(value); }
+    static auto add(Vector lhs, Vector rhs) -> Vector { return _mm_add_ps(lhs, rhs); }
+    static auto sub(Vector lhs, Vector rhs) -> Vector { return _mm_sub_ps(lhs, rhs); }
+    static auto mul(Vector lhs, Vector rhs) -> Vector { return _mm_mul_ps(lhs, rhs); }
+    static auto fmadd(Vector lhs, Vector rhs, Vector acc) -> Vector { return _mm_add_ps(_mm_mul_ps(lhs, rhs), acc); }
+
+    static auto transpose_block(const float* in, int32_t ldi, float* out, int32_t ldo) -> void
+    {
+        __m128 row0 = _mm_loadu_ps(in);
+        __m128 row1 = _mm_loadu_ps(in + ldi);
+        __m128 row2 = _mm_loadu_ps(in + 2 * ldi);
+        __m128 row3 = _mm_loadu_ps(in + 3 * ldi);
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+        _mm_storeu_ps(out, row0);
+        _mm_storeu_ps(out + ldo, row1);
+        _mm_storeu_ps(out + 2 * ldo, row2);
+        _mm_storeu_ps(out + 3 * ldo, row3);
+    }
+};
+
+struct Sse2Double
+{
+    using Value = double;
+    using Vector = __m128d;
+    static constexpr int32_t WIDTH = 2;
+    static constexpr int32_t BLOCK = 2;
+
+    static auto load(const double* src) -> Vector { return _mm_loadu_pd(src); }
+    static auto store(double* dst, Vector value) -> void { _mm_storeu_pd(dst, value); }
+    static auto broadcast(double value) -> Vector { return _mm_set1_pd(value); }
+    static auto add(Vector lhs, Vector rhs) -> Vector { return _mm_add_pd(lhs, rhs); }
+    static auto sub(Vector lhs, Vector rhs) -> Vector { return _mm_sub_pd(lhs, rhs); }
+    static auto mul(Vector lhs, Vector rhs) -> Vector { return _mm_mul_pd(lhs, rhs); }
+    static auto fmadd(Vector lhs, Vector rhs, Vector acc) -> Vector { return _mm_add_pd(_mm_mul_pd(lhs, rhs), acc); }
+
+    static auto transpose_block(const double* in, int32_t ldi, double* out, int32_t ldo) -> void
+    {
+        const __m128d row0 = _mm_loadu_pd(in);
+        const __m128d row1 = _mm_loadu_pd(in + ldi);
+        _mm_storeu_pd(out, _mm_unpacklo_pd(row0, row1));
+        _mm_storeu_pd(out + ldo, _mm_unpackhi_pd(row0, row1));
+    }
+};
+#endif
+
+#if defined(MATRIX_KERNEL_X86) && defined(__AVX2__)
+struct Avx2Float
+{
+    using Value = float;
+    using Vector = __m256;
+    static constexpr int32_t WIDTH = 8;
+    static constexpr int32_t BLOCK = 4;
+
+    static auto load(const float* src) -> Vector { return _mm256_loadu_ps(src); }
+    static auto store(float* dst, Vector value) -> void { _mm256_storeu_ps(dst, value); }
+    static auto broadcast(float value) -> Vector { return _mm256_set1_ps(value); }
+    static auto add(Vector lhs, Vector rhs) -> Vector { return _mm256_add_ps(lhs, rhs); }
+    static auto sub(Vector lhs, Vector rhs) -> Vector { return _mm256_sub_ps(lhs, rhs); }
+    static auto mul(Vector lhs, Vector rhs) -> Vector { return _mm256_mul_ps(lhs, rhs); }
+    static auto fmadd(Vector lhs, Vector rhs, Vector acc) -> Vector { return _mm256_fmadd_ps(lhs, rhs, acc); }
+
+    static auto transpose_block(const float* in, int32_t ldi, float* out, int32_t ldo) -> void
+    {
+        Sse2Float::transpose_block(in, ldi, out, ldo);
+    }
+};
+
+struct Avx2Double
+{
+    using Value = double;
+    using Vector = __m256d;
+    static constexpr int32_t WIDTH = 4;
+    static constexpr int32_t BLOCK = 4;
+
+    static auto load(const double* src) -> Vector { return _mm256_loadu_pd(src); }
+    static auto store(double* dst, Vector value) -> void { _mm256_storeu_pd(dst, value); }
+    static auto broadcast(double value) -> Vector { return _mm256_set1_pd(value); }
+    static auto add(Vector lhs, Vector rhs) -> Vector { return _mm256_add_pd(lhs, rhs); }
+    static auto sub(Vector lhs, Vector rhs) -> Vector { return _mm256_sub_pd(lhs, rhs); }
+    static auto mul(Vector lhs, Vector rhs) -> Vector { return _mm256_mul_pd(lhs, rhs); }
+    static auto fmadd(Vector lhs, Vector rhs, Vector acc) -> Vector { return _mm256_fmadd_pd(lhs, rhs, acc); }
+
+    static auto transpose_block(const double* in, int32_t ldi, double* out, int32_t ldo) -> void
+    {
+        const __m256d row0 = _mm256_loadu_pd(in);
+        const __m256d row1 = _mm256_loadu_pd(in + ldi);
+        const __m256d row2 = _mm256_loadu_pd(in + 2 * ldi);
+        const __m256d row3 = _mm256_loadu_pd(in + 3 * ldi);
+        const __m256d low01 = _mm256_unpacklo_pd(row0, row1);
+        const __m256d high01 = _mm256_unpackhi_pd(row0, row1);
+        const __m256d low23 = _mm256_unpacklo_pd(row2, row3);
+        const __m256d high23 = _mm256_unpackhi_pd(row2, row3);
+        _mm256_storeu_pd(out, _mm256_permute2f128_pd(low01, low23, 0x20));
+        _mm256_storeu_pd(out + ldo, _mm256_permute2f128_pd(high01, high23, 0x20));
+        _mm256_storeu_pd(out + 2 * ldo, _mm256_permute2f128_pd(low01, low23, 0x31));
+        _mm256_storeu_pd(out + 3 * ldo, _mm256_permute2f128_pd(high01, high23, 0x31));
+    }
+};
+#endif
+
+template <typename V>
+auto add(const typename V::Value* lhs, const typename V::Value* rhs, typename V::Value* out, size_t count) -> void
+{
+    size_t x = 0;
+    for (; x + V::WIDTH <= count; x += V::WIDTH)
+        V::store(out + x, V::add(V::load(lhs + x), V::load(rhs + x)));
+    for (; x < count; ++x)
+        out[x] = lhs[x] + rhs[x];
+}
+
+template <typename V>
+auto subtract(const typename V::Value* lhs, const typename V::Value* rhs, typename V::Value* out, size_t count) -> void
+{
+    size_t x = 0;
+    for (; x + V::WIDTH <= count; x += V::WIDTH)
+        V::store(out + x, V::sub(V::load(lhs + x), V::load(rhs + x)));
+    for (; x < count; ++x)
+        out[x] = lhs[x] - rhs[x];
+}
+
+template <typename V>
+auto scale(const typename V::Value* in, typename V::Value scalar, typename V::Value* out, size_t count) -> void
+{
+    const typename V::Vector factor = V::broadcast(scalar);
+    size_t x = 0;
+    for (; x + V::WIDTH <= count; x += V::WIDTH)
+        V::store(out + x, V::mul(V::load(in + x), factor));
+    for (; x < count; ++x)
+        out[x] = in[x] * scalar;
+}
+
+template <typename V>
+auto transpose(const typename V::Value* in, typename V::Value* out, int32_t rows, int32_t cols) -> void
+{
+    constexpr int32_t B = V::BLOCK;
+    for (int32_t ii = 0; ii < rows; ii += TILE)
+    {
+        const int32_t ie = minimum(ii + TILE, rows);
+        for (int32_t jj = 0; jj < cols; jj += TILE)
+        {
+            const int32_t je = minimum(jj + TILE, cols);
+            int32_t i = ii;
+            for (; i + B <= ie; i += B)
+            {
+                int32_t j = jj;
+                for (; j + B <= je; j += B)
+                    V::transpose_block(in + static_cast<size_t>(i) * cols + j, cols, out + static_cast<size_t>(j) * rows + i, rows);
+                for (; j < je; ++j)
+                    for (int32_t r = 0; r < B; ++r)
+                        out[static_cast<size_t>(j) * rows + i + r] = in[static_cast<size_t>(i + r) * cols + j];
+            }
+            for (; i < ie; ++i)
+                for (int32_t j = jj; j < je; ++j)
+                    out[static_cast<size_t>(j) * rows + i] = in[static_cast<size_t>(i) * cols + j];
+        }
+    }
+}
+
+// out[ROWS x VECS * WIDTH] += lhs[ROWS x depth] * rhs[depth x VECS * WIDTH], accumulated in registers
+template <typename V, int32_t ROWS, int32_t VECS>
+auto multiply_tile(const typename V::Value* lhs, int32_t lda, const typename V::Value* rhs, int32_t ldb,
+                   typename V::Value* out, int32_t ldc, int32_t depth) -> void
+{
+    typename V::Vector acc[ROWS][VECS];
+    for (int32_t r = 0; r < ROWS; ++r)
+        for (int32_t v = 0; v < VECS; ++v)
+            acc[r][v] = V::load(out + r * ldc + v * V::WIDTH);
+
+    for (int32_t p = 0; p < depth; ++p)
+    {
+        typename V::Vector b[VECS];
+        for (int32_t v = 0; v < VECS; ++v)
+            b[v] = V::load(rhs + static_cast<size_t>(p) * ldb + v * V::WIDTH);
+        for (int32_t r = 0; r < ROWS; ++r)
+        {
+            const typename V::Vector a = V::broadcast(lhs[r * lda + p]);
+            for (int32_t v = 0; v < VECS; ++v)
+                acc[r][v] = V::fmadd(a, b[v], acc[r][v]);
+        }
+    }
+
+    for (int32_t r = 0; r < ROWS; ++r)
+        for (int32_t v = 0; v < VECS; ++v)
+            V::store(out + r * ldc + v * V::WIDTH, acc[r][v]);
+}
+
+template <typename V, int32_t VECS>
+auto multiply_rows(int32_t rows, const typename V::Value* lhs, int32_t lda, const typename V::Value* rhs, int32_t ldb,
+                   typename V::Value* out, int32_t ldc, int32_t depth) -> void
+{
+    switch (rows)
+    {
+    case 4 : multiply_tile<V, 4, VECS>(lhs, lda, rhs, ldb, out, ldc, depth); break;
+    case 3 : multiply_tile<V, 3, VECS>(lhs, lda, rhs, ldb, out, ldc, depth); break;
+    case 2 : multiply_tile<V, 2, VECS>(lhs, lda, rhs, ldb, out, ldc, depth); break;
+    default : multiply_tile<V, 1, VECS>(lhs, lda, rhs, ldb, out, ldc, depth); break;
+    }
+}
+
+template <typename V>
+auto multiply(const typename V::Value* lhs, const typename V::Value* rhs, typename V::Value* out, int32_t rows, int32_t inner, int32_t cols) -> void
+{
+    using T = typename V::Value;
+    static_assert(MR == 4, "multiply_rows handles up to 4 rows");
+
+    const size_t count = static_cast<size_t>(rows) * cols;
+    for (size_t x = 0; x < count; ++x)
+        out[x] = 0;
+
+    for (int32_t jj = 0; jj < cols; jj += NC)
+    {
+        const int32_t width = minimum(NC, cols - jj);
+        for (int32_t pp = 0; pp < inner; pp += KC)
+        {
+            const int32_t depth = minimum(KC, inner - pp);
+            const T* block = rhs + static_cast<size_t>(pp) * cols + jj;
+            for (int32_t i = 0; i < rows; i += MR)
+            {
+                const int32_t height = minimum(MR, rows - i);
+                const T* panel = lhs + static_cast<size_t>(i) * inner + pp;
+                T* target = out + static_cast<size_t>(i) * cols + jj;
+
+                int32_t j = 0;
+                for (; j + NR * V::WIDTH <= width; j += NR * V::WIDTH)
+                    multiply_rows<V, NR>(height, panel, inner, block + j, cols, target + j, cols, depth);
+                for (; j + V::WIDTH <= width; j += V::WIDTH)
+                    multiply_rows<V, 1>(height, panel, inner, block + j, cols, target + j, cols, depth);
+                for (; j < width; ++j)
+                    multiply_rows<Scalar<T>, 1>(height, panel, inner, block + j, cols, target + j, cols, depth);
+            }
+        }
+    }
+}
+
+template <typename V>
+constexpr auto make_kernels() -> Kernels<typename V::Value>
+{
+    return Kernels<typename V::Value>{&multiply<V>, &add<V>, &subtract<V>, &scale<V>, &transpose<V>};
+}
+} // namespace
+} // namespace common::math::kernel
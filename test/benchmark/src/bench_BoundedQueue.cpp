@@ -0,0 +1,174 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/container/BlockingQueue.hpp"
+#include "common/container/MpmcQueue.hpp"
+#include "common/container/SpscQueue.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+constexpr size_t CAPACITY = 1024;
+
+// Mutex and condition variable queue in the manner of WorkQueue, as the baseline.
+class MutexQueue
+{
+private :
+    std::deque<uint64_t> _items;
+    std::mutex _lock;
+    std::condition_variable _notEmpty;
+    std::condition_variable _notFull;
+    bool _closed = false;
+
+public :
+    explicit MutexQueue(size_t) {}
+
+    auto push_batch(const uint64_t* items, size_t count) -> size_t
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        for(size_t i = 0; i < count; ++i)
+        {
+            _notFull.wait(lock, [this](){ return _items.size() < CAPACITY; });
+            _items.push_back(items[i]);
+        }
+        _notEmpty.notify_all();
+        return count;
+    }
+
+    auto pop_batch(uint64_t* out, size_t count) -> size_t
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _notEmpty.wait(lock, [this](){ return !_items.empty() || _closed; });
+        const size_t popped = std::min(count, _items.size());
+        std::copy_n(_items.begin(), popped, out);
+        _items.erase(_items.begin(), _items.begin() + popped);
+        _notFull.notify_all();
+        return popped;
+    }
+
+    auto close() -> void
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _closed = true;
+        _notEmpty.notify_all();
+    }
+};
+
+// Every producer pushes its share in batches of the given size, consumers pop in batches until closed.
+template <typename Queue>
+auto throughput(const std::string& name, size_t producers, size_t consumers, size_t batch, uint64_t count) -> void
+{
+    Queue queue(CAPACITY);
+    std::atomic<size_t> remaining{producers};
+    std::vector<std::thread> threads;
+    const auto start = Clock::now();
+    for(size_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&queue, &remaining, batch, share = count / producers](){
+            std::vector<uint64_t> items(batch);
+            for(uint64_t i = 0; i < share; i += batch)
+            {
+                for(size_t j = 0; j < batch; ++j) { items[j] = i + j; }
+                queue.push_batch(items.data(), std::min<uint64_t>(batch, share - i));
+            }
+            if(remaining.fetch_sub(1) == 1) { queue.close(); }
+        });
+    }
+    for(size_t c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back([&queue, batch](){
+            std::vector<uint64_t> items(batch);
+            while(queue.pop_batch(items.data(), batch) != 0) {}
+        });
+    }
+    for(auto& thread : threads) { thread.join(); }
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cout << std::left << std::setw(8) << name << " " << producers << "P/" << consumers << "C batch " << std::setw(3) << batch
+              << " : " << std::fixed << std::setprecision(2) << count / elapsed / 1e6 << " M items/s" << std::endl;
+}
+
+// Round trip of one item through a pair of queues.
+template <typename Queue>
+auto latency(const std::string& name, size_t rounds) -> void
+{
+    Queue ping(CAPACITY);
+    Queue pong(CAPACITY);
+    std::thread echo([&ping, &pong](){
+        uint64_t value = 0;
+        while(ping.pop_batch(&value, 1) != 0) { pong.push_batch(&value, 1); }
+    });
+
+    std::vector<double> samples;
+    samples.reserve(rounds);
+    for(uint64_t i = 0; i < rounds; ++i)
+    {
+        uint64_t value = i;
+        const auto start = Clock::now();
+        ping.push_batch(&value, 1);
+        pong.pop_batch(&value, 1);
+        samples.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+    }
+    ping.close();
+    echo.join();
+
+    std::sort(samples.begin(), samples.end());
+    std::cout << std::left << std::setw(8) << name << " round trip : p50 " << std::fixed << std::setprecision(0)
+              << samples[samples.size() / 2] << " ns, p99 " << samples[samples.size() * 99 / 100] << " ns" << std::endl;
+}
+} // namespace
+
+// usage: bench_BoundedQueue [items]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    using Spsc = common::BlockingQueue<common::SpscQueue<uint64_t>>;
+    using Mpmc = common::BlockingQueue<common::MpmcQueue<uint64_t>>;
+    const uint64_t count = argc > 1 ? static_cast<uint64_t>(std::atoll(argv[1])) : 4000000;
+
+    for(const size_t batch : {1, 32})
+    {
+        throughput<MutexQueue>("mutex", 1, 1, batch, count);
+        throughput<Spsc>("spsc", 1, 1, batch, count);
+        throughput<Mpmc>("mpmc", 1, 1, batch, count);
+        throughput<MutexQueue>("mutex", 4, 4, batch, count);
+        throughput<Mpmc>("mpmc", 4, 4, batch, count);
+    }
+
+    latency<MutexQueue>("mutex", 20000);
+    latency<Spsc>("spsc", 20000);
+    latency<Mpmc>("mpmc", 20000);
+    return 0;
+}
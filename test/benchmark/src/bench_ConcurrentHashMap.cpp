@@ -0,0 +1,157 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+#include "common/communication/Event.hpp"
+#include "common/container/ConcurrentHashMap.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// The single lock map EventBus used before.
+template <typename Key, typename Value>
+class LockedMap
+{
+private :
+    mutable std::shared_mutex _lock;
+    std::unordered_map<Key, Value> _map;
+
+public :
+    auto try_emplace(const Key& key, const Value& value) -> bool
+    {
+        std::unique_lock<std::shared_mutex> lock(_lock);
+        return _map.try_emplace(key, value).second;
+    }
+    auto erase(const Key& key) -> bool
+    {
+        std::unique_lock<std::shared_mutex> lock(_lock);
+        return _map.erase(key) == 1;
+    }
+    auto find(const Key& key) const -> std::optional<Value>
+    {
+        std::shared_lock<std::shared_mutex> lock(_lock);
+        auto itor = _map.find(key);
+        if(itor == _map.end()) { return std::nullopt; }
+        return itor->second;
+    }
+};
+
+// Every thread runs count operations on keys in [0, keys), one in writeEvery is an erase and insert.
+template <typename Map>
+auto run(const std::string& name, Map& map, const int32_t threadCount, const uint64_t count, const uint64_t keys, const uint64_t writeEvery) -> void
+{
+    for(uint64_t key = 0; key < keys; key += 2) { map.try_emplace(key, key); }
+
+    std::atomic<uint64_t> hits{0};
+    std::vector<std::thread> threads;
+    const auto start = Clock::now();
+    for(int32_t t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t](){
+            uint64_t found = 0;
+            uint64_t key = static_cast<uint64_t>(t) * 7919;
+            for(uint64_t i = 0; i < count; ++i)
+            {
+                key = (key + 40503) % keys;
+                if(writeEvery != 0 && i % writeEvery == 0)
+                {
+                    if(!map.erase(key)) { map.try_emplace(key, key); }
+                    continue;
+                }
+                if(map.find(key)) { ++found; }
+            }
+            hits.fetch_add(found);
+        });
+    }
+    for(auto& thread : threads) { thread.join(); }
+
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    std::cout << name << " : " << elapsed / (count * threadCount) << " ns/op (hits " << hits.load() << ")" << std::endl;
+}
+
+auto publish(const std::string& name, const int32_t threadCount, const uint64_t count) -> void
+{
+    common::EventBus bus(1);
+    std::atomic<uint64_t> received{0};
+    std::vector<std::string> topics;
+    for(int32_t i = 0; i < 64; ++i)
+    {
+        topics.push_back("topic/" + std::to_string(i));
+        bus.subscribe(topics.back(), [&received](const common::EventBus::Payload&){ received.fetch_add(1, std::memory_order_relaxed); });
+    }
+
+    const common::EventBus::Payload payload(16);
+    std::vector<std::thread> threads;
+    const auto start = Clock::now();
+    for(int32_t t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t](){
+            for(uint64_t i = 0; i < count; ++i)
+            {
+                bus.publish(topics[(i + t) % topics.size()], payload);
+                // keeps subscribe and unsubscribe on the path as well
+                if(i % 256 == 0) { bus.unsubscribe(bus.subscribe(topics[i % topics.size()], [](const common::EventBus::Payload&){})); }
+            }
+        });
+    }
+    for(auto& thread : threads) { thread.join(); }
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    bus.finalize();
+    std::cout << name << " : " << elapsed / (count * threadCount) << " ns/publish" << std::endl;
+}
+} // namespace
+
+// usage: bench_ConcurrentHashMap [count] [threads]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    const uint64_t count = argc > 1 ? static_cast<uint64_t>(std::atoll(argv[1])) : 1000000;
+    const int32_t threadCount = argc > 2 ? std::atoi(argv[2]) : static_cast<int32_t>(std::thread::hardware_concurrency());
+
+    for(const uint64_t writeEvery : {uint64_t{0}, uint64_t{10}})
+    {
+        const std::string mix = writeEvery == 0 ? "find only" : "10% writes";
+        {
+            LockedMap<uint64_t, uint64_t> map;
+            run("shared_mutex + unordered_map, " + mix, map, threadCount, count, 1 << 16, writeEvery);
+        }
+        {
+            common::ConcurrentHashMap<uint64_t, uint64_t> map;
+            run("ConcurrentHashMap,            " + mix, map, threadCount, count, 1 << 16, writeEvery);
+        }
+    }
+
+    publish("EventBus publish", threadCount, count / 10);
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/communication/DatagramSocket.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+auto realtime_ns() -> uint64_t
+{
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+} // namespace
+
+// usage: bench_DatagramSocket [datagrams] [datagram size] [batch size]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    const size_t datagrams = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 1000000;
+    const size_t datagramSize = argc > 2 ? static_cast<size_t>(std::atoi(argv[2])) : 64;
+    const size_t batchSize = argc > 3 ? static_cast<size_t>(std::atoi(argv[3])) : 256;
+
+    auto receiver = common::DatagramSocket::create(common::SocketType::UDP);
+    receiver->prepare("127.0.0.1", 0);
+    receiver->set_receive_buffer(64 * 1024 * 1024);
+    receiver->set_timestamp(true);
+    receiver->open();
+
+    auto sender = common::DatagramSocket::create(common::SocketType::UDP);
+    sender->prepare("127.0.0.1", 0);
+    sender->open();
+    sender->set_destination("127.0.0.1", receiver->get_port());
+
+    std::atomic<bool> done{false};
+    std::thread producer([&](){
+        std::vector<char> payload(datagramSize, 'x');
+        std::vector<iovec> batch(batchSize, iovec{payload.data(), payload.size()});
+        for(size_t sent = 0; sent < datagrams;)
+        {
+            sent += sender->send_batch(batch.data(), std::min(batchSize, datagrams - sent));
+        }
+        done.store(true);
+    });
+
+    // wire-to-app latency : kernel receive timestamp to the time the batch is handed to the application
+    common::DatagramBatch batch(batchSize, std::max<size_t>(datagramSize, 1500));
+    std::vector<uint64_t> latencies;
+    latencies.reserve(datagrams);
+    size_t received = 0;
+    size_t calls = 0;
+    const auto start = Clock::now();
+    while(received < datagrams)
+    {
+        const size_t count = receiver->recv_batch(batch, 100);
+        if(count == 0 && done.load()) { break; } // the rest was dropped by the kernel
+        const uint64_t now = realtime_ns();
+        for(size_t i = 0; i < count; ++i)
+        {
+            if(batch.timestamp(i) != 0) { latencies.push_back(now - batch.timestamp(i)); }
+        }
+        received += count;
+        ++calls;
+    }
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    producer.join();
+
+    std::cout << "datagrams       : " << received << " / " << datagrams << " x " << datagramSize << " bytes in "
+              << elapsed << " s (" << static_cast<uint64_t>(received / elapsed) << " dgram/s)" << std::endl;
+    std::cout << "per recvmmsg    : " << (calls > 0 ? received / calls : 0) << " datagrams" << std::endl;
+
+    if(!latencies.empty())
+    {
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&latencies](const double p){ return latencies[static_cast<size_t>(p * (latencies.size() - 1))] / 1000.0; };
+        std::cout << "latency (us)    : p50 " << percentile(0.5) << " p99 " << percentile(0.99)
+                  << " max " << percentile(1.0) << std::endl;
+    }
+    return 0;
+}
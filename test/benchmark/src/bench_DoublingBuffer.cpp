@@ -0,0 +1,143 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/container/DoublingBuffer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// The former approach: every modification copies the whole vector into the next buffer.
+class CopyBuffer
+{
+private :
+    std::atomic<uint8_t> _activatedIndex{0};
+    std::shared_ptr<std::vector<int64_t>> _buffers[2] = {std::make_shared<std::vector<int64_t>>(), nullptr};
+
+    template <typename Modify>
+    auto modify(Modify&& modify) -> void
+    {
+        const uint8_t current = _activatedIndex.load();
+        auto next = std::make_shared<std::vector<int64_t>>(*_buffers[current]);
+        modify(*next);
+        _buffers[current ^ 1] = std::move(next);
+        _activatedIndex.store(current ^ 1);
+    }
+
+public :
+    auto push(int64_t item) -> void { modify([item](auto& v){ v.push_back(item); }); }
+    auto erase(size_t index) -> bool { modify([index](auto& v){ v.erase(v.begin() + index); }); return true; }
+    auto update(size_t index, int64_t item) -> bool { modify([index, item](auto& v){ v[index] = item; }); return true; }
+    auto get_buffer() -> std::shared_ptr<std::vector<int64_t>> { return _buffers[_activatedIndex.load()]; }
+};
+
+auto sum(const std::vector<int64_t>& vector) -> int64_t
+{
+    int64_t sum = 0;
+    for(const auto value : vector) { sum += value; }
+    return sum;
+}
+
+auto sum(const common::PersistentVector<int64_t>& vector) -> int64_t
+{
+    int64_t sum = 0;
+    vector.for_each_span([&sum](const int64_t* data, size_t size){
+        for(size_t i = 0; i < size; ++i) { sum += data[i]; }
+    });
+    return sum;
+}
+
+template <typename Action>
+auto measure(const std::string& name, const size_t count, Action&& action) -> void
+{
+    int64_t total = 0;
+    const auto start = Clock::now();
+    for(size_t i = 0; i < count; ++i) { total += action(i); }
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    std::cout << name << " : " << elapsed / count << " ns/op (checksum " << total << ")" << std::endl;
+}
+
+template <typename Buffer>
+auto run(const std::string& name, const size_t size, const size_t count) -> void
+{
+    Buffer buffer;
+    for(size_t i = 0; i < size; ++i) { buffer.push(static_cast<int64_t>(i)); }
+
+    const std::string prefix = name + " n=" + std::to_string(size);
+    measure(prefix + " update", count, [&](size_t i){ return buffer.update((i * 7919) % size, static_cast<int64_t>(i)) ? 1 : 0; });
+    measure(prefix + " push+erase", count, [&](size_t i){
+        buffer.push(static_cast<int64_t>(i));
+        return buffer.erase((i * 7919) % size) ? 1 : 0;
+    });
+    measure(prefix + " get_buffer", count * 10, [&](size_t i){ return static_cast<int64_t>(buffer.get_buffer()->size() + i % 2); });
+    measure(prefix + " iterate", 100, [&](size_t){
+        int64_t sum = 0;
+        auto snapshot = buffer.get_buffer();
+        for(const auto value : *snapshot) { sum += value; }
+        return sum;
+    });
+    measure(prefix + " sum spans", 100, [&](size_t){ return sum(*buffer.get_buffer()); });
+}
+
+// Reconfigures a buffer of the given size by replacing every element, one generation per element or one in total.
+auto run_bulk(const size_t size) -> void
+{
+    common::DoublingBuffer<int64_t> buffer;
+    for(size_t i = 0; i < size; ++i) { buffer.push(static_cast<int64_t>(i)); }
+
+    const std::string prefix = "persistent n=" + std::to_string(size);
+    measure(prefix + " update all, each published", 10, [&](size_t round){
+        for(size_t i = 0; i < size; ++i) { buffer.update(i, static_cast<int64_t>(round + i)); }
+        return buffer.get_generation();
+    });
+    measure(prefix + " update all, one transaction", 10, [&](size_t round){
+        auto transaction = buffer.transaction();
+        for(size_t i = 0; i < size; ++i) { transaction.update(i, static_cast<int64_t>(round + i)); }
+        transaction.commit();
+        return buffer.get_generation();
+    });
+}
+} // namespace
+
+// usage: bench_DoublingBuffer [operations]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    const size_t count = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 20000;
+
+    for(const size_t size : {1000, 10000, 100000})
+    {
+        run<CopyBuffer>("copy      ", size, count);
+        run<common::DoublingBuffer<int64_t>>("persistent", size, count);
+        run_bulk(size);
+    }
+    return 0;
+}
@@ -0,0 +1,150 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/container/LockFreeWorkQueue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Mutex deque with the owner/thief roles of WorkQueue, as the baseline.
+class MutexDeque
+{
+private :
+    std::deque<uint64_t> _items;
+    std::mutex _lock;
+
+public :
+    auto push(uint64_t item) -> void
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _items.push_back(item);
+    }
+
+    auto pop(uint64_t& item) -> bool
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if(_items.empty()) { return false; }
+        item = _items.back();
+        _items.pop_back();
+        return true;
+    }
+
+    auto steal(uint64_t& item) -> bool
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if(_items.empty()) { return false; }
+        item = _items.front();
+        _items.pop_front();
+        return true;
+    }
+
+    auto empty() -> bool
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        return _items.empty();
+    }
+};
+
+template <typename Queue>
+auto owner_only(const std::string& name, uint64_t count) -> void
+{
+    Queue queue;
+    uint64_t item = 0;
+    const auto start = Clock::now();
+    for(uint64_t i = 0; i < count; ++i)
+    {
+        queue.push(i);
+        queue.push(i);
+        queue.pop(item);
+        queue.pop(item);
+    }
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    std::cout << std::left << std::setw(10) << name << " owner push+pop      : " << std::fixed << std::setprecision(1)
+              << elapsed / (count * 2) << " ns/pair" << std::endl;
+}
+
+// The owner pushes count items and pops every fourth, thieves steal the rest.
+template <typename Queue>
+auto steal(const std::string& name, size_t thieves, uint64_t count) -> void
+{
+    Queue queue;
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> stolen{0};
+    std::vector<std::thread> threads;
+    for(size_t t = 0; t < thieves; ++t)
+    {
+        threads.emplace_back([&queue, &done, &stolen](){
+            uint64_t item = 0;
+            uint64_t local = 0;
+            while(!done.load(std::memory_order_relaxed) || !queue.empty())
+            {
+                if(queue.steal(item)) { ++local; }
+            }
+            stolen.fetch_add(local);
+        });
+    }
+
+    const auto start = Clock::now();
+    uint64_t item = 0;
+    for(uint64_t i = 0; i < count; ++i)
+    {
+        queue.push(i);
+        if((i & 3) == 3) { queue.pop(item); }
+    }
+    done.store(true);
+    for(auto& thread : threads) { thread.join(); }
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cout << std::left << std::setw(10) << name << " " << thieves << " thieves            : " << std::fixed
+              << std::setprecision(2) << count / elapsed / 1e6 << " M items/s, " << stolen.load() / elapsed / 1e6
+              << " M steals/s" << std::endl;
+}
+} // namespace
+
+// usage: bench_LockFreeWorkQueue [items]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    using Deque = common::LockFreeWorkQueue<uint64_t>;
+    const uint64_t count = argc > 1 ? static_cast<uint64_t>(std::atoll(argv[1])) : 4000000;
+
+    owner_only<MutexDeque>("mutex", count);
+    owner_only<Deque>("chase-lev", count);
+    for(const size_t thieves : {1, 2, 4})
+    {
+        steal<MutexDeque>("mutex", thieves, count);
+        steal<Deque>("chase-lev", thieves, count);
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+// Only ERROR and above are compiled in for this file, whatever the CMake option says.
+#undef COMMON_LIB_LOG_LEVEL
+#define COMMON_LIB_LOG_LEVEL 2
+
+#include "common/logging/Logger.hpp"
+#include "common/logging/RotatingFileSink.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+std::atomic<size_t> __allocations{0};
+
+template <typename Statement>
+auto measure(const std::string& name, const size_t iterations, Statement&& statement) -> void
+{
+    statement(0); // warms up the per-thread buffers
+    const size_t allocations = __allocations.load();
+    const auto start = Clock::now();
+    for(size_t i = 0; i < iterations; ++i) { statement(i); }
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    std::cout << name << " : " << elapsed / iterations << " ns/statement, "
+              << static_cast<double>(__allocations.load() - allocations) / iterations << " allocations/statement" << std::endl;
+}
+} // namespace
+
+// Counts the heap allocations of the measured statements.
+auto operator new(size_t size) -> void*
+{
+    __allocations.fetch_add(1, std::memory_order_relaxed);
+    if(void* memory = std::malloc(size != 0 ? size : 1)) { return memory; }
+    throw std::bad_alloc();
+}
+
+auto operator delete(void* memory) noexcept -> void { std::free(memory); }
+auto operator delete(void* memory, size_t) noexcept -> void { std::free(memory); }
+
+// usage: bench_Logger [iterations]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    const size_t iterations = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 1000000;
+    common::Logger logger(common::FileSink::create("/dev/null"));
+
+    measure("compiled out (DEBUG)   ", iterations, [](const size_t i){ _DEBUG_("value=%zu name=%s", i, "debug"); });
+
+    common::Logger::set_level(common::LogLevel::OFF);
+    measure("runtime disabled (ERR) ", iterations, [](const size_t i){ _ERROR_("value=%zu name=%s", i, "error"); });
+    common::Logger::set_level(common::LogLevel::DEBUG);
+
+    measure("synchronous            ", iterations, [&logger](const size_t i){
+        logger.log(common::LogLevel::ERR, __FILENAME__, __LINE__, "value=%zu name=%s", i, "sync");
+    });
+
+#if defined(LINUX)
+    {
+        common::RotatingFileOptions rotatingOptions;
+        rotatingOptions._segmentSize = 64 * 1024 * 1024;
+        rotatingOptions._maxFiles = 1;
+        common::Logger rotating(common::RotatingFileSink::create("bench_Logger.log", rotatingOptions));
+        measure("synchronous (mmap file)", iterations, [&rotating](const size_t i){
+            rotating.log(common::LogLevel::ERR, __FILENAME__, __LINE__, "value=%zu name=%s", i, "mmap");
+        });
+    }
+    std::remove("bench_Logger.log");
+#endif
+
+    common::AsyncLogOptions options;
+    options._ringSize = 16 * 1024 * 1024;
+    common::Logger::start_async(options);
+    measure("asynchronous (caller)  ", iterations, [&logger](const size_t i){
+        logger.log(common::LogLevel::ERR, __FILENAME__, __LINE__, "value=%zu name=%s", i, "async");
+    });
+    logger.flush();
+    common::Logger::stop_async();
+    std::cout << "dropped                 : " << common::Logger::get_dropped() << std::endl;
+
+#if defined(LINUX)
+    common::BinaryLogOptions binaryOptions;
+    binaryOptions._segmentSize = 256 * 1024 * 1024;
+    {
+        common::Logger binary(common::BinarySink::create("bench_Logger.bin", binaryOptions));
+        measure("binary                 ", iterations, [&binary](const size_t i){
+            _LOG_TO_(binary, common::LogLevel::ERR, "value=%zu name=%s", i, "binary");
+        });
+    }
+    std::remove("bench_Logger.bin");
+#endif
+    return 0;
+}
@@ -0,0 +1,177 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+#include "math/matrix.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+template <typename Action>
+auto measure(const std::string& name, const size_t count, Action&& action) -> void
+{
+    double total = 0;
+    const auto start = Clock::now();
+    for(size_t i = 0; i < count; ++i) { total += action(i); }
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    std::cout << name << " : " << elapsed / count << " ns/op (checksum " << total << ")" << std::endl;
+}
+
+// sums every element so no part of a result can be optimized away
+template <typename Mat>
+auto sum(const Mat& mat) -> double
+{
+    double total = 0;
+    for(int32_t row = 0; row < mat._row; ++row)
+    {
+        for(int32_t col = 0; col < mat._col; ++col) { total += mat[row][col]; }
+    }
+    return total;
+}
+
+template <int32_t N>
+auto run(const size_t count) -> void
+{
+    using common::math::Matrix;
+
+    Matrix<double, N, N> fixed;
+    Matrix<double> dynamic(N, N);
+    for(int32_t row = 0; row < N; ++row)
+    {
+        for(int32_t col = 0; col < N; ++col)
+        {
+            fixed(row, col) = (row == col) ? 1.0 : 0.001 * (row + col);
+            dynamic[row][col] = fixed(row, col);
+        }
+    }
+
+    const std::string size = std::to_string(N) + "x" + std::to_string(N);
+    measure("Matrix<double> " + size + " multiply      ", count, [&](size_t i){
+        dynamic[i % N][(i / N) % N] = static_cast<double>(i & 7);
+        return sum(dynamic * dynamic);
+    });
+    measure("Matrix<double, N, N> " + size + " multiply", count, [&](size_t i){
+        fixed(i % N, (i / N) % N) = static_cast<double>(i & 7);
+        return sum(fixed * fixed);
+    });
+    measure("Matrix<double> " + size + " add           ", count, [&](size_t i){
+        dynamic[i % N][(i / N) % N] = static_cast<double>(i & 7);
+        return sum(dynamic + dynamic);
+    });
+    measure("Matrix<double, N, N> " + size + " add     ", count, [&](size_t i){
+        fixed(i % N, (i / N) % N) = static_cast<double>(i & 7);
+        return sum(fixed + fixed);
+    });
+}
+
+// The triple loop that Matrix<T> used before the kernels, still allocating its result.
+template <typename T>
+auto naive_multiply(const common::math::Matrix<T>& lhs, const common::math::Matrix<T>& rhs) -> common::math::Matrix<T>
+{
+    common::math::Matrix<T> rtn(lhs._row, rhs._col);
+    for(int32_t row = 0; row < lhs._row; ++row)
+    {
+        for(int32_t col = 0; col < rhs._col; ++col)
+        {
+            T sum = lhs[row][0] * rhs[0][col];
+            for(int32_t x = 1; x < lhs._col; ++x) { sum += lhs[row][x] * rhs[x][col]; }
+            rtn[row][col] = sum;
+        }
+    }
+    return rtn;
+}
+
+// Runs action until about budget operations (counted by work per call) have passed, returns ns per call.
+template <typename Action>
+auto time(const double work, const double budget, Action&& action) -> double
+{
+    const size_t count = std::max<size_t>(1, static_cast<size_t>(budget / work));
+    double total = 0;
+    const auto start = Clock::now();
+    for(size_t i = 0; i < count; ++i) { total += action(); }
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    if(total == 12345.678) { std::cout << ""; }
+    return elapsed / count;
+}
+
+template <typename T>
+auto sweep(const std::string& type, const int32_t maxSize, const double budget) -> void
+{
+    using common::math::Matrix;
+    namespace kernel = common::math::kernel;
+    const char* names[] = {"scalar", "sse2", "avx2"};
+
+    std::cout << std::endl << type << " GFLOP/s of multiply, GB/s of add, scale and transpose" << std::endl;
+    std::cout << std::setw(6) << "size" << std::setw(8) << "isa" << std::setw(10) << "naive*" << std::setw(10) << "multiply"
+              << std::setw(10) << "add" << std::setw(10) << "scale" << std::setw(10) << "transpose" << std::endl;
+
+    for(int32_t size = 3; size <= maxSize; size = (size < 8) ? size + 1 : size * 2)
+    {
+        Matrix<T> lhs(size, size);
+        Matrix<T> rhs(size, size);
+        lhs.traversal([&lhs](const int32_t row, const int32_t col) { lhs[row][col] = static_cast<T>((row + col) % 7) / 7; });
+        rhs.traversal([&rhs](const int32_t row, const int32_t col) { rhs[row][col] = static_cast<T>((row * col) % 5) / 5; });
+
+        const double flops = 2.0 * size * size * size;
+        const double bytes = 3.0 * size * size * sizeof(T);
+        const double naive = time(flops, budget, [&](){ return naive_multiply(lhs, rhs)[size - 1][size - 1]; });
+
+        for(uint8_t isa = 0; isa <= static_cast<uint8_t>(kernel::get_supported_isa()); ++isa)
+        {
+            kernel::set_isa(static_cast<kernel::Isa>(isa));
+            const double multiply = time(flops, budget, [&](){ return (lhs * rhs)[size - 1][size - 1]; });
+            const double add = time(bytes, budget, [&](){ return (lhs + rhs)[size - 1][size - 1]; });
+            const double scale = time(bytes, budget, [&](){ return (lhs * static_cast<T>(2))[size - 1][size - 1]; });
+            const double transpose = time(bytes, budget, [&](){ return lhs.transpose()[size - 1][0]; });
+
+            std::cout << std::fixed << std::setprecision(2)
+                      << std::setw(6) << size << std::setw(8) << names[isa] << std::setw(10) << (isa == 0 ? flops / naive : 0.0)
+                      << std::setw(10) << flops / multiply << std::setw(10) << bytes / add
+                      << std::setw(10) << bytes / scale << std::setw(10) << bytes * 2 / 3 / transpose << std::endl;
+        }
+        kernel::set_isa(kernel::get_supported_isa());
+    }
+}
+} // namespace
+
+// usage: bench_Matrix [count] [max size]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    const size_t count = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 1000000;
+    const int32_t maxSize = argc > 2 ? std::atoi(argv[2]) : 512;
+    run<3>(count);
+    run<4>(count);
+    run<6>(count);
+
+    // naive* is the former triple loop, listed once per size
+    sweep<float>("float", maxSize, 2e8);
+    sweep<double>("double", maxSize, 2e8);
+    return 0;
+}
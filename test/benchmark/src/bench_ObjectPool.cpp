@@ -0,0 +1,194 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+// operator new and delete are replaced below by malloc and free, which GCC flags once they are inlined
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+#include "common/communication/Event.hpp"
+#include "common/container/Arena.hpp"
+#include "common/container/ObjectPool.hpp"
+#include "common/thread/Runnable.hpp"
+#include "common/thread/TaskExecutor.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Object
+{
+    int64_t _values[8];
+};
+
+using Clock = std::chrono::steady_clock;
+
+std::atomic<size_t> __allocations{0};
+Object* volatile __sink = nullptr;     /* keeps allocations from being optimized out */
+
+
+// Reports time and global heap allocations per operation, settle() waits for asynchronous work.
+template <typename Operation, typename Settle>
+auto measure(const std::string& name, const size_t count, Operation&& operation, Settle&& settle) -> void
+{
+    operation(0);
+    settle();
+    const size_t allocations = __allocations.load();
+    const auto start = Clock::now();
+    for(size_t i = 0; i < count; ++i) { operation(i); }
+    settle();
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    std::cout << name << " : " << elapsed / count << " ns/op, "
+              << static_cast<double>(__allocations.load() - allocations) / count << " allocations/op" << std::endl;
+}
+
+template <typename Operation>
+auto measure(const std::string& name, const size_t count, Operation&& operation) -> void
+{
+    measure(name, count, std::forward<Operation>(operation), [](){});
+}
+
+class Worker : public common::ActiveRunnable<int32_t, void>
+{
+public :
+    std::atomic<size_t> _done{0};
+    using ActiveRunnable::ActiveRunnable;
+    auto __work(int32_t&&) -> void override { _done.fetch_add(1); }
+};
+
+auto run_executor(const std::string& name, const size_t count, std::pmr::memory_resource* resource) -> void
+{
+    auto executor = common::TaskExecutor::create(2, resource);
+    std::atomic<size_t> done{0};
+    size_t expected = 0;
+    const auto settle = [&](){ while(done.load() != expected) { std::this_thread::yield(); } };
+
+    measure(name + " TaskExecutor::load", count, [&](size_t){
+        ++expected;
+        executor->load<void>([&done](){ done.fetch_add(1); });
+    }, settle);
+    measure(name + " TaskExecutor::post", count, [&](size_t){
+        ++expected;
+        executor->post([&done](){ done.fetch_add(1); });
+    }, settle);
+    executor->stop();
+}
+
+auto run_runnable(const std::string& name, const size_t count, std::pmr::memory_resource* resource) -> void
+{
+    Worker worker(resource);
+    auto future = worker.run();
+    size_t expected = 0;
+    measure(name + " ActiveRunnable::notify", count, [&](size_t i){
+        ++expected;
+        worker.notify(static_cast<int32_t>(i));
+    }, [&](){ while(worker._done.load() != expected) { std::this_thread::yield(); } });
+    worker.stop();
+    future.wait();
+}
+
+auto run_event(const std::string& name, const size_t count, std::pmr::memory_resource* resource) -> void
+{
+    common::EventBus bus(2, resource);
+    std::atomic<size_t> received{0};
+    for(int32_t i = 0; i < 4; ++i) { bus.subscribe("topic", [&received](const common::EventBus::Payload&){ received.fetch_add(1); }); }
+    const common::EventBus::Payload payload(256, 0);
+    size_t expected = 0;
+    measure(name + " EventBus::publish x4", count, [&](size_t){
+        expected += 4;
+        bus.publish("topic", payload);
+    }, [&](){ while(received.load() != expected) { std::this_thread::yield(); } });
+    measure(name + " EventBus::subscribe", 1000, [&](size_t){ bus.subscribe("other", [](const common::EventBus::Payload&){}); });
+    bus.finalize();
+}
+} // namespace
+
+// Counts the heap allocations of the measured operations.
+auto operator new(size_t size) -> void*
+{
+    __allocations.fetch_add(1, std::memory_order_relaxed);
+    if(void* memory = std::malloc(size != 0 ? size : 1)) { return memory; }
+    throw std::bad_alloc();
+}
+
+auto operator new(size_t size, std::align_val_t alignment) -> void*
+{
+    __allocations.fetch_add(1, std::memory_order_relaxed);
+    const size_t align = static_cast<size_t>(alignment);
+    if(void* memory = std::aligned_alloc(align, (size + align - 1) / align * align)) { return memory; }
+    throw std::bad_alloc();
+}
+
+auto operator delete(void* memory) noexcept -> void { std::free(memory); }
+auto operator delete(void* memory, size_t) noexcept -> void { std::free(memory); }
+auto operator delete(void* memory, std::align_val_t) noexcept -> void { std::free(memory); }
+auto operator delete(void* memory, size_t, std::align_val_t) noexcept -> void { std::free(memory); }
+
+// usage: bench_ObjectPool [count]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    const size_t count = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 1000000;
+
+    measure("new/delete             ", count, [](size_t i){
+        __sink = new Object{{static_cast<int64_t>(i)}};
+        delete __sink;
+    });
+    measure("ObjectPool::make_unique", count, [](size_t i){
+        auto object = common::ObjectPool<Object>::make_unique(Object{{static_cast<int64_t>(i)}});
+        __sink = object.get();
+    });
+    common::Arena arena;
+    measure("Arena, reset every 1000", count, [&arena](size_t i){
+        __sink = new (arena.allocate(sizeof(Object), alignof(Object))) Object{{static_cast<int64_t>(i)}};
+        if(i % 1000 == 999) { arena.reset(); }
+    });
+
+    std::vector<Object*> objects(1000);
+    measure("new x1000, delete x1000", count / 1000, [&objects](size_t){
+        for(auto& object : objects) { __sink = object = new Object(); }
+        for(auto* object : objects) { delete object; }
+    });
+    std::vector<common::ObjectPool<Object>::Pointer> pooled(1000);
+    measure("pool x1000, free x1000 ", count / 1000, [&pooled](size_t){
+        for(auto& object : pooled) { object = common::ObjectPool<Object>::make_unique(); __sink = object.get(); }
+        for(auto& object : pooled) { object.reset(); }
+    });
+
+    const size_t tasks = count / 10;
+    run_executor("heap", tasks, std::pmr::new_delete_resource());
+    run_executor("pool", tasks, common::PoolResource::get());
+    run_runnable("heap", tasks, std::pmr::new_delete_resource());
+    run_runnable("pool", tasks, common::PoolResource::get());
+    run_event("heap", tasks, std::pmr::new_delete_resource());
+    run_event("pool", tasks, common::PoolResource::get());
+    return 0;
+}
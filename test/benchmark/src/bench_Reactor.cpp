@@ -0,0 +1,161 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/communication/Reactor.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+auto connect_to(const int32_t port) -> int32_t
+{
+    const int32_t fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addrIn{};
+    addrIn.sin_family = AF_INET;
+    addrIn.sin_port = htons(static_cast<uint16_t>(port));
+    inet_pton(AF_INET, "127.0.0.1", &addrIn.sin_addr);
+    if(::connect(fd, reinterpret_cast<sockaddr*>(&addrIn), sizeof(addrIn)) < 0)
+    {
+        ::close(fd);
+        return -1;
+    }
+    int32_t opt = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+    return fd;
+}
+
+auto read_exact(const int32_t fd, char* buffer, const size_t size) -> bool
+{
+    size_t readSize = 0;
+    while(readSize < size)
+    {
+        const ssize_t rtn = ::read(fd, buffer + readSize, size - readSize);
+        if(rtn <= 0) { return false; }
+        readSize += static_cast<size_t>(rtn);
+    }
+    return true;
+}
+
+auto seconds_since(const Clock::time_point& start) -> double
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+} // namespace
+
+// usage: bench_Reactor [clients] [messages per client] [message size] [executor threads]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    const int32_t clients = argc > 1 ? std::atoi(argv[1]) : 64;
+    const int32_t messages = argc > 2 ? std::atoi(argv[2]) : 2000;
+    const size_t messageSize = argc > 3 ? static_cast<size_t>(std::atoi(argv[3])) : 64;
+    const uint32_t threads = argc > 4 ? static_cast<uint32_t>(std::atoi(argv[4])) : 4;
+
+    auto executor = common::TaskExecutor::create(threads);
+    auto reactor = common::Reactor::create(executor);
+    auto reactorFuture = reactor->run();
+
+    auto server = common::StreamServer::create(reactor);
+    server->on_readable([](const std::shared_ptr<common::Connection>& connection){
+        std::array<char, 16384> buffer;
+        size_t readSize = 0;
+        while((readSize = connection->read(buffer.data(), buffer.size())) > 0)
+        {
+            connection->send(buffer.data(), readSize);
+        }
+    });
+    server->prepare("127.0.0.1", 0);
+    server->open();
+    const int32_t port = server->get_port();
+
+    // connections/sec : connect and close sequentially from every client thread
+    {
+        constexpr int32_t connectsPerClient = 100;
+        std::atomic<int32_t> succeeded{0};
+        std::vector<std::thread> workers;
+        const auto start = Clock::now();
+        for(int32_t c = 0; c < clients; ++c)
+        {
+            workers.emplace_back([port, &succeeded](){
+                for(int32_t i = 0; i < connectsPerClient; ++i)
+                {
+                    const int32_t fd = connect_to(port);
+                    if(fd < 0) { continue; }
+                    succeeded.fetch_add(1);
+                    ::close(fd);
+                }
+            });
+        }
+        for(auto& worker : workers) { worker.join(); }
+        const double elapsed = seconds_since(start);
+        std::cout << "connections     : " << succeeded.load() << " in " << elapsed << " s ("
+                  << static_cast<uint64_t>(succeeded.load() / elapsed) << " conn/s)" << std::endl;
+    }
+
+    // messages/sec : every client keeps one connection and echoes fixed size messages
+    {
+        std::atomic<int64_t> echoed{0};
+        std::vector<std::thread> workers;
+        const auto start = Clock::now();
+        for(int32_t c = 0; c < clients; ++c)
+        {
+            workers.emplace_back([port, messages, messageSize, &echoed](){
+                const int32_t fd = connect_to(port);
+                if(fd < 0) { return; }
+                std::vector<char> message(messageSize, 'x');
+                std::vector<char> reply(messageSize);
+                for(int32_t i = 0; i < messages; ++i)
+                {
+                    if(::send(fd, message.data(), message.size(), MSG_NOSIGNAL) < 0) { break; }
+                    if(!read_exact(fd, reply.data(), reply.size())) { break; }
+                    echoed.fetch_add(1);
+                }
+                ::close(fd);
+            });
+        }
+        for(auto& worker : workers) { worker.join(); }
+        const double elapsed = seconds_since(start);
+        std::cout << "messages        : " << echoed.load() << " x " << messageSize << " bytes in " << elapsed << " s ("
+                  << static_cast<uint64_t>(echoed.load() / elapsed) << " msg/s)" << std::endl;
+    }
+
+    server->close();
+    reactor->stop();
+    reactorFuture.wait();
+    executor->stop();
+    return 0;
+}
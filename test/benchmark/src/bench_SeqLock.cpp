@@ -0,0 +1,182 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/container/DoublingBuffer.hpp"
+#include "common/container/SeqLock.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct Imu
+{
+    double _acceleration[3];
+    double _rate[3];
+    uint64_t _stamp;
+};
+
+struct Pose
+{
+    double _position[3];
+    double _orientation[4];
+    double _covariance[36];
+};
+
+template <typename T>
+class MutexCell
+{
+private :
+    mutable std::mutex _lock;
+    T _value{};
+
+public :
+    auto store(const T& value) -> void
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _value = value;
+    }
+    auto load() const -> T
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        return _value;
+    }
+};
+
+// Keeps only the newest value in a DoublingBuffer, as the state topics did before.
+template <typename T>
+class BufferCell
+{
+private :
+    common::DoublingBuffer<T> _buffer;
+
+public :
+    auto store(const T& value) -> void
+    {
+        auto transaction = _buffer.transaction();
+        if(!transaction.update(0, value)) { transaction.push(value); }
+        transaction.commit();
+    }
+    auto load() -> T { return _buffer.get_buffer()->at(0); }
+};
+
+template <typename Action>
+auto measure(const std::string& name, const size_t count, Action&& action) -> void
+{
+    double total = 0;
+    const auto start = Clock::now();
+    for(size_t i = 0; i < count; ++i) { total += action(i); }
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    std::cout << name << " : " << elapsed / count << " ns/op (checksum " << total << ")" << std::endl;
+}
+
+template <typename T, typename Cell>
+auto run(const std::string& name, const size_t count, Cell& cell) -> void
+{
+    T value{};
+    measure(name + " store", count, [&](size_t i){
+        value._position[0] = static_cast<double>(i);
+        cell.store(value);
+        return 0.0;
+    });
+    measure(name + " load ", count, [&](size_t){ return cell.load()._position[0]; });
+}
+// One writer storing and two readers loading as fast as they can for the given time.
+template <typename T, typename Cell>
+auto contend(const std::string& name, const std::chrono::milliseconds duration, Cell& cell) -> void
+{
+    std::atomic<bool> running{true};
+    std::atomic<uint64_t> reads{0};
+    uint64_t writes = 0;
+    std::vector<std::thread> readers;
+    for(int32_t i = 0; i < 2; ++i)
+    {
+        readers.emplace_back([&](){
+            uint64_t count = 0;
+            double sum = 0;
+            while(running.load(std::memory_order_relaxed))
+            {
+                sum += cell.load()._position[0];
+                ++count;
+            }
+            reads.fetch_add(count + (sum < 0 ? 1 : 0));
+        });
+    }
+
+    T value{};
+    const auto end = Clock::now() + duration;
+    while(Clock::now() < end)
+    {
+        for(int32_t i = 0; i < 64; ++i)
+        {
+            value._position[0] = static_cast<double>(++writes);
+            cell.store(value);
+        }
+    }
+    running.store(false);
+    for(auto& reader : readers) { reader.join(); }
+
+    const double seconds = std::chrono::duration<double>(duration).count();
+    std::cout << name << " contended : " << writes / seconds / 1e6 << " M stores/s, "
+              << reads.load() / seconds / 1e6 << " M loads/s" << std::endl;
+}
+} // namespace
+
+// usage: bench_SeqLock [count]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    const size_t count = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 1000000;
+
+    {
+        common::SeqLock<Pose> seqLock;
+        common::LatestValue<Pose> latest;
+        MutexCell<Pose> mutex;
+        BufferCell<Pose> buffer;
+        run<Pose>("Pose SeqLock       ", count, seqLock);
+        run<Pose>("Pose LatestValue   ", count, latest);
+        run<Pose>("Pose mutex         ", count, mutex);
+        run<Pose>("Pose DoublingBuffer", count, buffer);
+
+        const std::chrono::milliseconds duration(500);
+        contend<Pose>("Pose SeqLock       ", duration, seqLock);
+        contend<Pose>("Pose LatestValue   ", duration, latest);
+        contend<Pose>("Pose mutex         ", duration, mutex);
+    }
+
+    common::SeqLock<Imu> imu;
+    MutexCell<Imu> imuMutex;
+    measure("Imu SeqLock store", count, [&](size_t i){ imu.store(Imu{{static_cast<double>(i)}, {}, i}); return 0.0; });
+    measure("Imu SeqLock load ", count, [&](size_t){ return imu.load()._acceleration[0]; });
+    measure("Imu mutex store  ", count, [&](size_t i){ imuMutex.store(Imu{{static_cast<double>(i)}, {}, i}); return 0.0; });
+    measure("Imu mutex load   ", count, [&](size_t){ return imuMutex.load()._acceleration[0]; });
+    return 0;
+}
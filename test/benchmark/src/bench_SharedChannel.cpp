@@ -0,0 +1,115 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/communication/Message.hpp"
+#include "common/communication/SharedChannel.hpp"
+
+#include <sys/wait.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct Sample
+{
+    uint64_t _sequence;
+    double _values[7];
+};
+
+// Runs send(i) for every message in each producer process and recv() in this one.
+template <typename Send, typename Recv>
+auto run(const std::string& name, const size_t messages, const size_t producers, Send&& send, Recv&& recv) -> void
+{
+    const size_t perProducer = messages / producers;
+    std::vector<pid_t> children;
+    const auto start = Clock::now();
+    for(size_t p = 0; p < producers; ++p)
+    {
+        const pid_t pid = ::fork();
+        if(pid == 0)
+        {
+            send(perProducer);
+            ::_exit(0);
+        }
+        children.push_back(pid);
+    }
+
+    uint64_t checksum = 0;
+    for(size_t i = 0; i < perProducer * producers; ++i) { checksum += recv()._sequence; }
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    for(const pid_t pid : children) { ::waitpid(pid, nullptr, 0); }
+
+    const size_t received = perProducer * producers;
+    std::cout << name << " : " << received << " x " << sizeof(Sample) << " bytes from " << producers
+              << " process(es) in " << elapsed << " s (" << static_cast<uint64_t>(received / elapsed)
+              << " msg/s, checksum " << checksum << ")" << std::endl;
+}
+} // namespace
+
+// usage: bench_SharedChannel [messages] [producers] [capacity]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    const size_t messages = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 1000000;
+    const size_t producers = argc > 2 ? static_cast<size_t>(std::max(1, std::atoi(argv[2]))) : 2;
+    const uint32_t capacity = argc > 3 ? static_cast<uint32_t>(std::atoi(argv[3])) : 4096;
+
+    {
+        auto message = common::Message<Sample>::create(std::string(argv[0]), 'B');
+        run("Message              ", messages, 1,
+            [&message](const size_t count){ for(size_t i = 0; i < count; ++i) { message->send(Sample{i, {}}); } },
+            [&message](){ return message->recv(); });
+        message->close();
+    }
+    {
+        ::shm_unlink("/bench_SharedChannel_spsc");
+        auto channel = common::SharedChannel<Sample>::create("bench_SharedChannel_spsc", capacity);
+        run("SharedChannel (SPSC) ", messages, 1,
+            [capacity](const size_t count){
+                auto child = common::SharedChannel<Sample>::create("bench_SharedChannel_spsc", capacity);
+                for(size_t i = 0; i < count; ++i) { child->send(Sample{i, {}}); }
+            },
+            [&channel](){ return channel->recv(); });
+        channel->close();
+    }
+    {
+        using Channel = common::SharedChannel<Sample, common::ChannelMode::MPSC>;
+        ::shm_unlink("/bench_SharedChannel_mpsc");
+        auto channel = Channel::create("bench_SharedChannel_mpsc", capacity);
+        run("SharedChannel (MPSC) ", messages, producers,
+            [capacity](const size_t count){
+                auto child = Channel::create("bench_SharedChannel_mpsc", capacity);
+                for(size_t i = 0; i < count; ++i) { child->send(Sample{i, {}}); }
+            },
+            [&channel](){ return channel->recv(); });
+        channel->close();
+    }
+    return 0;
+}
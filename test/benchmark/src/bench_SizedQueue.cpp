@@ -0,0 +1,100 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/container/SizedQueue.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+constexpr size_t WINDOW = 1000;
+constexpr size_t SUM_EVERY = 64;
+
+// The former std::queue based implementation, iterated through its deque for the sums.
+class DequeWindow
+{
+private :
+    std::deque<int32_t> _q;
+
+public :
+    auto push_back(int32_t value) -> void
+    {
+        if(_q.size() == WINDOW) { _q.pop_front(); }
+        _q.push_back(value);
+    }
+
+    auto sum() const -> int64_t
+    {
+        int64_t sum = 0;
+        for(const int32_t value : _q) { sum += value; }
+        return sum;
+    }
+};
+
+// Pushes every sample and sums the window every sumEvery samples, 0 to never sum.
+template <typename Window, typename Sum>
+auto measure(const std::string& name, const size_t samples, const size_t sumEvery, Window& window, Sum&& sum) -> void
+{
+    int64_t total = 0;
+    const auto start = Clock::now();
+    for(size_t i = 0; i < samples; ++i)
+    {
+        window.push_back(static_cast<int32_t>(i & 0xFF));
+        if(sumEvery != 0 && i % sumEvery == 0) { total += sum(window); }
+    }
+    const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    std::cout << name << " : " << elapsed / samples << " ns/sample (checksum " << total << ")" << std::endl;
+}
+} // namespace
+
+// usage: bench_SizedQueue [samples]
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    const size_t samples = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 10000000;
+
+    using Ring = common::SizedQueue<int32_t, WINDOW>;
+    const auto dequeSum = [](const DequeWindow& window){ return window.sum(); };
+    const auto ringSum = [](const Ring& window){
+        int64_t sum = 0;
+        for(const auto& [data, size] : window.spans())
+        {
+            for(size_t i = 0; i < size; ++i) { sum += data[i]; }
+        }
+        return sum;
+    };
+
+    DequeWindow deque;
+    auto ring = std::make_unique<Ring>();
+    measure("push    std::deque ", samples, 0, deque, dequeSum);
+    measure("push    SizedQueue ", samples, 0, *ring, ringSum);
+    measure("push+sum std::deque", samples, SUM_EVERY, deque, dequeSum);
+    measure("push+sum SizedQueue", samples, SUM_EVERY, *ring, ringSum);
+    return 0;
+}
@@ -34,10 +34,14 @@ class MockSerial : public Serial
 {
 public:
     MOCK_METHOD(bool, open, (const std::string&, const Baudrate, const uint8_t), (override, noexcept));
+    MOCK_METHOD(bool, open, (const std::string&, const Baudrate, const uint8_t, const SerialOptions&), (override, noexcept));
     MOCK_METHOD(void, close, (), (override, noexcept));
     MOCK_METHOD(bool, is_open, (), (override, noexcept));
     MOCK_METHOD(bool, read, (char*, size_t), (override, noexcept));
     MOCK_METHOD(std::string, readline, (EscapeSequence::type), (override, noexcept));
     MOCK_METHOD(bool, write, (const char*, const size_t), (override, noexcept));
+#if defined(LINUX)
+    MOCK_METHOD(int32_t, get_native_handle, (), (const, override, noexcept));
+#endif
 };
 } // namespace common::mock
\ No newline at end of file
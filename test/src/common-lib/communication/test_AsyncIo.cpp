@@ -0,0 +1,183 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include <gtest/gtest.h>
+
+#include "common/communication/AsyncIo.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <unistd.h>
+#include <sys/socket.h>
+
+namespace common::test
+{
+class test_AsyncIo : public ::testing::TestWithParam<IoBackend::type>
+{
+protected :
+    std::shared_ptr<AsyncIo> _io;
+    std::array<int32_t, 2> _fds{-1, -1};
+
+protected :
+    auto SetUp() -> void override
+    {
+        _io = AsyncIo::create(GetParam());
+        if(!_io) { GTEST_SKIP() << "backend is not available"; }
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, _fds.data()), 0);
+    }
+
+    auto TearDown() -> void override
+    {
+        if(_fds[0] >= 0) { ::close(_fds[0]); }
+        if(_fds[1] >= 0) { ::close(_fds[1]); }
+    }
+
+    auto wait(const std::function<bool()>& done) -> bool
+    {
+        for(int32_t i = 0; i < 100 && !done(); ++i) { _io->poll(std::chrono::milliseconds(10)); }
+        return done();
+    }
+};
+
+TEST_P(test_AsyncIo, read_write)
+{
+    // given
+    const std::string message("hello async io");
+    std::array<char, 64> buffer{};
+    int32_t written = 0;
+    int32_t read = 0;
+
+    // when
+    ASSERT_TRUE(_io->write(_fds[0], message.data(), message.size(), [&written](const int32_t result){ written = result; }));
+    ASSERT_TRUE(_io->read(_fds[1], buffer.data(), buffer.size(), [&read](const int32_t result){ read = result; }));
+    ASSERT_EQ(_io->get_pending(), 2U);
+
+    // then
+    ASSERT_TRUE(wait([&](){ return written != 0 && read != 0; }));
+    ASSERT_EQ(written, static_cast<int32_t>(message.size()));
+    ASSERT_EQ(read, static_cast<int32_t>(message.size()));
+    ASSERT_EQ(std::string(buffer.data(), read), message);
+    ASSERT_EQ(_io->get_pending(), 0U);
+}
+
+TEST_P(test_AsyncIo, fixed_buffers_and_files)
+{
+    // given
+    std::array<char, 32> source{};
+    std::array<char, 32> destination{};
+    std::string("registered").copy(source.data(), source.size());
+    std::array<iovec, 2> buffers{iovec{source.data(), source.size()}, iovec{destination.data(), destination.size()}};
+    ASSERT_TRUE(_io->register_buffers(buffers.data(), buffers.size()));
+    ASSERT_TRUE(_io->register_files(_fds.data(), _fds.size()));
+    int32_t written = 0;
+    int32_t read = 0;
+
+    // when
+    ASSERT_TRUE(_io->write_fixed(_fds[0], 0, 0, 10, [&written](const int32_t result){ written = result; }));
+    ASSERT_TRUE(_io->read_fixed(_fds[1], 1, 4, 16, [&read](const int32_t result){ read = result; }));
+
+    // then
+    ASSERT_TRUE(wait([&](){ return written != 0 && read != 0; }));
+    ASSERT_EQ(written, 10);
+    ASSERT_EQ(read, 10);
+    ASSERT_EQ(std::string(destination.data() + 4, read), "registered");
+    ASSERT_FALSE(_io->read_fixed(_fds[1], 1, 30, 16, nullptr));
+}
+
+TEST_P(test_AsyncIo, recv_multishot)
+{
+    // given
+    std::string received;
+    int32_t finished = 1;
+    ASSERT_TRUE(_io->recv_multishot(_fds[1], 8, 2, [&](const uint8_t* data, const int32_t result){
+        if(result > 0) { received.append(reinterpret_cast<const char*>(data), result); }
+        else { finished = result; }
+    }));
+    _io->submit();
+
+    // when
+    const std::string message("multishot receive delivers every chunk");
+    for(size_t i = 0; i < message.size(); i += 5)
+    {
+        const size_t size = std::min<size_t>(5, message.size() - i);
+        ASSERT_EQ(::write(_fds[0], message.data() + i, size), static_cast<ssize_t>(size));
+        _io->poll(std::chrono::milliseconds(10));
+    }
+
+    // then
+    ASSERT_TRUE(wait([&](){ return received.size() == message.size(); }));
+    ASSERT_EQ(received, message);
+
+    ::close(_fds[0]);
+    _fds[0] = -1;
+    ASSERT_TRUE(wait([&](){ return finished <= 0; }));
+    ASSERT_EQ(finished, 0);
+    ASSERT_EQ(_io->get_pending(), 0U);
+}
+
+TEST_P(test_AsyncIo, cancel)
+{
+    // given
+    std::array<char, 16> buffer{};
+    int32_t read = 0;
+    ASSERT_TRUE(_io->read(_fds[1], buffer.data(), buffer.size(), [&read](const int32_t result){ read = result; }));
+    _io->poll();
+
+    // when
+    ASSERT_TRUE(_io->cancel(_fds[1]));
+
+    // then
+    ASSERT_TRUE(wait([&](){ return read != 0; }));
+    ASSERT_EQ(read, -ECANCELED);
+}
+
+TEST_P(test_AsyncIo, cancelAll)
+{
+    // given
+    std::array<std::array<char, 16>, 4> buffers{};
+    std::array<int32_t, 4> reads{};
+    for(size_t i = 0; i < buffers.size(); ++i)
+    {
+        ASSERT_TRUE(_io->read(_fds[1], buffers[i].data(), buffers[i].size(), [&reads, i](const int32_t result){ reads[i] = result; }));
+    }
+    _io->poll();
+
+    // when
+    ASSERT_TRUE(_io->cancel(_fds[1]));
+
+    // then
+    ASSERT_TRUE(wait([&](){ return std::all_of(reads.begin(), reads.end(), [](const int32_t read){ return read != 0; }); }));
+    for(const auto read : reads) { ASSERT_EQ(read, -ECANCELED); }
+    ASSERT_EQ(_io->get_pending(), 0U);
+}
+
+INSTANTIATE_TEST_SUITE_P(backend,
+                         test_AsyncIo,
+                         ::testing::Values(IoBackend::IO_URING, IoBackend::EPOLL));
+} // namespace common::test
+
+#endif
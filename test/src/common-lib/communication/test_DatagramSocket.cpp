@@ -0,0 +1,181 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include <gtest/gtest.h>
+
+#include "common/communication/DatagramSocket.hpp"
+#include "common/Exception.hpp"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace common::test
+{
+TEST(test_DatagramSocket, batch_unicast)
+{
+    // given
+    auto receiver = DatagramSocket::create(SocketType::UDP);
+    receiver->prepare("127.0.0.1", 0);
+    receiver->set_receive_buffer(1024 * 1024);
+    ASSERT_TRUE(receiver->set_timestamp(true));
+    receiver->open();
+
+    auto sender = DatagramSocket::create(SocketType::UDP);
+    sender->prepare("127.0.0.1", 0);
+    sender->open();
+    sender->set_destination("127.0.0.1", receiver->get_port());
+
+    std::vector<std::string> messages;
+    std::vector<iovec> datagrams;
+    for(int32_t i = 0; i < 32; ++i) { messages.push_back("datagram " + std::to_string(i)); }
+    for(auto& message : messages) { datagrams.push_back(iovec{message.data(), message.size()}); }
+
+    // when
+    const auto before = std::chrono::system_clock::now().time_since_epoch();
+    const size_t sent = sender->send_batch(datagrams.data(), datagrams.size());
+
+    DatagramBatch batch(64, 1500);
+    std::vector<std::string> received;
+    while(received.size() < sent && receiver->recv_batch(batch, 1000) > 0)
+    {
+        for(size_t i = 0; i < batch.size(); ++i)
+        {
+            received.emplace_back(reinterpret_cast<const char*>(batch.data(i)), batch.length(i));
+        }
+    }
+
+    // then
+    EXPECT_EQ(sent, messages.size());
+    EXPECT_EQ(received, messages);
+    EXPECT_EQ(ntohs(batch.source(0).sin_port), sender->get_port());
+    EXPECT_GE(batch.timestamp(0), static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(before).count()));
+    EXPECT_EQ(DatagramSocket::create(SocketType::CLIENT), nullptr);
+    EXPECT_EQ(Socket::create(SocketType::UDP), nullptr);
+}
+
+TEST(test_DatagramSocket, segmented_send)
+{
+    // given
+    auto receiver = DatagramSocket::create(SocketType::UDP);
+    receiver->prepare("127.0.0.1", 0);
+    receiver->open();
+
+    auto sender = DatagramSocket::create(SocketType::UDP);
+    sender->prepare("127.0.0.1", 0);
+    sender->open();
+    sender->set_destination("127.0.0.1", receiver->get_port());
+
+    std::string payload;
+    for(int32_t i = 0; i < 10; ++i) { payload += std::string(100, static_cast<char>('a' + i)); }
+
+    // when
+    sender->send_segmented(payload.data(), payload.size(), 100);
+
+    DatagramBatch batch(16, 1500);
+    std::vector<std::string> received;
+    while(received.size() < 10 && receiver->recv_batch(batch, 1000) > 0)
+    {
+        for(size_t i = 0; i < batch.size(); ++i)
+        {
+            received.emplace_back(reinterpret_cast<const char*>(batch.data(i)), batch.length(i));
+        }
+    }
+
+    // then
+    ASSERT_EQ(received.size(), 10U);
+    EXPECT_EQ(received[0], std::string(100, 'a'));
+    EXPECT_EQ(received[9], std::string(100, 'j'));
+}
+
+TEST(test_DatagramSocket, segmented_send_over_gso_limit)
+{
+    // given
+    auto receiver = DatagramSocket::create(SocketType::UDP);
+    receiver->prepare("127.0.0.1", 0);
+    receiver->open();
+
+    auto sender = DatagramSocket::create(SocketType::UDP);
+    sender->prepare("127.0.0.1", 0);
+    sender->open();
+    sender->set_destination("127.0.0.1", receiver->get_port());
+
+    std::string payload;
+    for(int32_t i = 0; i < 150; ++i) { payload += std::string(100, static_cast<char>('a' + i % 26)); }
+    payload += "tail";
+
+    // when
+    EXPECT_THROW(sender->send_segmented(payload.data(), payload.size(), 0), CommunicationException);
+    sender->send_segmented(payload.data(), payload.size(), 100);
+
+    DatagramBatch batch(64, 1500);
+    std::vector<std::string> received;
+    while(received.size() < 151 && receiver->recv_batch(batch, 1000) > 0)
+    {
+        for(size_t i = 0; i < batch.size(); ++i)
+        {
+            received.emplace_back(reinterpret_cast<const char*>(batch.data(i)), batch.length(i));
+        }
+    }
+
+    // then
+    ASSERT_EQ(received.size(), 151U);
+    EXPECT_EQ(received[64], std::string(100, 'm'));
+    EXPECT_EQ(received[149], std::string(100, 't'));
+    EXPECT_EQ(received[150], "tail");
+}
+
+TEST(test_DatagramSocket, multicast)
+{
+    // given
+    auto receiver = DatagramSocket::create(SocketType::MULTICAST);
+    receiver->prepare("239.255.0.1", 0);
+    receiver->set_multicast_interface("127.0.0.1");
+    try { receiver->open(); }
+    catch(const CommunicationException&) { GTEST_SKIP() << "multicast is not available"; }
+
+    auto sender = DatagramSocket::create(SocketType::UDP);
+    sender->prepare("127.0.0.1", 0);
+    sender->open();
+    ASSERT_TRUE(sender->set_multicast_interface("127.0.0.1"));
+    ASSERT_TRUE(sender->set_multicast_loop(true));
+    ASSERT_TRUE(sender->set_multicast_ttl(1));
+    sender->set_destination("239.255.0.1", receiver->get_port());
+
+    // when
+    const std::string message("fan-out");
+    sender->send(message.data(), message.size());
+
+    DatagramBatch batch(4, 1500);
+    const size_t count = receiver->recv_batch(batch, 1000);
+
+    // then
+    ASSERT_EQ(count, 1U);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(batch.data(0)), batch.length(0)), message);
+}
+} // namespace common::test
+
+#endif
@@ -146,4 +146,30 @@ TEST(test_Event, multThreading)
         ASSERT_EQ(recvSizeBuffer_4[i], sendBuffer4.size());
     }
 }
+
+TEST(test_Event, throwingSubscriber)
+{
+    // given
+    EventBus bus;
+    const std::vector<uint8_t> sendBuffer{0x00, 0x01, 0x02};
+    std::atomic<int32_t> received{0};
+
+    bus.subscribe("Test", [](const std::vector<uint8_t>&){
+        throw std::runtime_error("handler failure");
+    });
+    bus.subscribe("Test", [&received](const std::vector<uint8_t>&){
+        received.fetch_add(1);
+    });
+
+    // when
+    for(int32_t i = 0; i < 10; ++i) { bus.publish("Test", sendBuffer); }
+    for(int32_t i = 0; i < 100 && received.load() < 10; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    bus.finalize();
+
+    // then
+    ASSERT_EQ(received.load(), 10);
+}
 } // common::test
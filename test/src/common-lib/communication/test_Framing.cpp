@@ -0,0 +1,176 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include <gtest/gtest.h>
+
+#include "common/communication/Framing.hpp"
+#include "common/Exception.hpp"
+#include "common/thread/Thread.hpp"
+
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+
+namespace common::test
+{
+TEST(test_Framing, length_prefix_codec)
+{
+    // given
+    auto codec = LengthPrefixCodec::create(2);
+    std::array<uint8_t, FrameCodec::MAX_HEADER_SIZE> header;
+    const std::string payload("payload");
+    std::vector<uint8_t> stream(header.begin(), header.begin() + codec->encode_header(payload.size(), header.data()));
+    stream.insert(stream.end(), payload.begin(), payload.end());
+
+    // when
+    Frame frame;
+    const size_t partial = codec->decode(stream.data(), stream.size() - 1, 1024, frame);
+    const size_t complete = codec->decode(stream.data(), stream.size(), 1024, frame);
+
+    // then
+    EXPECT_EQ(stream[0], 0);
+    EXPECT_EQ(stream[1], payload.size());
+    EXPECT_EQ(partial, 0U);
+    EXPECT_EQ(complete, stream.size());
+    EXPECT_EQ(frame.to_string(), payload);
+    EXPECT_EQ(frame.data(), stream.data() + 2);
+    EXPECT_THROW(codec->decode(stream.data(), stream.size(), 4, frame), CommunicationException);
+    EXPECT_EQ(LengthPrefixCodec::create(3), nullptr);
+}
+
+TEST(test_Framing, delimiter_codec)
+{
+    // given
+    auto codec = DelimiterCodec::create("\r\n");
+    const std::string stream("first\rsecond\r\nthird");
+    const auto* data = reinterpret_cast<const uint8_t*>(stream.data());
+
+    // when
+    Frame frame;
+    const size_t consumed = codec->decode(data, stream.size(), 1024, frame);
+    Frame incomplete;
+    const size_t rest = codec->decode(data + consumed, stream.size() - consumed, 1024, incomplete);
+
+    // then
+    EXPECT_EQ(consumed, 14U);
+    EXPECT_EQ(frame.to_string(), "first\rsecond");
+    EXPECT_EQ(rest, 0U);
+    EXPECT_THROW(codec->decode(data + consumed, stream.size() - consumed, 4, incomplete), CommunicationException);
+}
+
+TEST(test_Framing, buffer_pool)
+{
+    // given
+    auto pool = BufferPool::create(128, 1);
+
+    // when
+    auto first = pool->acquire();
+    uint8_t* address = first.get();
+    auto second = pool->acquire();
+    first.reset();
+    second.reset();
+    auto reused = pool->acquire();
+
+    // then
+    EXPECT_EQ(pool->get_block_size(), 128U);
+    EXPECT_EQ(pool->get_available(), 0U);
+    EXPECT_EQ(reused.get(), address);
+}
+
+TEST(test_Framing, framed_stream)
+{
+    // given
+    auto server = Socket::create(SocketType::SERVER);
+    auto server_future = Thread::async([&server](){
+        server->prepare("127.0.0.1", 8084);
+        server->open();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    auto client = Socket::create(SocketType::CLIENT);
+    client->prepare("127.0.0.1", 8084);
+    client->open();
+    server_future.wait();
+
+    // The receive buffer is smaller than the whole stream so that partial frames are moved to the front.
+    auto writer = FramedStream::create(client, LengthPrefixCodec::create(), BufferPool::create(16 * 1024));
+    auto reader = FramedStream::create(server, LengthPrefixCodec::create(), BufferPool::create(12 * 1024));
+    const std::string large(8 * 1024 - 16, 'L');
+
+    // when
+    for(int32_t i = 0; i < 1000; ++i)
+    {
+        const std::string message = "message " + std::to_string(i);
+        writer->write(message.data(), message.size());
+    }
+    writer->write(large.data(), large.size());
+    writer->write("tail", 4);
+    const size_t buffered = writer->get_buffered();
+    writer->flush();
+
+    std::vector<std::string> received;
+    while(received.size() < 1002)
+    {
+        reader->read([&received](const Frame& frame){ received.push_back(frame.to_string()); });
+    }
+
+    // then
+    EXPECT_EQ(buffered, 8U);
+    EXPECT_EQ(writer->get_buffered(), 0U);
+    EXPECT_EQ(received.front(), "message 0");
+    EXPECT_EQ(received[999], "message 999");
+    EXPECT_EQ(received[1000].size(), large.size());
+    EXPECT_EQ(received[1001], "tail");
+}
+
+TEST(test_Framing, framed_stream_nonblocking)
+{
+    // given
+    auto [local, remote] = Socket::create_pair();
+    const int32_t fd = local->get_native_handle();
+    ASSERT_EQ(::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK), 0);
+    auto reader = FramedStream::create(local, LengthPrefixCodec::create(), BufferPool::create(1024));
+    auto writer = FramedStream::create(remote, LengthPrefixCodec::create(), BufferPool::create(1024));
+    std::vector<std::string> received;
+    const auto handler = [&received](const Frame& frame){ received.push_back(frame.to_string()); };
+
+    // when
+    const size_t empty = reader->read(handler);
+    writer->write("after EAGAIN", 12);
+    writer->flush();
+    const size_t count = reader->read(handler);
+
+    // then
+    EXPECT_EQ(empty, 0U);
+    EXPECT_EQ(count, 1U);
+    ASSERT_EQ(received.size(), 1U);
+    EXPECT_EQ(received.front(), "after EAGAIN");
+
+    remote->close();
+    EXPECT_THROW(reader->read(handler), CommunicationException);
+}
+} // namespace common::test
+
+#endif
@@ -28,6 +28,9 @@ SOFTWARE.
 
 #include "common/communication/Message.hpp"
 
+#include <array>
+#include <chrono>
+
 namespace common::test
 {
 TEST(test_Message, create)
@@ -39,6 +42,81 @@ TEST(test_Message, create)
 
     // then
 }
+
+struct Sample
+{
+    int32_t _sequence;
+    double _value;
+};
+
+static auto create_empty_queue(const int32_t projId) -> std::shared_ptr<Message<Sample>>
+{
+    auto message = Message<Sample>::create("/tmp", projId);
+    while(message->try_recv()) {} // left over by an aborted run
+    return message;
+}
+
+TEST(test_Message, try_recv)
+{
+    // given
+    auto message = create_empty_queue('T');
+
+    // when
+    const auto empty = message->try_recv();
+    message->send(Sample{7, 0.5});
+    const auto received = message->try_recv();
+
+    // then
+    ASSERT_FALSE(empty.has_value());
+    ASSERT_TRUE(received.has_value());
+    ASSERT_EQ(received->_sequence, 7);
+    ASSERT_EQ(received->_value, 0.5);
+    ASSERT_TRUE(message->close());
+}
+
+TEST(test_Message, recv_for)
+{
+    // given
+    auto message = create_empty_queue('U');
+
+    // when
+    const auto begin = std::chrono::steady_clock::now();
+    const auto timedOut = message->recv_for(std::chrono::milliseconds(20));
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    message->send(Sample{1, 0.0});
+    const auto received = message->recv_for(std::chrono::milliseconds(20));
+
+    // then
+    ASSERT_FALSE(timedOut.has_value());
+    ASSERT_GE(elapsed, std::chrono::milliseconds(20));
+    ASSERT_TRUE(received.has_value());
+    ASSERT_EQ(received->_sequence, 1);
+    ASSERT_TRUE(message->close());
+}
+
+TEST(test_Message, batch)
+{
+    // given
+    auto message = create_empty_queue('V');
+    std::array<Sample, 10> sent;
+    for(int32_t i = 0; i < 10; ++i) { sent[i] = Sample{i, i * 0.5}; }
+
+    // when
+    const size_t sentCount = message->send_batch(sent.data(), sent.size());
+    std::array<Sample, 4> buffer;
+    const size_t first = message->recv_batch(buffer.data(), buffer.size());
+    const int32_t firstSequence = buffer[0]._sequence;
+    size_t total = first;
+    while(total < sentCount) { total += message->recv_batch(buffer.data(), buffer.size()); }
+
+    // then
+    ASSERT_EQ(sentCount, 10U);
+    ASSERT_EQ(first, 4U);
+    ASSERT_EQ(firstSequence, 0);
+    ASSERT_EQ(buffer[1]._sequence, 9); // the last batch holds 8 and 9
+    ASSERT_FALSE(message->try_recv().has_value());
+    ASSERT_TRUE(message->close());
+}
 } // namespace common::test
 
 #endif
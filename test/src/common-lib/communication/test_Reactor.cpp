@@ -0,0 +1,163 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include <gtest/gtest.h>
+
+#include "common/communication/Reactor.hpp"
+#include "common/communication/Socket.hpp"
+#include "common/thread/Thread.hpp"
+
+#include <array>
+#include <thread>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+namespace common::test
+{
+TEST(test_Reactor, dispatch)
+{
+    // given
+    auto reactor = Reactor::create();
+    ASSERT_NE(reactor, nullptr);
+    auto future = reactor->run();
+
+    const int32_t fd = eventfd(0, EFD_NONBLOCK);
+    std::promise<uint64_t> promise;
+    auto received = promise.get_future();
+    ASSERT_TRUE(reactor->add(fd, ReactorEvent::READ, [fd, &promise](const uint32_t events){
+        if((events & ReactorEvent::READ) != ReactorEvent::READ) { return; }
+        uint64_t value = 0;
+        if(::read(fd, &value, sizeof(value)) == sizeof(value)) { promise.set_value(value); }
+    }));
+
+    // when
+    const uint64_t value = 7;
+    ASSERT_EQ(::write(fd, &value, sizeof(value)), static_cast<ssize_t>(sizeof(value)));
+
+    // then
+    ASSERT_EQ(received.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    ASSERT_EQ(received.get(), value);
+
+    reactor->remove(fd);
+    reactor->stop();
+    future.wait();
+    ::close(fd);
+}
+
+TEST(test_Reactor, echo_multi_connection)
+{
+    // given
+    auto executor = TaskExecutor::create(2);
+    auto reactor = Reactor::create(executor);
+    auto reactorFuture = reactor->run();
+
+    std::atomic<int32_t> connected{0};
+    auto server = StreamServer::create(reactor);
+    server->on_connect([&connected](const std::shared_ptr<Connection>&){ connected.fetch_add(1); });
+    server->on_readable([](const std::shared_ptr<Connection>& connection){
+        std::array<char, 256> buffer;
+        size_t readSize = 0;
+        while((readSize = connection->read(buffer.data(), buffer.size())) > 0)
+        {
+            connection->send(buffer.data(), readSize);
+        }
+    });
+    server->prepare("127.0.0.1", 0);
+    server->open();
+
+    // when
+    constexpr int32_t clientCount = 8;
+    std::array<std::string, clientCount> replies;
+    std::vector<std::future<void>> futures;
+    for(int32_t i = 0; i < clientCount; ++i)
+    {
+        futures.push_back(Thread::async([i, &replies, port = server->get_port()](){
+            auto client = Socket::create(SocketType::CLIENT);
+            client->prepare("127.0.0.1", port);
+            client->open();
+
+            const std::string message("CLIENT" + std::to_string(i));
+            client->send(message.c_str(), message.size());
+
+            char buffer[32] = {0,};
+            size_t readSize = 0;
+            while(readSize < message.size())
+            {
+                readSize += client->read(buffer + readSize, sizeof(buffer) - readSize);
+            }
+            replies[i].assign(buffer, readSize);
+        }));
+    }
+    for(auto& future : futures) { future.wait(); }
+
+    // then
+    for(int32_t i = 0; i < clientCount; ++i)
+    {
+        ASSERT_EQ(replies[i], "CLIENT" + std::to_string(i));
+    }
+    ASSERT_EQ(connected.load(), clientCount);
+
+    server->close();
+    reactor->stop();
+    reactorFuture.wait();
+    executor->stop();
+}
+TEST(test_Reactor, user_close_releases_connection)
+{
+    // given
+    auto reactor = Reactor::create();
+    auto reactorFuture = reactor->run();
+
+    std::promise<void> disconnected;
+    auto server = StreamServer::create(reactor);
+    server->on_readable([](const std::shared_ptr<Connection>& connection){
+        std::array<char, 16> buffer;
+        while(connection->read(buffer.data(), buffer.size()) > 0) {}
+        connection->close();
+    });
+    server->on_disconnect([&disconnected](const std::shared_ptr<Connection>&){ disconnected.set_value(); });
+    server->prepare("127.0.0.1", 0);
+    server->open();
+
+    auto client = Socket::create(SocketType::CLIENT);
+    client->prepare("127.0.0.1", server->get_port());
+    client->open();
+
+    // when
+    client->send("x", 1);
+
+    // then
+    ASSERT_EQ(disconnected.get_future().wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    ASSERT_EQ(server->get_connection_count(), 0);
+
+    client->close();
+    server->close();
+    reactor->stop();
+    reactorFuture.wait();
+}
+} // namespace common::test
+
+#endif
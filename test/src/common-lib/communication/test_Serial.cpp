@@ -29,6 +29,15 @@ SOFTWARE.
 
 #include <array>
 
+#if defined(LINUX)
+#include <stdlib.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#endif
+
 namespace common::detail::test
 {
 #if defined(WINDOWS)
@@ -236,6 +245,44 @@ TEST(test_Serial, readline)
     ASSERT_EQ(result, "Hi");
 }
 
+#if defined(LINUX)
+TEST(test_Serial, readline_keeps_remaining)
+{
+    using namespace ::testing;
+
+    // given
+    auto mockHandler = std::make_shared<MockSerialHandler>();
+    EXPECT_CALL(*mockHandler, Wrapper_Read(_, _, _))
+        .WillOnce([](int32_t, char* buffer, size_t) -> ssize_t {
+            const std::string chunk("first\r\nsec");
+            chunk.copy(buffer, chunk.size());
+            return chunk.size();
+        })
+        .WillOnce([](int32_t, char* buffer, size_t) -> ssize_t {
+            const std::string chunk("ond\r\nthird\r");
+            chunk.copy(buffer, chunk.size());
+            return chunk.size();
+        })
+        .WillOnce([](int32_t, char* buffer, size_t) -> ssize_t {
+            buffer[0] = '\n';
+            return 1;
+        })
+        .WillRepeatedly(Return(0));
+
+    DetailSerial serial(mockHandler);
+
+    // when
+    const std::string first(serial.readline(EscapeSequence::CARRIAGE_RETURN));
+    const std::string second(serial.readline(EscapeSequence::CARRIAGE_RETURN));
+    const std::string third(serial.readline(EscapeSequence::CARRIAGE_RETURN));
+
+    // then
+    ASSERT_EQ(first, "first");
+    ASSERT_EQ(second, "second");
+    ASSERT_EQ(third, "third");
+}
+#endif
+
 TEST(test_Serial, write)
 {
     using namespace ::testing;
@@ -276,4 +323,143 @@ TEST(test_Serial, write)
         ASSERT_TRUE(rtn);
     }
 }
+
+TEST(test_Serial, baudrate)
+{
+    // given
+    const Baudrate standard(921600U);
+    const Baudrate custom(250000U);
+    Baudrate assigned;
+
+    // when
+    assigned = 3000000U;
+
+    // then
+    ASSERT_EQ(standard._value, Baudrate::_921600);
+    ASSERT_EQ(standard.uint32_t(), 921600U);
+    ASSERT_FALSE(standard.is_custom());
+    ASSERT_TRUE(custom.is_custom());
+    ASSERT_EQ(custom.uint32_t(), 250000U);
+    ASSERT_EQ(assigned._value, Baudrate::_3000000);
+    ASSERT_EQ(Baudrate(Baudrate::_115200).uint32_t(), 115200U);
+#if defined(LINUX)
+    ASSERT_EQ(standard.to_speed(), static_cast<speed_t>(B921600));
+    ASSERT_EQ(Baudrate(Baudrate::_4000000).to_speed(), static_cast<speed_t>(B4000000));
+#endif
+}
+
+#if defined(LINUX)
+class PseudoTerminal
+{
+private :
+    int32_t _master = -1;
+
+public :
+    PseudoTerminal()
+    {
+        _master = posix_openpt(O_RDWR | O_NOCTTY);
+        if(_master >= 0 && (grantpt(_master) != 0 || unlockpt(_master) != 0))
+        {
+            ::close(_master);
+            _master = -1;
+        }
+    }
+    ~PseudoTerminal() { if(_master >= 0) { ::close(_master); } }
+
+    inline auto master() const -> int32_t { return _master; }
+    inline auto slave() const -> std::string { return ptsname(_master); }
+};
+
+TEST(test_Serial, open_with_options)
+{
+    // given
+    PseudoTerminal pty;
+    ASSERT_GE(pty.master(), 0);
+    SerialOptions options;
+    options._raw = true;
+    options._vmin = 0;
+    options._vtime = 5;
+    options._lowLatency = true; // not supported by pty, must not fail the open
+
+    auto serial = Serial::create();
+
+    // when
+    const auto isOpen = serial->open(pty.slave(), Baudrate::_921600, SERIAL_READ | SERIAL_WRITE, options);
+
+    // then
+    ASSERT_TRUE(isOpen);
+    termios current;
+    ASSERT_EQ(tcgetattr(serial->get_native_handle(), &current), 0);
+    ASSERT_EQ(cfgetospeed(&current), static_cast<speed_t>(B921600));
+    ASSERT_EQ(current.c_lflag & (ICANON | ECHO), 0U);
+    ASSERT_EQ(current.c_cc[VMIN], 0);
+    ASSERT_EQ(current.c_cc[VTIME], 5);
+    ASSERT_EQ(::fcntl(serial->get_native_handle(), F_GETFL) & O_NONBLOCK, 0);
+    serial->close();
+}
+
+TEST(test_Serial, open_with_custom_baudrate)
+{
+    // given
+    PseudoTerminal pty;
+    ASSERT_GE(pty.master(), 0);
+    auto serial = Serial::create();
+
+    // when
+    const auto isOpen = serial->open(pty.slave(), Baudrate(250000U), SERIAL_READ | SERIAL_WRITE);
+
+    // then
+    ASSERT_TRUE(isOpen);
+    ASSERT_EQ(SerialHandler().Wrapper_GetBaudrate(serial->get_native_handle()), 250000U);
+    serial->close();
+}
+
+TEST(test_Serial, pty_throughput)
+{
+    // given
+    PseudoTerminal pty;
+    ASSERT_GE(pty.master(), 0);
+    SerialOptions options;
+    options._raw = true;
+    options._vmin = 1;
+    options._vtime = 0;
+
+    auto serial = Serial::create();
+    ASSERT_TRUE(serial->open(pty.slave(), Baudrate::_3000000, SERIAL_READ | SERIAL_WRITE, options));
+
+    constexpr size_t TOTAL = 1024 * 1024;
+    std::vector<uint8_t> sent(TOTAL);
+    for(size_t i = 0; i < TOTAL; ++i) { sent[i] = static_cast<uint8_t>(i * 31 + (i >> 8)); }
+
+    // when
+    const auto begin = std::chrono::steady_clock::now();
+    std::thread writer([&pty, &sent](){
+        size_t offset = 0;
+        while(offset < sent.size())
+        {
+            const ssize_t written = ::write(pty.master(), sent.data() + offset, std::min<size_t>(4096, sent.size() - offset));
+            if(written <= 0) { break; }
+            offset += written;
+        }
+    });
+
+    std::vector<uint8_t> received;
+    received.reserve(TOTAL);
+    std::array<uint8_t, 4096> buffer;
+    while(received.size() < TOTAL)
+    {
+        const ssize_t readSize = ::read(serial->get_native_handle(), buffer.data(), buffer.size());
+        if(readSize <= 0) { break; }
+        received.insert(received.end(), buffer.begin(), buffer.begin() + readSize);
+    }
+    writer.join();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    // then
+    ASSERT_EQ(received.size(), TOTAL);
+    ASSERT_TRUE(received == sent); // raw mode keeps every byte as is
+    std::cout << "pty throughput : " << (TOTAL / elapsed / (1024 * 1024)) << " MiB/s" << std::endl;
+    serial->close();
+}
+#endif
 } // namespace common::test
@@ -0,0 +1,196 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include <gtest/gtest.h>
+
+#include "common/communication/SerialReader.hpp"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace common::test
+{
+static auto feed_in_pieces(const std::shared_ptr<SerialParser>& parser,
+                           const std::vector<uint8_t>& stream,
+                           const size_t piece) -> std::vector<std::string>
+{
+    std::vector<std::string> frames;
+    for(size_t offset = 0; offset < stream.size(); offset += piece)
+    {
+        parser->feed(stream.data() + offset, std::min(piece, stream.size() - offset), [&frames](const Frame& frame){
+            frames.push_back(frame.to_string());
+        });
+    }
+    return frames;
+}
+
+TEST(test_SerialReader, delimiter_parser)
+{
+    // given
+    const std::string text("$GPGGA,1\r\n$GPRMC,2\r\n\r\n$GPVTG,3\r\n");
+    const std::vector<uint8_t> stream(text.begin(), text.end());
+
+    for(size_t piece = 1; piece <= stream.size(); ++piece)
+    {
+        // when
+        auto parser = DelimiterParser::create("\r\n");
+        const auto frames = feed_in_pieces(parser, stream, piece);
+
+        // then
+        ASSERT_EQ(frames, (std::vector<std::string>{"$GPGGA,1", "$GPRMC,2", "", "$GPVTG,3"})) << "piece " << piece;
+    }
+}
+
+TEST(test_SerialReader, delimiter_parser_oversized)
+{
+    // given
+    auto parser = DelimiterParser::create("\n", 4);
+    const std::string text("toolong\nok\n");
+    const std::vector<uint8_t> stream(text.begin(), text.end());
+
+    // when
+    const auto frames = feed_in_pieces(parser, stream, 3);
+
+    // then
+    ASSERT_EQ(frames, (std::vector<std::string>{"ok"}));
+    ASSERT_EQ(parser->get_errors(), 1U);
+}
+
+TEST(test_SerialReader, length_prefix_parser)
+{
+    // given
+    const std::vector<uint8_t> stream{0, 3, 'a', 'b', 'c', 0, 0, 0, 1, 'd', 0, 9, 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 0, 2, 'e', 'f'};
+
+    for(size_t piece = 1; piece <= stream.size(); ++piece)
+    {
+        // when
+        auto parser = LengthPrefixParser::create(2, 8);
+        const auto frames = feed_in_pieces(parser, stream, piece);
+
+        // then
+        ASSERT_EQ(frames, (std::vector<std::string>{"abc", "", "d", "ef"})) << "piece " << piece;
+        ASSERT_EQ(parser->get_errors(), 1U);
+    }
+}
+
+TEST(test_SerialReader, slip_and_cobs_parser)
+{
+    // given
+    std::vector<uint8_t> payload;
+    for(int32_t i = 0; i < 600; ++i) { payload.push_back(static_cast<uint8_t>(i % 7 == 0 ? 0 : i)); }
+    payload.push_back(SlipParser::END);
+    payload.push_back(SlipParser::ESC);
+    const std::string expected(payload.begin(), payload.end());
+
+    std::vector<uint8_t> slip;
+    std::vector<uint8_t> cobs;
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        SlipParser::encode(payload.data(), payload.size(), slip);
+        CobsParser::encode(payload.data(), payload.size(), cobs);
+    }
+
+    for(const size_t piece : {1, 5, 64, 4096})
+    {
+        // when
+        const auto slipFrames = feed_in_pieces(SlipParser::create(), slip, piece);
+        const auto cobsFrames = feed_in_pieces(CobsParser::create(), cobs, piece);
+
+        // then
+        ASSERT_EQ(slipFrames, std::vector<std::string>(3, expected)) << "piece " << piece;
+        ASSERT_EQ(cobsFrames, std::vector<std::string>(3, expected)) << "piece " << piece;
+    }
+}
+
+TEST(test_SerialReader, read_from_pty)
+{
+    // given
+    const int32_t master = posix_openpt(O_RDWR | O_NOCTTY);
+    ASSERT_GE(master, 0);
+    ASSERT_EQ(grantpt(master), 0);
+    ASSERT_EQ(unlockpt(master), 0);
+
+    auto serial = Serial::create();
+    SerialOptions options;
+    options._raw = true;
+    ASSERT_TRUE(serial->open(ptsname(master), Baudrate::_115200, SERIAL_READ | SERIAL_WRITE, options));
+
+    auto bus = std::make_shared<EventBus>(1);
+    std::promise<std::string> published;
+    std::atomic<bool> first{true};
+    bus->subscribe("serial", [&published, &first](const EventBus::Payload& payload){
+        if(first.exchange(false)) { published.set_value(std::string(payload.begin(), payload.end())); }
+    });
+
+    std::vector<std::string> frames;
+    std::promise<void> done;
+    const int32_t flags = ::fcntl(serial->get_native_handle(), F_GETFL);
+    auto reader = SerialReader::create(serial, CobsParser::create(), 1024);
+    ASSERT_NE(reader, nullptr);
+    reader->on_frame([&frames, &done](const Frame& frame){
+        frames.push_back(frame.to_string());
+        if(frames.size() == 100) { done.set_value(); }
+    });
+    reader->publish_to(bus, "serial");
+    auto future = reader->run();
+
+    // when
+    std::vector<uint8_t> stream;
+    for(int32_t i = 0; i < 100; ++i)
+    {
+        const std::string message = "frame " + std::to_string(i);
+        CobsParser::encode(reinterpret_cast<const uint8_t*>(message.data()), message.size(), stream);
+    }
+    ASSERT_EQ(::write(master, stream.data(), stream.size()), static_cast<ssize_t>(stream.size()));
+
+    // then
+    auto received = done.get_future();
+    ASSERT_EQ(received.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(frames.front(), "frame 0");
+    ASSERT_EQ(frames.back(), "frame 99");
+    ASSERT_EQ(reader->get_dropped(), 0U);
+
+    auto firstPublished = published.get_future();
+    ASSERT_EQ(firstPublished.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(firstPublished.get(), "frame 0");
+
+    reader->stop();
+    future.wait();
+    reader.reset();
+    ASSERT_EQ(::fcntl(serial->get_native_handle(), F_GETFL), flags); // the port is left as it was given
+    bus->finalize();
+    serial->close();
+    ::close(master);
+}
+} // namespace common::test
+
+#endif
@@ -0,0 +1,158 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include <gtest/gtest.h>
+
+#include "common/communication/SharedChannel.hpp"
+
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include <thread>
+#include <vector>
+
+namespace common::test
+{
+struct Sample
+{
+    uint32_t _producer;
+    uint32_t _sequence;
+    double _value;
+};
+
+TEST(test_SharedChannel, spsc)
+{
+    // given
+    ::shm_unlink("/test_SharedChannel_spsc"); // left over by an aborted run
+    auto channel = SharedChannel<Sample>::create("test_SharedChannel_spsc", 64);
+    ASSERT_NE(channel, nullptr);
+    struct stat status;
+    ASSERT_EQ(::stat("/dev/shm/test_SharedChannel_spsc", &status), 0);
+    ASSERT_EQ(status.st_mode & 0777, 0600U); // not writable by other users
+    constexpr uint32_t COUNT = 100000;
+
+    // when
+    std::thread producer([&channel](){
+        for(uint32_t i = 0; i < COUNT; ++i) { channel->send(Sample{0, i, i * 0.5}); }
+    });
+
+    bool ordered = true;
+    for(uint32_t i = 0; i < COUNT; ++i)
+    {
+        const auto sample = channel->recv();
+        ordered &= (sample._sequence == i && sample._value == i * 0.5);
+    }
+    producer.join();
+
+    // then
+    ASSERT_TRUE(ordered);
+    ASSERT_FALSE(channel->try_recv().has_value());
+    ASSERT_EQ(channel->get_capacity(), 64U);
+    ASSERT_TRUE(channel->close());
+}
+
+TEST(test_SharedChannel, mpsc)
+{
+    // given
+    ::shm_unlink("/test_SharedChannel_mpsc");
+    auto channel = SharedChannel<Sample, ChannelMode::MPSC>::create("test_SharedChannel_mpsc", 100);
+    ASSERT_NE(channel, nullptr);
+    constexpr uint32_t PRODUCERS = 4;
+    constexpr uint32_t COUNT = 50000;
+
+    // when
+    std::vector<std::thread> producers;
+    for(uint32_t p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&channel, p](){
+            for(uint32_t i = 0; i < COUNT; ++i) { channel->send(Sample{p, i, 0.0}); }
+        });
+    }
+
+    std::vector<uint32_t> next(PRODUCERS, 0);
+    bool ordered = true;
+    for(uint32_t i = 0; i < PRODUCERS * COUNT; ++i)
+    {
+        const auto sample = channel->recv();
+        ordered &= (sample._sequence == next[sample._producer]++);
+    }
+    for(auto& producer : producers) { producer.join(); }
+
+    // then
+    ASSERT_TRUE(ordered); // per producer order is kept
+    ASSERT_EQ(next, std::vector<uint32_t>(PRODUCERS, COUNT));
+    ASSERT_EQ(channel->get_capacity(), 128U);
+    ASSERT_TRUE(channel->close());
+}
+
+TEST(test_SharedChannel, cross_process)
+{
+    // given
+    ::shm_unlink("/test_SharedChannel_process");
+    auto channel = SharedChannel<Sample>::create("test_SharedChannel_process", 256);
+    ASSERT_NE(channel, nullptr);
+    constexpr uint32_t COUNT = 100000;
+
+    // when
+    const pid_t pid = ::fork();
+    ASSERT_GE(pid, 0);
+    if(pid == 0)
+    {
+        auto child = SharedChannel<Sample>::create("test_SharedChannel_process", 256);
+        if(child == nullptr) { ::_exit(1); }
+        for(uint32_t i = 0; i < COUNT; ++i) { child->send(Sample{1, i, 0.0}); }
+        ::_exit(0);
+    }
+
+    bool ordered = true;
+    for(uint32_t i = 0; i < COUNT; ++i) { ordered &= (channel->recv()._sequence == i); }
+    int32_t status = 0;
+    ::waitpid(pid, &status, 0);
+
+    // then
+    ASSERT_TRUE(ordered);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+    ASSERT_TRUE(channel->close());
+}
+
+TEST(test_SharedChannel, capacity_mismatch)
+{
+    // given
+    ::shm_unlink("/test_SharedChannel_mismatch");
+    auto channel = SharedChannel<Sample>::create("test_SharedChannel_mismatch", 16);
+    ASSERT_NE(channel, nullptr);
+
+    // when
+    auto other = SharedChannel<Sample>::create("test_SharedChannel_mismatch", 32);
+
+    // then
+    ASSERT_EQ(other, nullptr);
+    ASSERT_TRUE(channel->close());
+}
+} // namespace common::test
+
+#endif
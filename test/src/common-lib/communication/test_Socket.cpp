@@ -30,6 +30,13 @@ SOFTWARE.
 
 #include <thread>
 
+#if defined(LINUX)
+#include <array>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
 namespace common::test
 {
 TEST(test_Socket, send_recv)
@@ -77,4 +84,184 @@ TEST(test_Socket, send_recv)
     EXPECT_EQ(server_rcv_msg, client_msg);
     EXPECT_EQ(client_rcv_msg, server_msg);
 }
+
+#if defined(LINUX)
+static auto connect_pair(const int32_t port) -> std::pair<std::shared_ptr<Socket>, std::shared_ptr<Socket>>
+{
+    auto server = Socket::create(SocketType::SERVER);
+    auto server_future = Thread::async([&server, port](){
+        server->prepare("127.0.0.1", port);
+        server->open();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto client = Socket::create(SocketType::CLIENT);
+    client->prepare("127.0.0.1", port);
+    client->open();
+    server_future.wait();
+    return {server, client};
+}
+
+static auto read_all(const std::shared_ptr<Socket>& socket, const size_t size) -> std::string
+{
+    std::string received(size, '\0');
+    size_t readSize = 0;
+    while(readSize < size) { readSize += socket->read(received.data() + readSize, size - readSize); }
+    return received;
+}
+
+TEST(test_Socket, sendv_recvv)
+{
+    // given
+    auto [server, client] = connect_pair(8081);
+    std::string header("HEAD");
+    std::string payload("PAYLOAD");
+    std::array<iovec, 2> out{iovec{header.data(), header.size()}, iovec{payload.data(), payload.size()}};
+
+    // when
+    const size_t sent = client->sendv(out.data(), out.size());
+
+    std::array<char, 4> head{};
+    std::array<char, 7> body{};
+    std::array<iovec, 2> in{iovec{head.data(), head.size()}, iovec{body.data(), body.size()}};
+    const size_t received = server->recvv(in.data(), in.size());
+
+    // then
+    EXPECT_EQ(sent, header.size() + payload.size());
+    EXPECT_EQ(received, sent);
+    EXPECT_EQ(std::string(head.data(), head.size()), header);
+    EXPECT_EQ(std::string(body.data(), body.size()), payload);
+}
+
+TEST(test_Socket, send_zerocopy)
+{
+    // given
+    auto [server, client] = connect_pair(8082);
+    std::string small("small");
+    std::string large(Socket::ZEROCOPY_THRESHOLD * 4, 'z');
+    int32_t completed = 0;
+
+    // when
+    client->send_zerocopy(small.data(), small.size(), [&completed](const bool copied){ completed += copied ? 1 : 0; });
+    client->send_zerocopy(large.data(), large.size(), [&completed](const bool){ ++completed; });
+    const std::string received = read_all(server, small.size() + large.size());
+    for(int32_t i = 0; i < 100 && client->get_zerocopy_pending() > 0; ++i) { client->poll_zerocopy(10); }
+
+    // then
+    EXPECT_EQ(received, small + large);
+    EXPECT_EQ(completed, 2);
+    EXPECT_EQ(client->get_zerocopy_pending(), 0U);
+}
+
+TEST(test_Socket, sendfile_splice)
+{
+    // given
+    auto [server, client] = connect_pair(8083);
+    const std::string content("file content streamed in the kernel");
+    FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fwrite(content.data(), 1, content.size(), file), content.size());
+    fflush(file);
+    const int32_t fd = fileno(file);
+
+    // when
+    const size_t sentByFile = client->sendfile(fd, 5, content.size());
+    const std::string receivedByFile = read_all(server, sentByFile);
+
+    lseek(fd, 0, SEEK_SET);
+    const size_t sentBySplice = client->splice(fd, content.size());
+    const std::string receivedBySplice = read_all(server, sentBySplice);
+    fclose(file);
+
+    // then
+    EXPECT_EQ(sentByFile, content.size() - 5);
+    EXPECT_EQ(receivedByFile, content.substr(5));
+    EXPECT_EQ(sentBySplice, content.size());
+    EXPECT_EQ(receivedBySplice, content);
+}
+
+TEST(test_Socket, unix_stream)
+{
+    // given
+    const std::string path("/tmp/common-lib-test_Socket.sock");
+    const std::string message("over unix socket");
+    std::string server_rcv_msg;
+
+    auto server_future = Thread::async([&path, &server_rcv_msg](){
+        auto server = Socket::create(SocketType::UNIX_SERVER);
+        server->prepare(path, 0);
+        server->open();
+
+        std::array<char, 64> buffer{};
+        const size_t readSize = server->read(buffer.data(), buffer.size());
+        server_rcv_msg.assign(buffer.data(), readSize);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // when
+    auto client = Socket::create(SocketType::UNIX_CLIENT);
+    client->prepare(path, 0);
+    client->open();
+    client->send(message.c_str(), message.size());
+    server_future.wait();
+
+    // then
+    EXPECT_EQ(server_rcv_msg, message);
+    EXPECT_NE(access(path.c_str(), F_OK), 0); // removed on close
+}
+
+TEST(test_Socket, unix_seqpacket_pair)
+{
+    // given
+    auto [first, second] = Socket::create_pair(SocketType::UNIX_SEQPACKET_CLIENT);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+
+    // when
+    first->send("one", 3);
+    first->send("two!", 4);
+
+    std::array<char, 64> buffer{};
+    const size_t firstSize = second->read(buffer.data(), buffer.size());
+    const std::string firstMessage(buffer.data(), firstSize);
+    const size_t secondSize = second->read(buffer.data(), buffer.size());
+    const std::string secondMessage(buffer.data(), secondSize);
+
+    // then
+    EXPECT_EQ(firstMessage, "one");
+    EXPECT_EQ(secondMessage, "two!");
+    EXPECT_EQ(Socket::create_pair(SocketType::CLIENT).first, nullptr);
+}
+
+TEST(test_Socket, pass_memfd)
+{
+    // given
+    auto [sender, receiver] = Socket::create_pair();
+    const std::string payload(64 * 1024, 'm');
+    const int32_t memfd = memfd_create("test_Socket", MFD_CLOEXEC);
+    ASSERT_GE(memfd, 0);
+    ASSERT_EQ(::write(memfd, payload.data(), payload.size()), static_cast<ssize_t>(payload.size()));
+
+    // when
+    const uint64_t size = payload.size();
+    sender->send_fds(&size, sizeof(size), &memfd, 1);
+    ::close(memfd);
+
+    uint64_t receivedSize = 0;
+    std::array<int32_t, 4> fds{-1, -1, -1, -1};
+    size_t count = fds.size();
+    receiver->recv_fds(&receivedSize, sizeof(receivedSize), fds.data(), count);
+
+    // then
+    ASSERT_EQ(count, 1U);
+    ASSERT_EQ(receivedSize, size);
+    void* mapped = mmap(nullptr, receivedSize, PROT_READ, MAP_SHARED, fds[0], 0);
+    ASSERT_NE(mapped, MAP_FAILED);
+    EXPECT_EQ(std::string(static_cast<const char*>(mapped), receivedSize), payload);
+    munmap(mapped, receivedSize);
+    ::close(fds[0]);
+}
+#endif
 } // namespace common::test
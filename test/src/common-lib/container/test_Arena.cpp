@@ -0,0 +1,86 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "common/container/Arena.hpp"
+
+namespace common::test
+{
+TEST(test_Arena, aligned_bump)
+{
+    // given
+    Arena arena(1024);
+
+    // when
+    void* first = arena.allocate(1, 1);
+    void* second = arena.allocate(8, 8);
+    void* third = arena.allocate(16, 64);
+
+    // then
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(second) % 8);
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(third) % 64);
+    ASSERT_EQ(static_cast<char*>(first) + 8, static_cast<char*>(second));
+    ASSERT_EQ(1024u, arena.get_capacity());
+}
+
+TEST(test_Arena, reset_keeps_chunks)
+{
+    // given
+    Arena arena(1024);
+    std::vector<void*> first;
+    for(int32_t i = 0; i < 10; ++i) { first.push_back(arena.allocate(512)); }
+    const size_t capacity = arena.get_capacity();
+    void* large = arena.allocate(4096);
+
+    // when
+    arena.reset();
+    std::vector<void*> second;
+    for(int32_t i = 0; i < 10; ++i) { second.push_back(arena.allocate(512)); }
+
+    // then
+    ASSERT_NE(nullptr, large);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(capacity + 4096 + alignof(std::max_align_t), arena.get_capacity());
+    ASSERT_EQ(5120u, arena.get_used());
+}
+
+TEST(test_Arena, pmr_containers)
+{
+    // given
+    Arena arena;
+
+    // when
+    std::pmr::vector<std::pmr::string> strings(&arena);
+    for(int32_t i = 0; i < 100; ++i) { strings.emplace_back("a string too long for the small buffer " + std::to_string(i)); }
+
+    // then
+    ASSERT_EQ(100u, strings.size());
+    ASSERT_EQ("a string too long for the small buffer 99", strings.back());
+    ASSERT_EQ(64u * 1024, arena.get_capacity());
+}
+}
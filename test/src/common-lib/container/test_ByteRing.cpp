@@ -0,0 +1,105 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/container/ByteRing.hpp"
+
+#include <string>
+#include <thread>
+
+namespace common::test
+{
+TEST(test_ByteRing, wrap_around)
+{
+    // given
+    ByteRing ring(10);
+    const std::string first("0123456789ab");
+    const std::string second("cdefgh");
+
+    // when
+    const size_t written = ring.write(reinterpret_cast<const uint8_t*>(first.data()), first.size());
+    ring.consume(8);
+    ring.write(reinterpret_cast<const uint8_t*>(second.data()), second.size());
+
+    std::string result;
+    while(!ring.empty())
+    {
+        auto [span, size] = ring.read_span();
+        result.append(reinterpret_cast<const char*>(span), size);
+        ring.consume(size);
+    }
+
+    // then
+    ASSERT_EQ(ring.capacity(), 16U);
+    ASSERT_EQ(written, first.size());
+    ASSERT_EQ(result, "89ab" + second);
+}
+
+TEST(test_ByteRing, full)
+{
+    // given
+    ByteRing ring(4);
+    const uint8_t data[6] = {1, 2, 3, 4, 5, 6};
+
+    // when
+    const size_t written = ring.write(data, sizeof(data));
+
+    // then
+    ASSERT_EQ(written, 4U);
+    ASSERT_EQ(ring.write_span().second, 0U);
+    ASSERT_EQ(ring.size(), 4U);
+}
+
+TEST(test_ByteRing, producer_consumer)
+{
+    // given
+    ByteRing ring(64);
+    constexpr uint32_t count = 100000;
+
+    // when
+    std::thread producer([&ring](){
+        for(uint32_t i = 0; i < count;)
+        {
+            const uint8_t value = static_cast<uint8_t>(i);
+            if(ring.write(&value, 1) == 1) { ++i; }
+            else { std::this_thread::yield(); }
+        }
+    });
+
+    bool ordered = true;
+    for(uint32_t received = 0; received < count;)
+    {
+        auto [span, size] = ring.read_span();
+        if(size == 0) { std::this_thread::yield(); continue; }
+        for(size_t i = 0; i < size; ++i) { ordered &= span[i] == static_cast<uint8_t>(received + i); }
+        received += size;
+        ring.consume(size);
+    }
+    producer.join();
+
+    // then
+    ASSERT_TRUE(ordered);
+}
+} // namespace common::test
@@ -0,0 +1,175 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/container/ConcurrentHashMap.hpp"
+
+namespace common::test
+{
+namespace
+{
+// sends every key to the same home slot so probing and backward shifts get exercised
+struct CollidingHash
+{
+    auto operator()(int32_t key) const -> size_t { return static_cast<size_t>(key % 3); }
+};
+} // namespace
+
+TEST(test_ConcurrentHashMap, basic)
+{
+    // given
+    ConcurrentHashMap<std::string, int32_t> map(4);
+
+    // when
+    ASSERT_TRUE(map.try_emplace("one", 1));
+    ASSERT_FALSE(map.try_emplace("one", 10));
+    ASSERT_TRUE(map.insert_or_assign(std::string("two"), 2));
+    ASSERT_FALSE(map.insert_or_assign(std::string("two"), 20));
+    map.upsert(std::string("three"), [](int32_t& value){ value += 3; });
+    ASSERT_TRUE(map.update(std::string("three"), [](int32_t& value){ value *= 10; }));
+    ASSERT_FALSE(map.update(std::string("four"), [](int32_t& value){ value = 4; }));
+
+    // then
+    ASSERT_EQ(3, map.size());
+    ASSERT_EQ(1, map.find(std::string("one")).value());
+    ASSERT_EQ(20, map.find(std::string("two")).value());
+    ASSERT_EQ(30, map.find(std::string("three")).value());
+    ASSERT_FALSE(map.find(std::string("four")).has_value());
+
+    int32_t visited = 0;
+    ASSERT_TRUE(map.visit(std::string("one"), [&visited](const int32_t& value){ visited = value; }));
+    ASSERT_EQ(1, visited);
+
+    ASSERT_EQ(20, map.extract(std::string("two")).value());
+    ASSERT_FALSE(map.erase(std::string("two")));
+    ASSERT_FALSE(map.contains(std::string("two")));
+
+    int32_t sum = 0;
+    map.for_each([&sum](const std::string&, int32_t& value){ sum += value; });
+    ASSERT_EQ(31, sum);
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+}
+
+TEST(test_ConcurrentHashMap, eraseKeepsProbeChains)
+{
+    // given
+    ConcurrentHashMap<int32_t, int32_t, CollidingHash> map(1);
+    std::unordered_map<int32_t, int32_t> expected;
+    std::mt19937 random(7);
+
+    // when
+    for(int32_t i = 0; i < 20000; ++i)
+    {
+        const int32_t key = static_cast<int32_t>(random() % 200);
+        if(random() % 2 == 0)
+        {
+            ASSERT_EQ(expected.emplace(key, i).second, map.try_emplace(key, i));
+        }
+        else
+        {
+            ASSERT_EQ(expected.erase(key) == 1, map.erase(key));
+        }
+    }
+
+    // then
+    ASSERT_EQ(expected.size(), map.size());
+    for(int32_t key = 0; key < 200; ++key)
+    {
+        const auto itor = expected.find(key);
+        const auto value = map.find(key);
+        ASSERT_EQ(itor != expected.end(), value.has_value());
+        if(value) { ASSERT_EQ(itor->second, *value); }
+    }
+}
+
+TEST(test_ConcurrentHashMap, highBitKeys)
+{
+    // given: std::hash is the identity, so these keys differ only above bit 32
+    ConcurrentHashMap<uint64_t, uint64_t> map(4);
+    constexpr uint64_t COUNT = 20000;
+
+    // when
+    for(uint64_t i = 0; i < COUNT; ++i) { ASSERT_TRUE(map.try_emplace(i << 32, i)); }
+    for(uint64_t i = 0; i < COUNT; i += 2) { ASSERT_TRUE(map.erase(i << 32)); }
+
+    // then
+    ASSERT_EQ(COUNT / 2, map.size());
+    for(uint64_t i = 0; i < COUNT; ++i)
+    {
+        if(i % 2 == 0) { ASSERT_FALSE(map.contains(i << 32)); }
+        else { ASSERT_EQ(i, map.find(i << 32).value()); }
+    }
+}
+
+TEST(test_ConcurrentHashMap, eraseIf)
+{
+    // given
+    ConcurrentHashMap<int32_t, int32_t> map(2);
+    for(int32_t i = 0; i < 1000; ++i) { map.try_emplace(i, i); }
+
+    // when
+    const size_t erased = map.erase_if([](const int32_t& key, int32_t&){ return key % 2 == 0; });
+
+    // then
+    ASSERT_EQ(500, erased);
+    ASSERT_EQ(500, map.size());
+    for(int32_t i = 0; i < 1000; ++i) { ASSERT_EQ(i % 2 == 1, map.contains(i)); }
+}
+
+TEST(test_ConcurrentHashMap, multiThread)
+{
+    // given
+    ConcurrentHashMap<int32_t, int32_t> map;
+    const int32_t threadCount = 4;
+    const int32_t count = 5000;
+
+    // when
+    std::vector<std::thread> threads;
+    for(int32_t t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&map, t](){
+            for(int32_t i = 0; i < count; ++i)
+            {
+                map.try_emplace(t * count + i, i);
+                map.upsert(-1, [](int32_t& value){ ++value; });
+                ASSERT_EQ(i, map.find(t * count + i).value());
+                if(i % 2 == 1) { ASSERT_TRUE(map.erase(t * count + i - 1)); }
+            }
+        });
+    }
+    for(auto& thread : threads) { thread.join(); }
+
+    // then
+    ASSERT_EQ(threadCount * count / 2 + 1, map.size());
+    ASSERT_EQ(threadCount * count, map.find(-1).value());
+}
+} // namespace common::test
@@ -24,6 +24,7 @@ SOFTWARE.
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <thread>
 
 #include "common/container/DoublingBuffer.hpp"
@@ -47,6 +48,104 @@ TEST(test_DoublingBuffer, pushAndErase)
     ASSERT_TRUE(list->empty());
 }
 
+TEST(test_DoublingBuffer, update_keeps_snapshot)
+{
+    // given
+    DoublingBuffer<int32_t> dBuffer;
+    for(int32_t i = 0; i < 100; ++i) { dBuffer.push(i); }
+    auto before = dBuffer.get_buffer();
+
+    // when
+    ASSERT_TRUE(dBuffer.update(50, -1));
+    ASSERT_FALSE(dBuffer.update(100, -1));
+
+    // then
+    ASSERT_EQ(50, before->at(50));
+    ASSERT_EQ(-1, dBuffer.get_buffer()->at(50));
+    ASSERT_EQ(101u, dBuffer.get_generation());
+}
+
+TEST(test_DoublingBuffer, transaction)
+{
+    // given
+    DoublingBuffer<int32_t> dBuffer;
+    dBuffer.push(0);
+    const uint32_t generation = dBuffer.get_generation();
+
+    // when
+    auto transaction = dBuffer.transaction();
+    for(int32_t i = 1; i <= 100; ++i) { transaction.push(i); }
+    ASSERT_TRUE(transaction.erase(0));
+    ASSERT_TRUE(transaction.update(0, -1));
+    ASSERT_FALSE(transaction.erase(100));
+    ASSERT_EQ(1u, dBuffer.get_buffer()->size());
+    transaction.commit();
+
+    // then
+    auto list = dBuffer.get_buffer();
+    ASSERT_EQ(generation + 1, dBuffer.get_generation());
+    ASSERT_EQ(100u, list->size());
+    ASSERT_EQ(-1, list->at(0));
+    ASSERT_EQ(100, list->at(99));
+    ASSERT_THROW(transaction.push(0), std::logic_error);
+}
+
+TEST(test_DoublingBuffer, transaction_discarded)
+{
+    // given
+    DoublingBuffer<int32_t> dBuffer;
+    dBuffer.push(0);
+
+    // when
+    {
+        auto transaction = dBuffer.transaction();
+        transaction.push(1);
+    }
+    dBuffer.push(2);
+
+    // then
+    auto list = dBuffer.get_buffer();
+    ASSERT_EQ(2u, list->size());
+    ASSERT_EQ(2, list->at(1));
+    ASSERT_EQ(2u, dBuffer.get_generation());
+}
+
+TEST(test_DoublingBuffer, multiWriter)
+{
+    // given
+    DoublingBuffer<int32_t> dBuffer;
+    constexpr int32_t WRITERS = 4;
+    constexpr int32_t COUNT = 1000;
+
+    // when
+    std::vector<std::future<void>> futures;
+    for(int32_t writer = 0; writer < WRITERS; ++writer)
+    {
+        auto thread = Thread::create();
+        futures.push_back(thread->start([&dBuffer, writer](){
+            for(int32_t i = 0; i < COUNT; ++i)
+            {
+                if(i % 10 == 0)
+                {
+                    auto transaction = dBuffer.transaction();
+                    transaction.push(writer * COUNT + i);
+                    transaction.commit();
+                }
+                else { dBuffer.push(writer * COUNT + i); }
+            }
+        }));
+    }
+    for(auto& future : futures) { future.wait(); }
+
+    // then
+    auto list = dBuffer.get_buffer();
+    std::vector<int32_t> values(list->begin(), list->end());
+    std::sort(values.begin(), values.end());
+    ASSERT_EQ(static_cast<size_t>(WRITERS * COUNT), values.size());
+    for(int32_t i = 0; i < WRITERS * COUNT; ++i) { ASSERT_EQ(i, values[i]); }
+    ASSERT_EQ(static_cast<uint32_t>(WRITERS * COUNT), dBuffer.get_generation());
+}
+
 TEST(test_DoublingBuffer, multiReader_50threads)
 {
     // given
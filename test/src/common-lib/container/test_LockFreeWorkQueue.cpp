@@ -0,0 +1,125 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/container/LockFreeWorkQueue.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace common::test
+{
+namespace
+{
+// Neither default constructible nor copyable.
+struct Task
+{
+    std::unique_ptr<int32_t> _value;
+
+    explicit Task(int32_t value) : _value(std::make_unique<int32_t>(value)) {}
+};
+} // namespace
+
+TEST(test_LockFreeWorkQueue, owner_and_thief_order)
+{
+    // given
+    LockFreeWorkQueue<std::unique_ptr<int32_t>> queue(4);
+    for(int32_t i = 0; i < 10; ++i) { queue.push(std::make_unique<int32_t>(i)); }
+
+    // when
+    std::unique_ptr<int32_t> popped;
+    std::unique_ptr<int32_t> stolen;
+    const bool hasPopped = queue.pop(popped);
+    const bool hasStolen = queue.steal(stolen);
+
+    // then
+    ASSERT_TRUE(hasPopped);
+    ASSERT_TRUE(hasStolen);
+    ASSERT_EQ(*popped, 9);
+    ASSERT_EQ(*stolen, 0);
+    ASSERT_EQ(queue.size(), 8U);
+    ASSERT_GE(queue.getResizeCount(), 2U);
+    ASSERT_EQ(queue.getMaxSize(), 10U);
+}
+
+TEST(test_LockFreeWorkQueue, shrink)
+{
+    // given
+    LockFreeWorkQueue<Task> queue(4);
+    for(int32_t i = 0; i < 1000; ++i) { queue.emplace(i); }
+    const size_t grown = queue.getCapacity();
+
+    // when
+    std::unique_ptr<int32_t> last;
+    for(Task task(0); queue.pop(task);) { last = std::move(task._value); }
+
+    // then
+    ASSERT_GE(grown, 1000U);
+    ASSERT_LE(queue.getCapacity(), 8U);
+    ASSERT_EQ(*last, 0);
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(test_LockFreeWorkQueue, stress)
+{
+    // given
+    constexpr int32_t count = 200000;
+    constexpr int32_t thieves = 3;
+    LockFreeWorkQueue<std::unique_ptr<int32_t>> queue(2);
+    std::vector<std::atomic<int32_t>> taken(count);
+    std::atomic<bool> done{false};
+
+    // when
+    std::vector<std::thread> threads;
+    for(int32_t t = 0; t < thieves; ++t)
+    {
+        threads.emplace_back([&queue, &taken, &done](){
+            std::unique_ptr<int32_t> item;
+            while(!done.load() || !queue.empty())
+            {
+                if(queue.steal(item)) { taken[*item].fetch_add(1); }
+            }
+        });
+    }
+
+    // bursts let the array grow and shrink while thieves are stealing
+    std::unique_ptr<int32_t> item;
+    for(int32_t i = 0; i < count; ++i)
+    {
+        queue.push(std::make_unique<int32_t>(i));
+        if(i % 7 == 0 && queue.pop(item)) { taken[*item].fetch_add(1); }
+        if(i % 5000 == 4999) { while(queue.pop(item)) { taken[*item].fetch_add(1); } }
+    }
+    while(queue.pop(item)) { taken[*item].fetch_add(1); }
+    done.store(true);
+    for(auto& thread : threads) { thread.join(); }
+
+    // then
+    for(int32_t i = 0; i < count; ++i) { ASSERT_EQ(taken[i].load(), 1) << i; }
+    ASSERT_GT(queue.getResizeCount(), 0U);
+}
+} // namespace common::test
@@ -0,0 +1,164 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/container/BlockingQueue.hpp"
+#include "common/container/MpmcQueue.hpp"
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace common::test
+{
+namespace
+{
+// throws when copied or constructed from _failAt, counts live objects
+struct Fragile
+{
+    static inline int32_t _live = 0;
+    static inline int32_t _failAt = -1;
+    int32_t _value = 0;
+
+    explicit Fragile(int32_t value) : _value(value)
+    {
+        if(value == _failAt) { throw std::runtime_error("Fragile"); }
+        ++_live;
+    }
+    Fragile(const Fragile& other) : Fragile(other._value) {}
+    Fragile(Fragile&& other) noexcept : _value(other._value) { ++_live; }
+    ~Fragile() { --_live; }
+    auto operator=(const Fragile& other) -> Fragile& = default;
+    auto operator=(Fragile&& other) noexcept -> Fragile& = default;
+};
+} // namespace
+
+TEST(test_MpmcQueue, full_and_empty)
+{
+    // given
+    MpmcQueue<int32_t> queue(4);
+    const std::array<int32_t, 6> input{1, 2, 3, 4, 5, 6};
+    std::array<int32_t, 8> output{};
+
+    // when
+    const size_t pushed = queue.push_batch(input.data(), input.size());
+    const bool full = !queue.try_push(7);
+    const size_t popped = queue.pop_batch(output.data(), 3);
+    queue.try_push(8);
+
+    // then
+    ASSERT_EQ(pushed, 4U);
+    ASSERT_TRUE(full);
+    ASSERT_EQ(popped, 3U);
+    ASSERT_EQ(output[2], 3);
+    ASSERT_EQ(queue.try_pop(), 4);
+    ASSERT_EQ(queue.try_pop(), 8);
+    ASSERT_FALSE(queue.try_pop().has_value());
+}
+
+TEST(test_MpmcQueue, throwing_constructor)
+{
+    // given
+    MpmcQueue<Fragile> queue(4);
+    const std::vector<Fragile> input{Fragile(1), Fragile(2), Fragile(3)};
+    const int32_t live = Fragile::_live;
+    Fragile::_failAt = 2;
+
+    // when
+    EXPECT_THROW(queue.try_emplace(2), std::runtime_error);
+    EXPECT_THROW(queue.push_batch(input.data(), input.size()), std::runtime_error);
+    Fragile::_failAt = -1;
+
+    // then: the claimed cells are stepped over and the ring keeps going
+    ASSERT_EQ(queue.try_pop()->_value, 1);
+    ASSERT_FALSE(queue.try_pop().has_value());
+    for(int32_t i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(queue.try_emplace(10 + i));
+        ASSERT_EQ(queue.try_pop()->_value, 10 + i);
+    }
+    ASSERT_EQ(queue.push_batch(input.data(), input.size()), 3U);
+    std::vector<Fragile> output(4, Fragile(0));
+    ASSERT_EQ(queue.pop_batch(output.data(), output.size()), 3U);
+    ASSERT_EQ(output[2]._value, 3);
+    output.clear();
+    ASSERT_EQ(Fragile::_live, live);
+}
+
+TEST(test_MpmcQueue, concurrent)
+{
+    // given
+    constexpr int32_t producers = 3;
+    constexpr int32_t consumers = 3;
+    constexpr uint32_t count = 100000;
+    BlockingQueue<MpmcQueue<uint32_t>> queue(128);
+    std::vector<std::atomic<uint32_t>> seen(producers * count);
+    std::atomic<int32_t> running{producers};
+
+    // when
+    std::vector<std::thread> threads;
+    for(int32_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&queue, &running, p](){
+            std::array<uint32_t, 8> batch;
+            for(uint32_t i = 0; i < count; i += batch.size())
+            {
+                for(uint32_t j = 0; j < batch.size(); ++j) { batch[j] = p * count + i + j; }
+                if(i % 16 == 0) { queue.push_batch(batch.data(), batch.size()); }
+                else { for(const auto value : batch) { queue.push(value); } }
+            }
+            if(running.fetch_sub(1) == 1) { queue.close(); }
+        });
+    }
+    for(int32_t c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back([&queue, &seen, c](){
+            std::array<uint32_t, 8> batch;
+            while(true)
+            {
+                if(c == 0)
+                {
+                    const size_t popped = queue.pop_batch(batch.data(), batch.size());
+                    if(popped == 0) { break; }
+                    for(size_t i = 0; i < popped; ++i) { seen[batch[i]].fetch_add(1); }
+                }
+                else
+                {
+                    const auto value = queue.pop();
+                    if(!value) { break; }
+                    seen[*value].fetch_add(1);
+                }
+            }
+        });
+    }
+    for(auto& thread : threads) { thread.join(); }
+
+    // then
+    for(size_t i = 0; i < seen.size(); ++i) { ASSERT_EQ(seen[i].load(), 1U) << i; }
+    ASSERT_TRUE(queue.get_queue().empty());
+}
+} // namespace common::test
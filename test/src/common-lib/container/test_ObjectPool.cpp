@@ -0,0 +1,113 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "common/container/ObjectPool.hpp"
+
+namespace common::test
+{
+namespace
+{
+struct Sample
+{
+    int64_t _values[6];
+    explicit Sample(int64_t value) : _values{value} {}
+};
+
+class CountingResource : public std::pmr::memory_resource
+{
+public :
+    size_t _allocations = 0;
+
+private :
+    auto do_allocate(size_t bytes, size_t alignment) -> void* override
+    {
+        ++_allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    auto do_deallocate(void* pointer, size_t bytes, size_t alignment) -> void override
+    {
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override { return this == &other; }
+};
+}
+
+TEST(test_ObjectPool, reuses_blocks)
+{
+    // given
+    auto first = ObjectPool<Sample>::make_unique(1);
+    const void* address = first.get();
+
+    // when
+    first.reset();
+    auto second = ObjectPool<Sample>::make_unique(2);
+
+    // then
+    ASSERT_EQ(address, second.get());
+    ASSERT_EQ(2, second->_values[0]);
+}
+
+TEST(test_ObjectPool, cross_thread_free)
+{
+    // given
+    std::vector<ObjectPool<Sample>::Pointer> objects;
+    for(int64_t i = 0; i < 1000; ++i) { objects.push_back(ObjectPool<Sample>::make_unique(i)); }
+    std::set<const void*> addresses;
+    for(const auto& object : objects) { addresses.insert(object.get()); }
+
+    // when
+    std::thread([&objects](){ objects.clear(); }).join();
+    auto shared = ObjectPool<Sample>::make_shared(7);
+
+    // then
+    ASSERT_EQ(1000u, addresses.size());
+    ASSERT_EQ(7, shared->_values[0]);
+}
+
+TEST(test_ObjectPool, resource)
+{
+    // given
+    CountingResource upstream;
+    PoolResource resource(&upstream);
+
+    // when
+    {
+        std::pmr::list<int32_t> list(&resource);
+        for(int32_t i = 0; i < 100; ++i) { list.push_back(i); }
+        std::pmr::vector<char> large(4096, 'a', &resource);
+        ASSERT_EQ(100u, list.size());
+        ASSERT_EQ(4096u, large.size());
+    }
+
+    // then
+    ASSERT_EQ(1u, upstream._allocations);
+}
+}
@@ -0,0 +1,157 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "common/container/PersistentVector.hpp"
+
+namespace common::test
+{
+namespace
+{
+auto to_vector(const PersistentVector<int32_t>& vector) -> std::vector<int32_t>
+{
+    return std::vector<int32_t>(vector.begin(), vector.end());
+}
+
+struct Counted
+{
+    static inline int32_t _copies = 0;
+    int32_t _value = 0;
+
+    explicit Counted(int32_t value) noexcept : _value(value) {}
+    Counted(const Counted& other) noexcept : _value(other._value) { ++_copies; }
+    Counted(Counted&&) noexcept = default;
+    auto operator=(const Counted& other) noexcept -> Counted& { _value = other._value; ++_copies; return *this; }
+    auto operator=(Counted&&) noexcept -> Counted& = default;
+};
+}
+
+TEST(test_PersistentVector, matches_vector)
+{
+    // given
+    std::mt19937 random(7);
+    PersistentVector<int32_t> vector;
+    std::vector<int32_t> expected;
+
+    // when
+    for(int32_t i = 0; i < 20000; ++i)
+    {
+        const uint32_t action = random() % 4;
+        if(action == 0 && !expected.empty())
+        {
+            const size_t index = random() % expected.size();
+            vector = vector.erase(index);
+            expected.erase(expected.begin() + index);
+        }
+        else if(action == 1 && !expected.empty())
+        {
+            const size_t index = random() % expected.size();
+            vector = vector.set(index, -i);
+            expected[index] = -i;
+        }
+        else
+        {
+            const size_t index = random() % (expected.size() + 1);
+            vector = vector.insert(index, i);
+            expected.insert(expected.begin() + index, i);
+        }
+    }
+
+    // then
+    ASSERT_EQ(expected.size(), vector.size());
+    ASSERT_EQ(expected, to_vector(vector));
+    std::vector<int32_t> spans;
+    vector.for_each_span([&spans](const int32_t* data, size_t size){ spans.insert(spans.end(), data, data + size); });
+    ASSERT_EQ(expected, spans);
+    for(size_t i = 0; i < expected.size(); ++i) { ASSERT_EQ(expected[i], vector[i]); }
+    ASSERT_THROW(vector.at(expected.size()), std::out_of_range);
+}
+
+TEST(test_PersistentVector, versions_are_immutable)
+{
+    // given
+    PersistentVector<int32_t> original;
+    for(int32_t i = 0; i < 1000; ++i) { original = original.push_back(i); }
+    const auto snapshot = to_vector(original);
+
+    // when
+    auto erased = original;
+    while(!erased.empty()) { erased = erased.erase(erased.size() / 2); }
+    const auto updated = original.set(500, -1);
+    const auto inserted = original.insert(0, -1);
+
+    // then
+    ASSERT_EQ(snapshot, to_vector(original));
+    ASSERT_TRUE(erased.empty());
+    ASSERT_EQ(-1, updated[500]);
+    ASSERT_EQ(501, updated[501]);
+    ASSERT_EQ(1001u, inserted.size());
+    ASSERT_EQ(-1, inserted[0]);
+    ASSERT_EQ(999, inserted[1000]);
+}
+
+TEST(test_PersistentVector, in_place_copies_shared_nodes)
+{
+    // given
+    PersistentVector<int32_t> original;
+    for(int32_t i = 0; i < 1000; ++i) { original.push_back_in_place(i); }
+    const auto snapshot = to_vector(original);
+
+    // when
+    auto working = original;
+    for(int32_t i = 0; i < 1000; ++i) { working.set_in_place(i, -i); }
+    working.erase_in_place(0);
+    working.insert_in_place(500, 1);
+
+    // then
+    ASSERT_EQ(snapshot, to_vector(original));
+    ASSERT_EQ(1000u, working.size());
+    ASSERT_EQ(-1, working[0]);
+    ASSERT_EQ(1, working[500]);
+    ASSERT_EQ(-999, working[999]);
+}
+
+TEST(test_PersistentVector, rvalue_is_moved)
+{
+    // given
+    PersistentVector<Counted> vector;
+    Counted::_copies = 0;
+
+    // when
+    for(int32_t i = 0; i < 1000; ++i) { vector.push_back_in_place(Counted(i)); }
+    vector.insert_in_place(0, Counted(-1));
+    const auto next = vector.push_back(Counted(1000));
+
+    // then
+    ASSERT_EQ(1002u, next.size());
+    ASSERT_EQ(-1, next[0]._value);
+    ASSERT_EQ(1000, next[1001]._value);
+    // only the shared last leaf is copied for the new version
+    ASSERT_LE(Counted::_copies, 32);
+}
+}
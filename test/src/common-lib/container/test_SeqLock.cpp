@@ -0,0 +1,115 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "common/container/SeqLock.hpp"
+
+namespace common::test
+{
+namespace
+{
+// every field holds the same value, a torn copy would mix two of them
+template <size_t Size>
+struct Sample
+{
+    uint64_t _values[Size];
+
+    explicit Sample(uint64_t value = 0)
+    {
+        for(auto& field : _values) { field = value; }
+    }
+
+    auto consistent() const -> bool
+    {
+        for(const auto field : _values) { if(field != _values[0]) { return false; } }
+        return true;
+    }
+};
+
+template <typename Cell>
+auto run_readers(Cell& cell, uint64_t stores) -> void
+{
+    std::atomic<bool> running{true};
+    std::atomic<bool> torn{false};
+    std::vector<std::thread> readers;
+    for(int32_t i = 0; i < 3; ++i)
+    {
+        readers.emplace_back([&](){
+            uint64_t last = 0;
+            while(running.load())
+            {
+                const auto value = cell.load();
+                if(!value.consistent() || value._values[0] < last) { torn.store(true); }
+                last = value._values[0];
+            }
+        });
+    }
+
+    for(uint64_t i = 1; i <= stores; ++i) { cell.store(typename std::decay_t<decltype(cell.load())>(i)); }
+    running.store(false);
+    for(auto& reader : readers) { reader.join(); }
+
+    ASSERT_FALSE(torn.load());
+    ASSERT_EQ(stores, cell.load()._values[0]);
+    ASSERT_EQ(stores, cell.get_version());
+}
+}
+
+TEST(test_SeqLock, store_and_load)
+{
+    // given
+    SeqLock<Sample<3>> cell(Sample<3>(5));
+
+    // when
+    const uint64_t version = cell.get_version();
+    cell.store(Sample<3>(6));
+
+    // then
+    ASSERT_EQ(6u, cell.load()._values[2]);
+    ASSERT_EQ(version + 1, cell.get_version());
+}
+
+TEST(test_SeqLock, no_torn_reads)
+{
+    // given
+    SeqLock<Sample<8>> cell;
+
+    // when, then
+    run_readers(cell, 200000);
+}
+
+TEST(test_LatestValue, no_torn_reads)
+{
+    // given
+    LatestValue<Sample<64>> cell;
+
+    // when, then
+    run_readers(cell, 200000);
+}
+}
@@ -0,0 +1,89 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/container/SizedQueue.hpp"
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace common::test
+{
+TEST(test_SizedQueue, sliding_window)
+{
+    // given
+    SizedQueue<int32_t, 5> queue;
+
+    // when
+    for(int32_t i = 0; i < 8; ++i) { queue.push_back(i); }
+
+    // then
+    ASSERT_TRUE(queue.full());
+    ASSERT_EQ(queue.size(), 5U);
+    ASSERT_EQ(queue.front(), 3);
+    ASSERT_EQ(queue.back(), 7);
+    for(size_t i = 0; i < queue.size(); ++i) { ASSERT_EQ(queue[i], static_cast<int32_t>(i) + 3); }
+    ASSERT_THROW(queue.at(5), std::out_of_range);
+}
+
+TEST(test_SizedQueue, spans)
+{
+    // given
+    SizedQueue<int32_t, 5> queue;   // stored in a ring of 8
+
+    // when
+    for(int32_t i = 0; i < 11; ++i) { queue.push_back(i); }
+    auto [first, second] = queue.spans();
+
+    // then
+    std::vector<int32_t> values(first.first, first.first + first.second);
+    values.insert(values.end(), second.first, second.first + second.second);
+    ASSERT_EQ(values, std::vector<int32_t>({6, 7, 8, 9, 10}));
+    ASSERT_EQ(first.second, 2U);
+    ASSERT_EQ(second.second, 3U);
+}
+
+TEST(test_SizedQueue, pop_and_clear)
+{
+    // given
+    SizedQueue<std::string, 3> queue;
+    queue.emplace_back(3, 'a');
+    queue.push_back(std::string("bbb"));
+    queue.push_back("ccc");
+
+    // when
+    queue.pop_front();
+    const std::string front = queue.front();
+    queue.clear();
+
+    // then
+    ASSERT_EQ(front, "bbb");
+    ASSERT_TRUE(queue.empty());
+    auto [first, second] = queue.spans();
+    ASSERT_EQ(first.second + second.second, 0U);
+}
+} // namespace common::test
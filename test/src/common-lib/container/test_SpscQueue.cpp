@@ -0,0 +1,166 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/container/BlockingQueue.hpp"
+#include "common/container/SpscQueue.hpp"
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common::test
+{
+namespace
+{
+// throws when copied or constructed from _failAt, counts live objects
+struct Fragile
+{
+    static inline int32_t _live = 0;
+    static inline int32_t _failAt = -1;
+    int32_t _value = 0;
+
+    explicit Fragile(int32_t value) : _value(value)
+    {
+        if(value == _failAt) { throw std::runtime_error("Fragile"); }
+        ++_live;
+    }
+    Fragile(const Fragile& other) : Fragile(other._value) {}
+    Fragile(Fragile&& other) noexcept : _value(other._value) { ++_live; }
+    ~Fragile() { --_live; }
+    auto operator=(const Fragile& other) -> Fragile& = default;
+    auto operator=(Fragile&& other) noexcept -> Fragile& = default;
+};
+} // namespace
+
+TEST(test_SpscQueue, full_and_empty)
+{
+    // given
+    SpscQueue<std::string> queue(3);    // rounded up to 4
+
+    // when
+    for(int32_t i = 0; i < 4; ++i) { ASSERT_TRUE(queue.try_push(std::to_string(i))); }
+    std::string rejected("rejected");
+    const bool pushed = queue.try_push(std::move(rejected));
+
+    // then
+    ASSERT_FALSE(pushed);
+    ASSERT_EQ(rejected, "rejected");    // not moved from
+    ASSERT_EQ(queue.size(), 4U);
+    for(int32_t i = 0; i < 4; ++i) { ASSERT_EQ(queue.try_pop(), std::to_string(i)); }
+    ASSERT_FALSE(queue.try_pop().has_value());
+}
+
+TEST(test_SpscQueue, batch)
+{
+    // given
+    SpscQueue<int32_t> queue(8);
+    const std::array<int32_t, 6> input{1, 2, 3, 4, 5, 6};
+    std::array<int32_t, 16> output{};
+    queue.push_batch(input.data(), 4);
+    queue.pop_batch(output.data(), 3);
+
+    // when
+    const size_t pushed = queue.push_batch(input.data(), input.size());    // wraps around the end
+    const size_t popped = queue.pop_batch(output.data(), output.size());
+
+    // then
+    ASSERT_EQ(pushed, 6U);
+    ASSERT_EQ(popped, 7U);
+    ASSERT_EQ(output[0], 4);
+    for(size_t i = 0; i < input.size(); ++i) { ASSERT_EQ(output[i + 1], input[i]); }
+}
+
+TEST(test_SpscQueue, destroy_remaining)
+{
+    // given
+    auto counter = std::make_shared<int32_t>(0);
+
+    // when
+    {
+        SpscQueue<std::shared_ptr<int32_t>> queue(4);
+        queue.try_push(counter);
+        queue.try_push(counter);
+        queue.try_pop();
+    }
+
+    // then
+    ASSERT_EQ(counter.use_count(), 1);
+}
+
+TEST(test_SpscQueue, throwing_copy)
+{
+    // given
+    SpscQueue<Fragile> queue(4);
+    const std::vector<Fragile> input{Fragile(1), Fragile(2), Fragile(3)};
+    const int32_t live = Fragile::_live;
+    Fragile::_failAt = 3;
+
+    // when
+    EXPECT_THROW(queue.push_batch(input.data(), input.size()), std::runtime_error);
+    Fragile::_failAt = -1;
+
+    // then: the partial batch is destroyed and not published
+    ASSERT_EQ(Fragile::_live, live);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.push_batch(input.data(), input.size()), 3U);
+    ASSERT_EQ(queue.try_pop()->_value, 1);
+}
+
+TEST(test_SpscQueue, blocking_transfer)
+{
+    // given
+    BlockingQueue<SpscQueue<uint64_t>> queue(64);
+    constexpr uint64_t count = 200000;
+
+    // when
+    std::thread producer([&queue](){
+        std::array<uint64_t, 16> batch;
+        for(uint64_t i = 0; i < count; i += batch.size())
+        {
+            for(size_t j = 0; j < batch.size(); ++j) { batch[j] = i + j; }
+            queue.push_batch(batch.data(), batch.size());
+        }
+        queue.close();
+    });
+
+    uint64_t expected = 0;
+    bool ordered = true;
+    while(auto value = queue.pop())
+    {
+        ordered = ordered && *value == expected;
+        ++expected;
+    }
+    producer.join();
+
+    // then
+    ASSERT_TRUE(ordered);
+    ASSERT_EQ(expected, count);
+    ASSERT_FALSE(queue.push(0));
+}
+} // namespace common::test
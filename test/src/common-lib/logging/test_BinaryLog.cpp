@@ -0,0 +1,169 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include <gtest/gtest.h>
+
+#include "common/logging/Logger.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common::test
+{
+static auto read_records(const std::string& path) -> std::vector<std::tuple<LogLevel, std::string, uint64_t, std::string>>
+{
+    std::vector<std::tuple<LogLevel, std::string, uint64_t, std::string>> records;
+    auto reader = BinaryLogReader::create(path);
+    if(reader == nullptr) { return records; }
+    reader->read([&records](const LogRecord& record){
+        std::string location = record._file != nullptr ? record._file + (":" + std::to_string(record._line)) : "";
+        records.emplace_back(record._level, std::string(record._message, record._size), record._timestamp, location);
+    });
+    return records;
+}
+
+TEST(test_BinaryLog, round_trip)
+{
+    // given
+    const std::string path = "test_BinaryLog_round_trip.bin";
+    const auto now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::system_clock::now().time_since_epoch()).count());
+    int32_t line = 0;
+    {
+        Logger logger(BinarySink::create(path));
+
+        // when
+        std::string temporary("temporary");
+        line = __LINE__ + 1;
+        _LOG_TO_(logger, LogLevel::INFO, "int=%d uint=%u i64=%lld dbl=%.2f str=%s ch=%c %5.1f%% %-4s|",
+                 -3, 7U, -1234567890123LL, 3.14159, temporary.c_str(), 'x', 99.5f, "ab");
+        temporary.assign("overwritten");
+        for(int32_t i = 0; i < 3; ++i) { _LOG_TO_(logger, LogLevel::ERR, "loop %d", i); }
+        logger.info("legacy %d", 5);
+    }
+
+    // then
+    const auto records = read_records(path);
+    ASSERT_EQ(records.size(), 5U);
+    ASSERT_EQ(std::get<0>(records[0]), LogLevel::INFO);
+    ASSERT_EQ(std::get<1>(records[0]), "int=-3 uint=7 i64=-1234567890123 dbl=3.14 str=temporary ch=x  99.5% ab  |");
+    ASSERT_EQ(std::get<3>(records[0]), "test_BinaryLog.cpp:" + std::to_string(line));
+    ASSERT_EQ(std::get<1>(records[3]), "loop 2");
+    ASSERT_EQ(std::get<0>(records[4]), LogLevel::INFO);
+    ASSERT_EQ(std::get<1>(records[4]), "legacy 5");
+    ASSERT_EQ(std::get<3>(records[4]), "");
+    const int64_t skew = static_cast<int64_t>(std::get<2>(records[0]) - now);
+    ASSERT_LT(std::abs(skew), 5000000000LL);
+    std::remove(path.c_str());
+}
+
+TEST(test_BinaryLog, rolling)
+{
+    // given
+    const std::string path = "test_BinaryLog_rolling.bin";
+    BinaryLogOptions options;
+    options._segmentSize = 4096;
+    options._maxFiles = 3;
+    constexpr int32_t THREADS = 2;
+    constexpr int32_t COUNT = 500;
+    {
+        Logger logger(BinarySink::create(path, options));
+
+        // when
+        std::vector<std::thread> threads;
+        for(int32_t t = 0; t < THREADS; ++t)
+        {
+            threads.emplace_back([&logger, t](){
+                for(int32_t i = 0; i < COUNT; ++i) { _LOG_TO_(logger, LogLevel::DEBUG, "thread %d sequence %d", t, i); }
+            });
+        }
+        for(auto& thread : threads) { thread.join(); }
+    }
+
+    // then
+    std::vector<std::string> files;
+    for(int32_t index = 0; index < 100; ++index)
+    {
+        const std::string file = index == 0 ? path : path + "." + std::to_string(index);
+        if(::access(file.c_str(), F_OK) == 0) { files.push_back(file); }
+    }
+    ASSERT_EQ(files.size(), 3U);
+    ASSERT_EQ(::access(path.c_str(), F_OK), -1); // the oldest were deleted
+
+    std::vector<int32_t> next(THREADS, -1);
+    for(const auto& file : files)
+    {
+        const auto records = read_records(file);
+        ASSERT_FALSE(records.empty()) << file;
+        for(const auto& record : records)
+        {
+            int32_t thread = 0;
+            int32_t sequence = 0;
+            ASSERT_EQ(std::sscanf(std::get<1>(record).c_str(), "thread %d sequence %d", &thread, &sequence), 2);
+            ASSERT_GT(sequence, next[thread]);
+            next[thread] = sequence;
+        }
+        std::remove(file.c_str());
+    }
+    // the kept files are the newest, so a thread that appears in them ends with its last record
+    // (one that finished early may have been rotated out entirely)
+    ASSERT_NE(std::find(next.begin(), next.end(), COUNT - 1), next.end());
+    for(const int32_t last : next) { ASSERT_TRUE(last == -1 || last == COUNT - 1) << last; }
+}
+
+TEST(test_BinaryLog, default_sink)
+{
+    // given
+    const std::string path = "test_BinaryLog_default_sink.bin";
+    auto sink = BinarySink::create(path);
+    detail::LogSite site(LogLevel::INFO, __FILE__, __LINE__, "site %d");
+
+    // when
+    Logger::set_default_sink(sink);
+    _INFO_("through the static logger %d %s", 1, "raw");
+    __logger.log(site, 2);
+    Logger::set_default_sink(nullptr);
+    _INFO_("back to stdout %d", 3);
+    sink.reset();
+
+    // then
+    ASSERT_NE(site._id.load(), 0U); // registered, so the raw arguments were written
+    const auto records = read_records(path);
+    ASSERT_EQ(records.size(), 2U);
+    ASSERT_EQ(std::get<1>(records[0]), "through the static logger 1 raw");
+    ASSERT_EQ(std::get<3>(records[0]).rfind("test_BinaryLog.cpp:", 0), 0U);
+    ASSERT_EQ(std::get<1>(records[1]), "site 2");
+    std::remove(path.c_str());
+}
+} // namespace common::test
+
+#endif
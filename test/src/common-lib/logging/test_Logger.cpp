@@ -0,0 +1,244 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "common/logging/Logger.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common::test
+{
+static auto read_lines(const std::string& path) -> std::vector<std::string>
+{
+    std::vector<std::string> lines;
+    std::ifstream file(path);
+    for(std::string line; std::getline(file, line);) { lines.push_back(line); }
+    return lines;
+}
+
+TEST(test_Logger, file_sink)
+{
+    // given
+    const std::string path = "test_Logger_file_sink.log";
+    std::remove(path.c_str());
+    Logger logger(FileSink::create(path));
+
+    // when
+    logger.log(LogLevel::INFO, "test_Logger.cpp", 10, "value=%d name=%s", 3, "abc");
+    logger.error("legacy %d", 7);
+
+    // then
+    const auto lines = read_lines(path);
+    ASSERT_EQ(lines.size(), 2U);
+    ASSERT_NE(lines[0].find("[INFO] value=3 name=abc (test_Logger.cpp:10)"), std::string::npos);
+    ASSERT_NE(lines[1].find("[ERROR] legacy 7"), std::string::npos);
+    std::remove(path.c_str());
+}
+
+TEST(test_Logger, format_buffer)
+{
+    // given
+    const std::string path = "test_Logger_format_buffer.log";
+    std::remove(path.c_str());
+    Logger logger(FileSink::create(path));
+    const std::string large(10000, 'x');
+    const std::string format = "temporary format %d";
+
+    // when
+    logger.log(LogLevel::INFO, nullptr, 0, "large=%s", large.c_str());
+    logger.log(LogLevel::INFO, nullptr, 0, "small=%d", 1);
+    logger.info(format, 2);
+    logger.debug("100%% literal");
+    logger.error(std::string("no format %d"));
+
+    // then
+    const auto lines = read_lines(path);
+    ASSERT_EQ(lines.size(), 5U);
+    ASSERT_NE(lines[0].find("[INFO] large=" + large), std::string::npos);
+    ASSERT_NE(lines[1].find("[INFO] small=1"), std::string::npos);
+    ASSERT_NE(lines[2].find("[INFO] temporary format 2"), std::string::npos);
+    ASSERT_NE(lines[3].find("[DEBUG] 100%% literal"), std::string::npos);
+    ASSERT_NE(lines[4].find("[ERROR] no format %d"), std::string::npos);
+    std::remove(path.c_str());
+}
+
+TEST(test_Logger, level)
+{
+    // given
+    const std::string path = "test_Logger_level.log";
+    std::remove(path.c_str());
+    Logger logger(FileSink::create(path));
+    int32_t evaluated = 0;
+    Logger::set_level(LogLevel::ERR);
+
+    // when
+    logger.log(LogLevel::INFO, nullptr, 0, "filtered");
+    logger.log(LogLevel::ERR, nullptr, 0, "written");
+    _INFO_("not evaluated %d", ++evaluated);
+    const bool infoEnabled = Logger::is_enabled(LogLevel::INFO);
+    Logger::set_level(LogLevel::DEBUG);
+
+    // then
+    const auto lines = read_lines(path);
+    ASSERT_EQ(lines.size(), 1U);
+    ASSERT_EQ(lines[0].find("written"), lines[0].size() - 7);
+    ASSERT_EQ(evaluated, 0);
+    ASSERT_FALSE(infoEnabled);
+    ASSERT_TRUE(Logger::is_enabled(LogLevel::INFO));
+    std::remove(path.c_str());
+}
+
+TEST(test_Logger, async)
+{
+    // given
+    const std::string path = "test_Logger_async.log";
+    std::remove(path.c_str());
+    Logger logger(FileSink::create(path));
+    constexpr int32_t THREADS = 4;
+    constexpr int32_t COUNT = 1000;
+    ASSERT_TRUE(Logger::start_async());
+    const uint64_t dropped = Logger::get_dropped();
+
+    // when
+    std::vector<std::thread> threads;
+    for(int32_t t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&logger, t](){
+            for(int32_t i = 0; i < COUNT; ++i)
+            {
+                // the temporary is gone before the backend formats it
+                logger.log(LogLevel::DEBUG, __FILENAME__, __LINE__, "thread %d message %d %s", t, i, std::to_string(i).c_str());
+                if(i % 64 == 0) { std::this_thread::yield(); }
+            }
+        });
+    }
+    for(auto& thread : threads) { thread.join(); }
+    logger.flush();
+    Logger::stop_async();
+
+    // then
+    const auto lines = read_lines(path);
+    ASSERT_EQ(lines.size() + (Logger::get_dropped() - dropped), static_cast<size_t>(THREADS * COUNT));
+    for(const auto& line : lines)
+    {
+        const auto message = line.find("message ");
+        ASSERT_NE(message, std::string::npos);
+        const auto number = line.substr(message + 8, line.find(' ', message + 8) - message - 8);
+        ASSERT_NE(line.find("message " + number + " " + number + " (test_Logger.cpp:"), std::string::npos) << line;
+    }
+    std::remove(path.c_str());
+}
+
+TEST(test_Logger, async_drop)
+{
+    // given
+    const std::string path = "test_Logger_async_drop.log";
+    std::remove(path.c_str());
+    Logger logger(FileSink::create(path));
+    AsyncLogOptions options;
+    options._ringSize = 256;
+    ASSERT_TRUE(Logger::start_async(options));
+    const uint64_t dropped = Logger::get_dropped();
+    constexpr size_t COUNT = 10000;
+
+    // when
+    for(size_t i = 0; i < COUNT; ++i) { logger.log(LogLevel::INFO, nullptr, 0, "message %zu", i); }
+    logger.flush();
+    Logger::stop_async();
+
+    // then
+    const size_t lost = Logger::get_dropped() - dropped;
+    ASSERT_GT(lost, 0U);
+    ASSERT_EQ(read_lines(path).size() + lost, COUNT);
+    std::remove(path.c_str());
+}
+
+TEST(test_Logger, escaped_percent)
+{
+    // given
+    const std::string path = "test_Logger_escaped_percent.log";
+    std::remove(path.c_str());
+    Logger logger(FileSink::create(path));
+
+    // when
+    _LOG_TO_(logger, LogLevel::INFO, "50%% done");
+    ASSERT_TRUE(Logger::start_async());
+    _LOG_TO_(logger, LogLevel::INFO, "75%% done");
+    logger.flush();
+    Logger::stop_async();
+
+    // then
+    const auto lines = read_lines(path);
+    ASSERT_EQ(lines.size(), 2U);
+    ASSERT_NE(lines[0].find("[INFO] 50% done"), std::string::npos) << lines[0];
+    ASSERT_NE(lines[1].find("[INFO] 75% done"), std::string::npos) << lines[1];
+    std::remove(path.c_str());
+}
+
+TEST(test_Logger, stop_while_logging)
+{
+    // given
+    const std::string path = "test_Logger_stop_while_logging.log";
+    std::remove(path.c_str());
+    constexpr int32_t THREADS = 2;
+    constexpr int32_t COUNT = 20000;
+    const uint64_t dropped = Logger::get_dropped();
+    {
+        Logger logger(FileSink::create(path));
+        std::atomic<bool> running{true};
+
+        // when: async mode is switched on and off under the writers
+        std::vector<std::thread> threads;
+        for(int32_t t = 0; t < THREADS; ++t)
+        {
+            threads.emplace_back([&logger, t](){
+                for(int32_t i = 0; i < COUNT; ++i) { logger.log(LogLevel::INFO, nullptr, 0, "thread %d message %d", t, i); }
+            });
+        }
+        std::thread toggler([&running](){
+            while(running.load())
+            {
+                Logger::start_async();
+                std::this_thread::yield();
+                Logger::stop_async();
+            }
+        });
+        for(auto& thread : threads) { thread.join(); }
+        running.store(false);
+        toggler.join();
+    } // records left by a stop must be written before the sink goes away
+
+    // then
+    Logger::start_async();
+    Logger::stop_async();
+    ASSERT_EQ(read_lines(path).size() + (Logger::get_dropped() - dropped), static_cast<size_t>(THREADS * COUNT));
+    std::remove(path.c_str());
+}
+} // namespace common::test
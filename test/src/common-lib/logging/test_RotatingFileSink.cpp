@@ -0,0 +1,218 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#if defined(LINUX)
+
+#include <gtest/gtest.h>
+
+#include "common/logging/Logger.hpp"
+#include "common/logging/RotatingFileSink.hpp"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common::test
+{
+static auto read_file(const std::string& path) -> std::string
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static auto remove_files(const std::string& path) -> void
+{
+    std::remove(path.c_str());
+    for(int32_t index = 1; index < 16; ++index) { std::remove((path + "." + std::to_string(index)).c_str()); }
+}
+
+static auto make_record(const std::string& message, uint64_t timestamp) -> LogRecord
+{
+    static std::string buffer;
+    buffer = message;
+    return LogRecord{LogLevel::INFO, timestamp, 1, nullptr, 0, buffer.c_str(), buffer.size()};
+}
+
+TEST(test_RotatingFileSink, rotate_by_size)
+{
+    // given
+    const std::string path = "test_RotatingFileSink_size.log";
+    remove_files(path);
+    RotatingFileOptions options;
+    options._segmentSize = 1024;
+    options._maxFiles = 3;
+    Logger logger(RotatingFileSink::create(path, options));
+
+    // when
+    for(int32_t i = 0; i < 100; ++i) { _LOG_TO_(logger, LogLevel::INFO, "sequence %03d", i); }
+    logger.set_sink(nullptr); // closes the sink, truncating the current file
+
+    // then
+    ASSERT_EQ(::access((path + ".3").c_str(), F_OK), -1);
+    std::string all;
+    for(const auto& file : {path + ".2", path + ".1", path})
+    {
+        const std::string content = read_file(file);
+        ASSERT_FALSE(content.empty()) << file;
+        ASSERT_LE(content.size(), options._segmentSize);
+        ASSERT_EQ(content.find('\0'), std::string::npos);
+        ASSERT_EQ(content.back(), '\n');
+        all += content;
+    }
+    ASSERT_NE(all.find("sequence 099"), std::string::npos);
+    ASSERT_EQ(all.find("sequence 000"), std::string::npos); // deleted with the oldest files
+
+    // lines are contiguous across the rotated files
+    int32_t previous = -1;
+    for(size_t at = all.find("sequence "); at != std::string::npos; at = all.find("sequence ", at + 1))
+    {
+        const int32_t sequence = std::stoi(all.substr(at + 9, 3));
+        ASSERT_TRUE(previous == -1 || sequence == previous + 1);
+        previous = sequence;
+    }
+    remove_files(path);
+}
+
+TEST(test_RotatingFileSink, rotate_by_time)
+{
+    // given
+    const std::string path = "test_RotatingFileSink_time.log";
+    remove_files(path);
+    RotatingFileOptions options;
+    options._interval = std::chrono::seconds(60);
+    auto sink = RotatingFileSink::create(path, options);
+    const uint64_t minute = 60ULL * 1000000000ULL;
+    const uint64_t now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::system_clock::now().time_since_epoch()).count());
+
+    // when
+    sink->write(make_record("first", now));
+    sink->write(make_record("same file", now + minute - 1));
+    sink->write(make_record("next file", now + minute));
+    sink.reset();
+
+    // then
+    const std::string previous = read_file(path + ".1");
+    const std::string current = read_file(path);
+    ASSERT_NE(previous.find("first"), std::string::npos);
+    ASSERT_NE(previous.find("same file"), std::string::npos);
+    ASSERT_EQ(current.find("first"), std::string::npos);
+    ASSERT_NE(current.find("next file"), std::string::npos);
+    remove_files(path);
+}
+
+TEST(test_RotatingFileSink, keep_previous_run)
+{
+    // given
+    const std::string path = "test_RotatingFileSink_previous.log";
+    remove_files(path);
+    {
+        std::ofstream file(path);
+        file << "previous run\n";
+    }
+
+    // when
+    auto sink = RotatingFileSink::create(path);
+    sink->write(make_record("this run", 0));
+    sink->sync();
+    sink.reset();
+
+    // then
+    ASSERT_EQ(read_file(path + ".1"), "previous run\n");
+    ASSERT_NE(read_file(path).find("this run"), std::string::npos);
+    remove_files(path);
+}
+
+TEST(test_RotatingFileSink, default_sink)
+{
+    // given
+    const std::string path = "test_RotatingFileSink_default.log";
+    remove_files(path);
+    auto sink = RotatingFileSink::create(path);
+
+    // when
+    Logger::set_default_sink(sink);
+    _INFO_("through the static logger %d", 1);
+    Logger::set_default_sink(nullptr);
+    _INFO_("back to stdout %d", 2);
+    sink->sync();
+
+    // then
+    const std::string content = read_file(path);
+    ASSERT_NE(content.find("through the static logger 1"), std::string::npos);
+    ASSERT_EQ(content.find("back to stdout"), std::string::npos);
+    sink.reset();
+    remove_files(path);
+}
+TEST(test_RotatingFileSink, write_during_sync)
+{
+    // given
+    const std::string path = "test_RotatingFileSink_sync.log";
+    remove_files(path);
+    RotatingFileOptions options;
+    options._segmentSize = 4096;
+    options._maxFiles = 16;
+    options._syncInterval = std::chrono::milliseconds(0);
+    auto sink = RotatingFileSink::create(path, options);
+    std::atomic<bool> running{true};
+    std::thread syncer([&sink, &running](){
+        while(running.load()) { sink->sync(); }
+    });
+
+    // when
+    char line[32];
+    for(int32_t i = 0; i < 300; ++i)
+    {
+        std::snprintf(line, sizeof(line), "sequence %04d", i);
+        sink->write(make_record(line, 0));
+        sink->flush();
+    }
+    running.store(false);
+    syncer.join();
+    const uint64_t dropped = sink->get_dropped();
+    sink.reset();
+
+    // then
+    ASSERT_EQ(dropped, 0U);
+    std::string all;
+    for(int32_t index = 15; index > 0; --index) { all += read_file(path + "." + std::to_string(index)); }
+    all += read_file(path);
+    int32_t previous = -1;
+    for(size_t at = all.find("sequence "); at != std::string::npos; at = all.find("sequence ", at + 1))
+    {
+        const int32_t sequence = std::stoi(all.substr(at + 9, 4));
+        ASSERT_EQ(sequence, previous + 1);
+        previous = sequence;
+    }
+    ASSERT_EQ(previous, 299);
+    remove_files(path);
+}
+} // namespace common::test
+
+#endif
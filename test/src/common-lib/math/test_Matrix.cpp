@@ -0,0 +1,197 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+#include <gtest/gtest.h>
+
+#include "math/matrix.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace common::test
+{
+using math::Matrix;
+
+namespace
+{
+template <typename T>
+auto make_matrix(const int32_t rows, const int32_t cols, const int32_t seed) -> Matrix<T>
+{
+    Matrix<T> mat(rows, cols);
+    mat.traversal([&mat, seed](const int32_t row, const int32_t col) {
+        mat[row][col] = static_cast<T>(((row * 31 + col * 17 + seed) % 23) - 11) / 8;
+    });
+    return mat;
+}
+
+// checks every kernel of every supported instruction set against plain loops
+template <typename T>
+auto check_kernels(const int32_t rows, const int32_t inner, const int32_t cols) -> void
+{
+    const auto lhs = make_matrix<T>(rows, inner, 1);
+    const auto rhs = make_matrix<T>(inner, cols, 2);
+    const auto other = make_matrix<T>(rows, inner, 3);
+
+    for(uint8_t isa = 0; isa <= static_cast<uint8_t>(math::kernel::get_supported_isa()); ++isa)
+    {
+        math::kernel::set_isa(static_cast<math::kernel::Isa>(isa));
+
+        const auto product = lhs * rhs;
+        for(int32_t row = 0; row < rows; ++row)
+        {
+            for(int32_t col = 0; col < cols; ++col)
+            {
+                T expected = 0;
+                for(int32_t x = 0; x < inner; ++x) { expected += lhs[row][x] * rhs[x][col]; }
+                ASSERT_NEAR(expected, product[row][col], std::abs(expected) * 1e-5 + 1e-5) << "isa " << int32_t(isa);
+            }
+        }
+
+        const auto sum = lhs + other;
+        const auto difference = lhs - other;
+        const auto scaled = lhs * static_cast<T>(3);
+        const auto transposed = lhs.transpose();
+        for(int32_t row = 0; row < rows; ++row)
+        {
+            for(int32_t col = 0; col < inner; ++col)
+            {
+                ASSERT_EQ(lhs[row][col] + other[row][col], sum[row][col]);
+                ASSERT_EQ(lhs[row][col] - other[row][col], difference[row][col]);
+                ASSERT_EQ(lhs[row][col] * 3, scaled[row][col]);
+                ASSERT_EQ(lhs[row][col], transposed[col][row]);
+            }
+        }
+    }
+    math::kernel::set_isa(math::kernel::get_supported_isa());
+}
+} // namespace
+
+TEST(test_Matrix, fixedArithmetic)
+{
+    // given
+    const Matrix<double, 2, 3> lhs({{1, 2, 3}, {4, 5, 6}});
+    const Matrix<double, 3, 2> rhs({{7, 8}, {9, 10}, {11, 12}});
+
+    // when
+    const Matrix<double, 2, 2> product = lhs * rhs;
+    const auto sum = lhs + lhs;
+    const auto scaled = 2.0 * lhs - lhs / 1.0;
+    const auto transposed = lhs.transpose();
+
+    // then
+    ASSERT_EQ(58, product[0][0]);
+    ASSERT_EQ(64, product[0][1]);
+    ASSERT_EQ(139, product[1][0]);
+    ASSERT_EQ(154, product[1][1]);
+    ASSERT_EQ(12, sum(1, 2));
+    ASSERT_EQ(lhs, scaled);
+    ASSERT_EQ(3, transposed._row);
+    ASSERT_EQ(4, transposed(0, 1));
+    ASSERT_EQ(-6, (-lhs)(1, 2));
+}
+
+TEST(test_Matrix, fixedConstexpr)
+{
+    // given
+    constexpr auto identity = math::util::eye<int32_t, 3>();
+    constexpr Matrix<int32_t, 3, 3> mat({{2, 0, 1}, {1, 3, 2}, {1, 1, 2}});
+
+    // when
+    constexpr auto product = mat * identity;
+    constexpr auto det = mat.determinant();
+
+    // then
+    static_assert(product == mat);
+    static_assert(det == 6);
+    static_assert(sizeof(Matrix<float, 4, 4>) == 16 * sizeof(float));
+}
+
+TEST(test_Matrix, fixedInverse)
+{
+    // given
+    const Matrix<double, 3, 3> rotation({{0, -1, 0}, {1, 0, 0}, {0, 0, 1}});
+    const Matrix<double, 4, 4> transform({{2, 0, 0, 1}, {0, 3, 0, 2}, {0, 0, 4, 3}, {0, 0, 0, 1}});
+
+    // when
+    const auto rotationInverse = math::util::inverse(rotation);
+    const auto transformInverse = transform.inverse();
+
+    // then
+    ASSERT_EQ(rotation.transpose(), rotationInverse);
+    const auto identity = transform * transformInverse;
+    for(int32_t row = 0; row < 4; ++row)
+    {
+        for(int32_t col = 0; col < 4; ++col) { ASSERT_NEAR(row == col ? 1.0 : 0.0, identity(row, col), 1e-12); }
+    }
+    ASSERT_DOUBLE_EQ(24.0, transform.determinant());
+    ASSERT_THROW((Matrix<double, 2, 2>({{1, 2}, {2, 4}}).inverse()), std::out_of_range);
+}
+
+TEST(test_Matrix, dynamicConversion)
+{
+    // given
+    const Matrix<double, 2, 2> fixed({{1, 2}, {3, 4}});
+
+    // when
+    const Matrix<double> dynamic = fixed.to_dynamic() + fixed.to_dynamic();
+    const Matrix<double, 2, 2> back(dynamic);
+
+    // then
+    ASSERT_EQ(fixed * 2.0, back);
+    ASSERT_THROW((Matrix<double, 3, 3>(dynamic)), std::out_of_range);
+}
+TEST(test_Matrix, dynamicKernels)
+{
+    const std::vector<std::vector<int32_t>> sizes = {{1, 1, 1}, {3, 3, 3}, {4, 4, 4}, {5, 7, 9}, {17, 33, 19}, {66, 300, 140}};
+    for(const auto& size : sizes)
+    {
+        check_kernels<float>(size[0], size[1], size[2]);
+        check_kernels<double>(size[0], size[1], size[2]);
+        check_kernels<int32_t>(size[0], size[1], size[2]);
+    }
+}
+
+TEST(test_Matrix, dynamicStorage)
+{
+    // given
+    auto mat = make_matrix<double>(3, 5, 0);
+    const double* data = mat.data();
+
+    // when
+    Matrix<double> copied(mat);
+    Matrix<double> moved(std::move(mat));
+    Matrix<double> assigned(3, 5);
+    assigned = copied;
+
+    // then
+    ASSERT_EQ(data, moved.data());
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(moved.data()) % 64);
+    ASSERT_EQ(&moved[1][0], moved.data() + 5);
+    for(int32_t row = 0; row < 3; ++row)
+    {
+        for(int32_t col = 0; col < 5; ++col) { ASSERT_EQ(copied[row][col], assigned[row][col]); }
+    }
+    ASSERT_THROW(assigned = Matrix<double>(5, 3), std::out_of_range);
+    ASSERT_EQ(math::kernel::get_supported_isa(), math::kernel::set_isa(math::kernel::Isa::AVX2));
+}
+} // namespace common::test
@@ -53,4 +53,40 @@ TEST(test_GenericEvent, DISABLED_publishTestMessage)
     ASSERT_EQ(recvData._1, data._1);
     ASSERT_EQ(recvData._2, data._2);
 }
+
+TEST(test_GenericEvent, stateTopic)
+{
+    // given
+    struct Pose
+    {
+        double _x = 0;
+        double _y = 0;
+        double _yaw = 0;
+    };
+
+    GenericEventBus bus;
+    std::atomic<int32_t> received{0};
+    bus.subscribe<Pose>("Pose", [&received](const Pose&){ received.fetch_add(1); });
+    ASSERT_FALSE(bus.get_state<Pose>("Pose").has_value());
+
+    // when
+    auto cell = bus.set_mode<Pose>("Pose", TopicMode::STATE);
+    ASSERT_FALSE(bus.get_state<Pose>("Pose").has_value());
+    for(int32_t i = 1; i <= 100; ++i) { bus.publish<Pose>("Pose", Pose{1.0 * i, 2.0 * i, 3.0 * i}); }
+
+    // then
+    auto pose = bus.get_state<Pose>("Pose");
+    ASSERT_TRUE(pose.has_value());
+    ASSERT_EQ(100.0, pose->_x);
+    ASSERT_EQ(300.0, pose->_yaw);
+    ASSERT_EQ(200.0, cell->load()._y);
+    ASSERT_EQ(100u, cell->get_version());
+    ASSERT_THROW(bus.get_state<int32_t>("Pose"), std::logic_error);
+
+    bus.set_mode<Pose>("Pose", TopicMode::BOTH);
+    bus.publish<Pose>("Pose", Pose{});
+    for(int32_t retry = 0; retry < 100 && received.load() == 0; ++retry) { std::this_thread::sleep_for(std::chrono::milliseconds(10)); }
+    ASSERT_EQ(1, received.load());
+    ASSERT_EQ(0.0, bus.get_state<Pose>("Pose")->_x);
+}
 } // namespace common::test
\ No newline at end of file
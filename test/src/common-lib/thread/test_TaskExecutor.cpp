@@ -30,6 +30,7 @@ SOFTWARE.
 #include <array>
 #include <chrono>
 #include <climits>
+#include <memory_resource>
 #include <thread>
 
 namespace common::test
@@ -63,6 +64,25 @@ TEST(test_TaskExecutor, LoadSimpleFunction)
     executor->stop();
 }
 
+TEST(test_TaskExecutor, PostFromResource)
+{
+    // given
+    std::pmr::unsynchronized_pool_resource upstream;
+    std::pmr::synchronized_pool_resource resource(&upstream);
+    auto executor = TaskExecutor::create(2, &resource);
+    std::atomic<int32_t> count{0};
+
+    // when
+    for(int32_t i = 0; i < 100; ++i) { executor->post([&count](){ count.fetch_add(1); }); }
+    auto future = executor->load<int32_t>([](){ return 7; });
+
+    // then
+    ASSERT_EQ(7, future.get());
+    for(int32_t retry = 0; retry < 100 && count.load() != 100; ++retry) { std::this_thread::sleep_for(std::chrono::milliseconds(10)); }
+    ASSERT_EQ(100, count.load());
+    executor->stop();
+}
+
 TEST(test_TaskExecutor, LoadWithMultiTypesReturn)
 {
     // given
@@ -0,0 +1,59 @@
+/**********************************************************************
+MIT License
+
+Copyright (c) 2025 Park Younghwan
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+**********************************************************************/
+
+#include "common/logging/BinaryLog.hpp"
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+// usage: binlog-decoder <file> [<file> ...]
+// Prints the records of binary log files written by BinarySink as text, oldest file first.
+auto main(int32_t argc, char** argv) -> int32_t
+{
+    if(argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " <file> [<file> ...]" << std::endl;
+        return 1;
+    }
+
+    int32_t result = 0;
+    std::string line;
+    for(int32_t i = 1; i < argc; ++i)
+    {
+        auto reader = common::BinaryLogReader::create(std::string(argv[i]));
+        if(reader == nullptr)
+        {
+            std::cerr << argv[i] << " : not a binary log" << std::endl;
+            result = 1;
+            continue;
+        }
+        reader->read([&line](const common::LogRecord& record){
+            line.clear();
+            common::LogSink::append_line(line, record, true);
+            std::fwrite(line.data(), 1, line.size(), stdout);
+        });
+    }
+    return result;
+}